@@ -0,0 +1,136 @@
+#include <aegis/math/random.h>
+#include <aegis/physics/sweep_and_prune.h>
+#include <aegis/utils/timer.h>
+
+#include <format>
+#include <iostream>
+
+// Headless broadphase benchmark: sweep and prune over moving spheres compared with brute force pair tests
+
+namespace
+{
+	constexpr float RADIUS = 0.5f;
+	constexpr float VOLUME_PER_BODY = 8.0f;
+	constexpr float MAX_SPEED = 5.0f;
+	constexpr float TICK_SECONDS = 1.0f / 60.0f;
+	constexpr uint32_t TICK_COUNT = 10;
+	constexpr uint32_t BRUTE_FORCE_LIMIT = 10'000;
+
+	struct Bodies
+	{
+		std::vector<glm::vec3> locations;
+		std::vector<glm::vec3> velocities;
+		std::vector<Aegis::Physics::AABB> bounds;
+		float halfExtent;
+	};
+
+	auto createBodies(uint32_t bodyCount) -> Bodies
+	{
+		// Constant density, so the pair count per body stays the same for every count
+		Bodies bodies;
+		bodies.halfExtent = std::cbrt(static_cast<float>(bodyCount) * VOLUME_PER_BODY) * 0.5f;
+		bodies.locations.resize(bodyCount);
+		bodies.velocities.resize(bodyCount);
+		bodies.bounds.resize(bodyCount);
+		for (uint32_t i = 0; i < bodyCount; i++)
+		{
+			bodies.locations[i] = glm::vec3{
+				Aegis::Random::uniformFloat(-bodies.halfExtent, bodies.halfExtent),
+				Aegis::Random::uniformFloat(-bodies.halfExtent, bodies.halfExtent),
+				Aegis::Random::uniformFloat(-bodies.halfExtent, bodies.halfExtent) };
+			bodies.velocities[i] = glm::vec3{
+				Aegis::Random::uniformFloat(-MAX_SPEED, MAX_SPEED),
+				Aegis::Random::uniformFloat(-MAX_SPEED, MAX_SPEED),
+				Aegis::Random::uniformFloat(-MAX_SPEED, MAX_SPEED) };
+		}
+		return bodies;
+	}
+
+	void move(Bodies& bodies)
+	{
+		for (size_t i = 0; i < bodies.locations.size(); i++)
+		{
+			glm::vec3& location = bodies.locations[i];
+			location += bodies.velocities[i] * TICK_SECONDS;
+
+			// Bounce off the walls
+			for (int axis = 0; axis < 3; axis++)
+			{
+				if (std::abs(location[axis]) > bodies.halfExtent)
+					bodies.velocities[i][axis] = -bodies.velocities[i][axis];
+			}
+
+			bodies.bounds[i] = Aegis::Physics::AABB{ location - RADIUS, location + RADIUS };
+		}
+	}
+
+	auto overlaps(const Aegis::Physics::AABB& a, const Aegis::Physics::AABB& b) -> bool
+	{
+		return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+			a.min.y <= b.max.y && a.max.y >= b.min.y &&
+			a.min.z <= b.max.z && a.max.z >= b.min.z;
+	}
+
+	auto bruteForcePairs(const Bodies& bodies) -> size_t
+	{
+		size_t pairs = 0;
+		const size_t count = bodies.bounds.size();
+		for (size_t a = 0; a < count; a++)
+		{
+			for (size_t b = a + 1; b < count; b++)
+			{
+				pairs += overlaps(bodies.bounds[a], bodies.bounds[b]) ? 1 : 0;
+			}
+		}
+		return pairs;
+	}
+}
+
+auto main() -> int
+{
+	Aegis::Random::seed(42);
+
+	std::cout << std::format("{:>8} | {:>13} | {:>15} | {:>8} | {:>8} | {}\n",
+		"Bodies", "SAP (ms/tick)", "Brute (ms/tick)", "Speedup", "Pairs", "Result");
+	for (uint32_t bodyCount : { 10'000u, 50'000u, 100'000u })
+	{
+		Bodies sapBodies = createBodies(bodyCount);
+		Bodies bruteBodies = sapBodies;
+
+		// The first update sorts from scratch, the measured ticks are incremental
+		Aegis::Physics::SweepAndPrune sweepAndPrune;
+		move(sapBodies);
+		sweepAndPrune.update(sapBodies.bounds);
+
+		Aegis::Timer timer;
+		for (uint32_t tick = 0; tick < TICK_COUNT; tick++)
+		{
+			move(sapBodies);
+			sweepAndPrune.update(sapBodies.bounds);
+		}
+		double sapMs = timer.elapsedMillis() / TICK_COUNT;
+		size_t sapPairs = sweepAndPrune.pairs().size();
+
+		if (bodyCount > BRUTE_FORCE_LIMIT)
+		{
+			std::cout << std::format("{:>8} | {:>13.3f} | {:>15} | {:>8} | {:>8} | {}\n", bodyCount, sapMs, "skipped", "-", sapPairs, "-");
+			continue;
+		}
+
+		size_t brutePairs = 0;
+		move(bruteBodies);
+		timer.reStart();
+		for (uint32_t tick = 0; tick < TICK_COUNT; tick++)
+		{
+			move(bruteBodies);
+			brutePairs = bruteForcePairs(bruteBodies);
+		}
+		double bruteMs = timer.elapsedMillis() / TICK_COUNT;
+
+		const char* result = sapPairs == brutePairs ? "match" : "MISMATCH";
+		std::cout << std::format("{:>8} | {:>13.3f} | {:>15.3f} | {:>7.1f}x | {:>8} | {}\n",
+			bodyCount, sapMs, bruteMs, bruteMs / sapMs, sapPairs, result);
+	}
+
+	return 0;
+}
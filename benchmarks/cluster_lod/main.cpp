@@ -0,0 +1,142 @@
+#include <aegis/core/globals.h>
+#include <aegis/graphics/resources/cluster_lod.h>
+#include <aegis/scene/loader/obj_loader.h>
+#include <aegis/utils/timer.h>
+
+#include <format>
+#include <iostream>
+
+// Headless cluster LOD check: builds the hierarchy of a procedural terrain and of the given OBJ files (defaults to the
+// teapot) and asserts that the selected cut is watertight over several view distances and error thresholds
+// Usage: ClusterLOD-Benchmark [obj files...], returns 1 if any hierarchy or cut is invalid
+
+namespace
+{
+	constexpr uint32_t TERRAIN_SIZE = 256;
+	constexpr float ERROR_SCALE = 0.5f * 1080.0f / 0.577f; // Approximately 1080p with a vertical fov of 60 degrees
+	constexpr float DISTANCES[] = { 1.5f, 4.0f, 16.0f, 64.0f, 256.0f }; // In mesh radii from the mesh center
+	constexpr float THRESHOLDS[] = { 0.5f, 1.0f, 4.0f, 16.0f };         // In pixels
+
+	struct Mesh
+	{
+		std::string name;
+		std::vector<Aegis::Graphics::StaticMesh::Vertex> vertices;
+		std::vector<uint32_t> indices;
+	};
+
+	auto createTerrain() -> Mesh
+	{
+		Mesh mesh{ .name = "terrain" };
+		mesh.vertices.reserve(TERRAIN_SIZE * TERRAIN_SIZE);
+		for (uint32_t y = 0; y < TERRAIN_SIZE; y++)
+		{
+			for (uint32_t x = 0; x < TERRAIN_SIZE; x++)
+			{
+				const float height = std::sin(x * 0.11f) * std::cos(y * 0.07f) * 4.0f + std::sin((x + y) * 0.31f) * 0.5f;
+				mesh.vertices.emplace_back(Aegis::Graphics::StaticMesh::Vertex{
+					.position = { static_cast<float>(x), static_cast<float>(y), height },
+					.normal = { 0.0f, 0.0f, 1.0f },
+					.uv = glm::vec2{ x, y } / static_cast<float>(TERRAIN_SIZE - 1),
+					.color = glm::vec3{ 1.0f } });
+			}
+		}
+
+		for (uint32_t y = 0; y + 1 < TERRAIN_SIZE; y++)
+		{
+			for (uint32_t x = 0; x + 1 < TERRAIN_SIZE; x++)
+			{
+				const uint32_t i = y * TERRAIN_SIZE + x;
+				mesh.indices.insert(mesh.indices.end(), { i, i + 1, i + TERRAIN_SIZE, i + 1, i + TERRAIN_SIZE + 1, i + TERRAIN_SIZE });
+			}
+		}
+		return mesh;
+	}
+
+	auto loadMesh(const std::filesystem::path& path) -> Mesh
+	{
+		auto info = Aegis::Scene::OBJLoader::importMesh(path, {});
+		return Mesh{ .name = path.stem().string(), .vertices = std::move(info.vertices), .indices = std::move(info.indices) };
+	}
+
+	auto bounds(const Mesh& mesh) -> Aegis::Graphics::StaticMesh::BoundingSphere
+	{
+		glm::vec3 center{ 0.0f };
+		for (const auto& vertex : mesh.vertices)
+		{
+			center += vertex.position;
+		}
+		center /= static_cast<float>(mesh.vertices.size());
+
+		float radius = 0.0f;
+		for (const auto& vertex : mesh.vertices)
+		{
+			radius = std::max(radius, glm::distance(center, vertex.position));
+		}
+		return { center, radius };
+	}
+
+	auto triangleCount(const Aegis::Graphics::ClusterLOD::Hierarchy& hierarchy, const std::vector<uint32_t>& cut) -> size_t
+	{
+		size_t count = 0;
+		for (uint32_t clusterID : cut)
+		{
+			count += hierarchy.clusters[clusterID].primitives.size() / 3;
+		}
+		return count;
+	}
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+	std::vector<Mesh> meshes;
+	meshes.emplace_back(createTerrain());
+	for (int i = 1; i < argc; i++)
+	{
+		meshes.emplace_back(loadMesh(argv[i]));
+	}
+	if (argc == 1)
+	{
+		meshes.emplace_back(loadMesh(ASSETS_DIR "Misc/teapot.obj"));
+	}
+
+	bool valid = true;
+	std::cout << std::format("{:<10} | {:>8} | {:>6} | {:>8} | {:>9} | {:>8} | {:>9} | {}\n", "Mesh", "Clusters", "Levels",
+		"Build ms", "Threshold", "Distance", "Triangles", "Cut");
+	for (const auto& mesh : meshes)
+	{
+		Aegis::Timer timer;
+		const auto hierarchy = Aegis::Graphics::ClusterLOD::build(mesh.vertices, mesh.indices, {});
+		const double buildMillis = timer.elapsedMillis();
+
+		if (!Aegis::Graphics::ClusterLOD::validateHierarchy(hierarchy))
+		{
+			std::cout << std::format("{:<10} | hierarchy is not monotonic\n", mesh.name);
+			valid = false;
+			continue;
+		}
+
+		const auto sphere = bounds(mesh);
+		for (float threshold : THRESHOLDS)
+		{
+			for (float distance : DISTANCES)
+			{
+				// Diagonal view direction, so the cut changes across the mesh
+				const Aegis::Graphics::ClusterLOD::View view{
+					.position = sphere.center + glm::normalize(glm::vec3{ 1.0f, -1.0f, 1.0f }) * sphere.radius * distance,
+					.errorScale = ERROR_SCALE,
+					.errorThreshold = threshold
+				};
+
+				const auto cut = Aegis::Graphics::ClusterLOD::selectCut(hierarchy, view);
+				const bool watertight = Aegis::Graphics::ClusterLOD::validateCut(hierarchy, cut, mesh.vertices);
+				valid = valid && watertight;
+
+				std::cout << std::format("{:<10} | {:>8} | {:>6} | {:>8.1f} | {:>9.1f} | {:>8.1f} | {:>9} | {}\n", mesh.name,
+					hierarchy.clusters.size(), hierarchy.levelCount, buildMillis, threshold, distance,
+					triangleCount(hierarchy, cut), watertight ? "watertight" : "CRACKED");
+			}
+		}
+	}
+
+	return valid ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+#include <aegis/graphics/light_clusters.h>
+#include <aegis/math/random.h>
+#include <aegis/utils/timer.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <iostream>
+
+// Headless light clustering check: compares the per-cluster light lists of LightClusterBinner::bin (the CPU reference
+// of light_culling.slang) against a brute force sphere/AABB test built from the projection matrix, and checks that
+// every point lit by a light falls into a cluster that lists the light
+
+namespace
+{
+	using Binner = Aegis::Graphics::LightClusterBinner;
+
+	constexpr float NEAR = 0.1f;
+	constexpr float FAR = 200.0f;
+	constexpr uint32_t SAMPLES_PER_LIGHT = 64;
+
+	struct Camera
+	{
+		Aegis::Graphics::ClusterView view;
+		glm::mat4 projection;
+	};
+
+	auto createCamera() -> Camera
+	{
+		Camera camera;
+		camera.projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, NEAR, FAR);
+		camera.view = Aegis::Graphics::ClusterView{
+			.view = glm::lookAt(glm::vec3{ 0.0f, -20.0f, 5.0f }, glm::vec3{ 0.0f, 0.0f, 0.0f }, glm::vec3{ 0.0f, 0.0f, 1.0f }),
+			.projectionScale = glm::vec2{ camera.projection[0][0], camera.projection[1][1] },
+			.near = NEAR,
+			.far = FAR,
+		};
+		return camera;
+	}
+
+	auto createLights(uint32_t count) -> std::vector<Aegis::Graphics::GPUPointLight>
+	{
+		std::vector<Aegis::Graphics::GPUPointLight> lights;
+		lights.reserve(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const glm::vec3 color{ Aegis::Random::uniformFloat(), Aegis::Random::uniformFloat(), Aegis::Random::uniformFloat() };
+			const float intensity = Aegis::Random::uniformFloat(0.01f, 1.0f);
+			const glm::vec3 location{ Aegis::Random::uniformFloat(-60.0f, 60.0f), Aegis::Random::uniformFloat(-30.0f, 120.0f),
+				Aegis::Random::uniformFloat(-5.0f, 20.0f) };
+			lights.emplace_back(glm::vec4{ location, Aegis::Graphics::LightClusters::lightRadius(color, intensity) },
+				glm::vec4{ color, intensity });
+		}
+		return lights;
+	}
+
+	/// @brief View space position of an NDC position at a positive view depth, through the inverse projection
+	auto unproject(const Camera& camera, const glm::vec2& ndc, float depth) -> glm::vec3
+	{
+		const glm::vec4 clip = camera.projection * glm::vec4{ 0.0f, 0.0f, -depth, 1.0f };
+		const glm::vec4 view = glm::inverse(camera.projection) * glm::vec4{ ndc * clip.w, clip.z, clip.w };
+		return glm::vec3{ view } / view.w;
+	}
+
+	/// @brief Reference binning: every light against every cluster, bounds and distance computed independently
+	auto bruteForce(const Camera& camera, const std::vector<Aegis::Graphics::GPUPointLight>& lights) -> Binner::Result
+	{
+		Binner::Result result;
+		result.lightCounts.resize(Binner::CLUSTER_COUNT, 0);
+		result.lightIndices.resize(Binner::CLUSTER_COUNT * Binner::MAX_LIGHTS_PER_CLUSTER, 0);
+
+		for (uint32_t z = 0; z < Binner::SIZE_Z; z++)
+		{
+			const float nearDepth = NEAR * std::pow(FAR / NEAR, static_cast<float>(z) / Binner::SIZE_Z);
+			const float farDepth = NEAR * std::pow(FAR / NEAR, static_cast<float>(z + 1) / Binner::SIZE_Z);
+			for (uint32_t y = 0; y < Binner::SIZE_Y; y++)
+			{
+				for (uint32_t x = 0; x < Binner::SIZE_X; x++)
+				{
+					glm::vec3 min{ std::numeric_limits<float>::max() };
+					glm::vec3 max{ std::numeric_limits<float>::lowest() };
+					for (uint32_t corner = 0; corner < 8; corner++)
+					{
+						const glm::vec2 tile{ x + (corner & 1), y + ((corner >> 1) & 1) };
+						const glm::vec2 ndc = tile / glm::vec2{ Binner::SIZE_X, Binner::SIZE_Y } * 2.0f - 1.0f;
+						const glm::vec3 position = unproject(camera, ndc, (corner & 4) ? farDepth : nearDepth);
+						min = glm::min(min, position);
+						max = glm::max(max, position);
+					}
+
+					const uint32_t cluster = x + y * Binner::SIZE_X + z * Binner::SIZE_X * Binner::SIZE_Y;
+					uint32_t& count = result.lightCounts[cluster];
+					for (uint32_t i = 0; i < lights.size() && count < Binner::MAX_LIGHTS_PER_CLUSTER; i++)
+					{
+						const glm::vec3 center = camera.view.view * glm::vec4{ glm::vec3{ lights[i].positionRadius }, 1.0f };
+						float distanceSquared = 0.0f;
+						for (int axis = 0; axis < 3; axis++)
+						{
+							const float outside = std::max({ min[axis] - center[axis], 0.0f, center[axis] - max[axis] });
+							distanceSquared += outside * outside;
+						}
+						if (distanceSquared <= lights[i].positionRadius.w * lights[i].positionRadius.w)
+						{
+							result.lightIndices[cluster * Binner::MAX_LIGHTS_PER_CLUSTER + count++] = i;
+						}
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	/// @brief Counts the cluster lists that differ, unproject rounding may flip lights that touch a cluster exactly
+	auto countMismatches(const Binner::Result& a, const Binner::Result& b) -> uint32_t
+	{
+		uint32_t mismatches = 0;
+		for (uint32_t cluster = 0; cluster < Binner::CLUSTER_COUNT; cluster++)
+		{
+			const auto first = cluster * Binner::MAX_LIGHTS_PER_CLUSTER;
+			if (a.lightCounts[cluster] != b.lightCounts[cluster] ||
+				!std::equal(a.lightIndices.begin() + first, a.lightIndices.begin() + first + a.lightCounts[cluster], b.lightIndices.begin() + first))
+			{
+				mismatches++;
+			}
+		}
+		return mismatches;
+	}
+
+	/// @brief Samples points inside every light sphere and checks their cluster lists the light, returns the misses
+	auto countMissedLights(const Camera& camera, const std::vector<Aegis::Graphics::GPUPointLight>& lights,
+		const Binner::Result& result) -> uint32_t
+	{
+		uint32_t missed = 0;
+		for (uint32_t i = 0; i < lights.size(); i++)
+		{
+			const glm::vec3 center = camera.view.view * glm::vec4{ glm::vec3{ lights[i].positionRadius }, 1.0f };
+			for (uint32_t sample = 0; sample < SAMPLES_PER_LIGHT; sample++)
+			{
+				const glm::vec3 offset{ Aegis::Random::uniformFloat(-1.0f, 1.0f), Aegis::Random::uniformFloat(-1.0f, 1.0f),
+					Aegis::Random::uniformFloat(-1.0f, 1.0f) };
+				const glm::vec3 point = center + offset * lights[i].positionRadius.w * 0.57f; // Inside the sphere
+				const float depth = -point.z;
+
+				const glm::vec4 clip = camera.projection * glm::vec4{ point, 1.0f };
+				const glm::vec2 ndc = glm::vec2{ clip } / clip.w;
+				if (depth < NEAR || depth >= FAR || glm::any(glm::greaterThanEqual(glm::abs(ndc), glm::vec2{ 1.0f })))
+					continue;
+
+				const auto x = static_cast<uint32_t>((ndc.x * 0.5f + 0.5f) * Binner::SIZE_X);
+				const auto y = static_cast<uint32_t>((ndc.y * 0.5f + 0.5f) * Binner::SIZE_Y);
+				const auto z = std::min(static_cast<uint32_t>(std::log(depth / NEAR) / std::log(FAR / NEAR) * Binner::SIZE_Z), Binner::SIZE_Z - 1);
+				const uint32_t cluster = Binner::clusterIndex(x, y, z);
+				if (result.lightCounts[cluster] == Binner::MAX_LIGHTS_PER_CLUSTER)
+					continue; // Full clusters drop lights by design
+
+				const auto first = result.lightIndices.begin() + cluster * Binner::MAX_LIGHTS_PER_CLUSTER;
+				if (std::find(first, first + result.lightCounts[cluster], i) == first + result.lightCounts[cluster])
+					missed++;
+			}
+		}
+		return missed;
+	}
+}
+
+auto main() -> int
+{
+	Aegis::Random::seed(42);
+	const Camera camera = createCamera();
+
+	std::cout << std::format("{:>7} | {:>11} | {:>16} | {:>18} | {}\n", "Lights", "Binner (ms)", "Brute force (ms)",
+		"Mismatched clusters", "Missed samples");
+	for (uint32_t lightCount : { 16u, 128u, 1'024u })
+	{
+		const auto lights = createLights(lightCount);
+
+		Aegis::Timer timer;
+		const auto binned = Binner::bin(camera.view, lights);
+		const double binMillis = timer.elapsedMillis();
+
+		timer.reStart();
+		const auto reference = bruteForce(camera, lights);
+		const double bruteMillis = timer.elapsedMillis();
+
+		std::cout << std::format("{:>7} | {:>11.3f} | {:>16.3f} | {:>18} | {}\n", lightCount, binMillis, bruteMillis,
+			countMismatches(binned, reference), countMissedLights(camera, lights, binned));
+	}
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+#include <aegis/core/globals.h>
+#include <aegis/graphics/resources/mesh_codec.h>
+#include <aegis/scene/loader/obj_loader.h>
+#include <aegis/utils/file.h>
+#include <aegis/utils/timer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <span>
+
+// Headless mesh loading benchmark: importing the source asset (parsing and preprocessing), reading the raw
+// uncompressed streams from disk and reading the cooked file with decoding (MeshCodec), all into CPU memory
+// Usage: MeshCodec-Benchmark [obj files...], defaults to the teapot. Files are read through the OS file cache.
+
+namespace
+{
+	constexpr uint32_t ITERATIONS = 10;
+
+	template <typename T>
+	auto bytes(const std::vector<T>& data) -> std::span<const char>
+	{
+		return { reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T) };
+	}
+
+	auto streams(const Aegis::Graphics::StaticMesh::CreateInfo& info) -> std::array<std::span<const char>, 6>
+	{
+		return { bytes(info.vertices), bytes(info.quantizedVertices), bytes(info.indices), bytes(info.meshlets),
+			bytes(info.vertexIndices), bytes(info.primitiveIndices) };
+	}
+
+	auto writeRaw(const std::filesystem::path& path, const Aegis::Graphics::StaticMesh::CreateInfo& info) -> size_t
+	{
+		std::vector<char> data;
+		for (auto stream : streams(info))
+		{
+			data.insert(data.end(), stream.begin(), stream.end());
+		}
+		Aegis::File::writeBinary(path, data);
+		return data.size();
+	}
+
+	/// @brief Loads the raw streams into a mesh with the same layout as the reference (the sizes a raw format would store)
+	auto readRaw(const std::filesystem::path& path, const Aegis::Graphics::StaticMesh::CreateInfo& reference)
+		-> Aegis::Graphics::StaticMesh::CreateInfo
+	{
+		auto data = Aegis::File::readBinary(path);
+
+		Aegis::Graphics::StaticMesh::CreateInfo info{ .positionOffset = reference.positionOffset,
+			.positionScale = reference.positionScale, .bounds = reference.bounds };
+		info.vertices.resize(reference.vertices.size());
+		info.quantizedVertices.resize(reference.quantizedVertices.size());
+		info.indices.resize(reference.indices.size());
+		info.meshlets.resize(reference.meshlets.size());
+		info.baseMeshletCount = reference.baseMeshletCount;
+		info.vertexIndices.resize(reference.vertexIndices.size());
+		info.primitiveIndices.resize(reference.primitiveIndices.size());
+
+		// Same order as the streams are written
+		size_t offset = 0;
+		auto read = [&](auto& stream)
+			{
+				const size_t size = stream.size() * sizeof(stream[0]);
+				std::memcpy(stream.data(), data.data() + offset, size);
+				offset += size;
+			};
+		read(info.vertices);
+		read(info.quantizedVertices);
+		read(info.indices);
+		read(info.meshlets);
+		read(info.vertexIndices);
+		read(info.primitiveIndices);
+		return info;
+	}
+
+	auto equal(const Aegis::Graphics::StaticMesh::CreateInfo& a, const Aegis::Graphics::StaticMesh::CreateInfo& b) -> bool
+	{
+		auto streamsA = streams(a);
+		auto streamsB = streams(b);
+		for (size_t i = 0; i < streamsA.size(); i++)
+		{
+			if (!std::ranges::equal(streamsA[i], streamsB[i]))
+				return false;
+		}
+		return true;
+	}
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+	std::vector<std::filesystem::path> paths;
+	for (int i = 1; i < argc; i++)
+	{
+		paths.emplace_back(argv[i]);
+	}
+	if (paths.empty())
+	{
+		paths.emplace_back(ASSETS_DIR "Misc/teapot.obj");
+	}
+
+	const std::filesystem::path directory{ CACHE_DIR "benchmarks" };
+	std::filesystem::create_directories(directory);
+
+	const std::array<std::pair<const char*, Aegis::Graphics::MeshPreprocessor::Options>, 3> variants{ {
+		{ "default", {} },
+		{ "quantized", { .quantizeVertices = true } },
+		{ "cluster LOD", { .generateClusterLOD = true } },
+	} };
+
+	std::cout << std::format("{:<16} | {:<11} | {:>10} | {:>10} | {:>10} | {:>9} | {:>9} | {:>7} | {}\n", "Mesh", "Options",
+		"Import ms", "Raw ms", "Cooked ms", "Raw KB", "Cooked KB", "Ratio", "Decoded");
+	for (const auto& path : paths)
+	{
+		for (size_t variant = 0; variant < variants.size(); variant++)
+		{
+			const auto& [name, options] = variants[variant];
+			Aegis::Timer timer;
+			Aegis::Graphics::StaticMesh::CreateInfo imported;
+			for (uint32_t i = 0; i < ITERATIONS; i++)
+			{
+				imported = Aegis::Scene::OBJLoader::importMesh(path, options);
+			}
+			const double importMillis = timer.elapsedMillis() / ITERATIONS;
+
+			const auto rawPath = directory / std::format("{}_{}.raw", path.stem().string(), variant);
+			const auto cookedPath = directory / std::format("{}_{}.agxm", path.stem().string(), variant);
+			const size_t rawSize = writeRaw(rawPath, imported);
+			Aegis::Graphics::MeshCodec::save(cookedPath, imported);
+			const size_t cookedSize = std::filesystem::file_size(cookedPath);
+
+			timer.reStart();
+			for (uint32_t i = 0; i < ITERATIONS; i++)
+			{
+				auto raw = readRaw(rawPath, imported);
+			}
+			const double rawMillis = timer.elapsedMillis() / ITERATIONS;
+
+			timer.reStart();
+			std::optional<Aegis::Graphics::StaticMesh::CreateInfo> decoded;
+			for (uint32_t i = 0; i < ITERATIONS; i++)
+			{
+				decoded = Aegis::Graphics::MeshCodec::decode(Aegis::File::readBinary(cookedPath));
+			}
+			const double cookedMillis = timer.elapsedMillis() / ITERATIONS;
+
+			const char* result = decoded && equal(*decoded, imported) ? "match" : "MISMATCH";
+			std::cout << std::format("{:<16} | {:<11} | {:>10.3f} | {:>10.3f} | {:>10.3f} | {:>9} | {:>9} | {:>6.2f}x | {}\n",
+				path.stem().string(), name, importMillis, rawMillis, cookedMillis, rawSize / 1024, cookedSize / 1024,
+				static_cast<double>(rawSize) / static_cast<double>(cookedSize), result);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,113 @@
+#include <aegis/ai/pathfinding/navigation_grid.h>
+#include <aegis/ai/pathfinding/pathfinder.h>
+#include <aegis/math/random.h>
+#include <aegis/utils/timer.h>
+
+#include <algorithm>
+#include <format>
+#include <iostream>
+
+// Headless pathfinding benchmark: throughput of flat A*, hierarchical A*, hierarchical A* on the thread pool and
+// cached paths on grids with randomly placed round obstacles
+
+namespace
+{
+	constexpr float CELL_SIZE = 1.0f;
+	constexpr float OBSTACLE_DENSITY = 0.004f; // Obstacles per cell
+	constexpr float MIN_OBSTACLE_RADIUS = 1.0f;
+	constexpr float MAX_OBSTACLE_RADIUS = 6.0f;
+	constexpr uint32_t QUERY_COUNT = 1'000;
+
+	void createGrid(Aegis::AI::NavigationGrid& grid, uint32_t size)
+	{
+		const float extent = static_cast<float>(size) * CELL_SIZE;
+		grid.resize(glm::vec2{ 0.0f }, glm::vec2{ extent }, CELL_SIZE);
+
+		const uint32_t obstacleCount = static_cast<uint32_t>(static_cast<float>(size * size) * OBSTACLE_DENSITY);
+		for (uint32_t i = 0; i < obstacleCount; i++)
+		{
+			glm::vec2 center{ Aegis::Random::uniformFloat(0.0f, extent), Aegis::Random::uniformFloat(0.0f, extent) };
+			grid.blockCircle(center, Aegis::Random::uniformFloat(MIN_OBSTACLE_RADIUS, MAX_OBSTACLE_RADIUS));
+		}
+		grid.buildClusters();
+	}
+
+	auto randomWalkableLocation(const Aegis::AI::NavigationGrid& grid) -> glm::vec3
+	{
+		while (true)
+		{
+			uint32_t cell = static_cast<uint32_t>(Aegis::Random::uniformInt(0, static_cast<int>(grid.cellCount()) - 1));
+			if (grid.isWalkable(cell))
+				return grid.cellCenter(cell);
+		}
+	}
+
+	struct Measurement
+	{
+		double millis;
+		uint32_t found;
+	};
+
+	auto countFound(const std::vector<Aegis::AI::PathResult>& results) -> uint32_t
+	{
+		return static_cast<uint32_t>(std::ranges::count_if(results, [](const auto& result) { return result.found; }));
+	}
+
+	auto measureSerial(Aegis::AI::Pathfinder& pathfinder, const std::vector<Aegis::AI::PathQuery>& queries) -> Measurement
+	{
+		std::vector<Aegis::AI::PathResult> results(queries.size());
+		Aegis::Timer timer;
+		for (size_t i = 0; i < queries.size(); i++)
+		{
+			results[i] = pathfinder.findPath(queries[i]);
+		}
+		return Measurement{ timer.elapsedMillis(), countFound(results) };
+	}
+
+	auto measureParallel(Aegis::AI::Pathfinder& pathfinder, const std::vector<Aegis::AI::PathQuery>& queries) -> Measurement
+	{
+		std::vector<Aegis::AI::PathResult> results(queries.size());
+		Aegis::Timer timer;
+		pathfinder.findPaths(queries, results);
+		return Measurement{ timer.elapsedMillis(), countFound(results) };
+	}
+
+	void print(uint32_t size, const char* method, const Measurement& measurement)
+	{
+		std::cout << std::format("{:>9} | {:<20} | {:>10.3f} | {:>12.1f} | {:>5}/{}\n", std::format("{0}x{0}", size), method,
+			measurement.millis, QUERY_COUNT / measurement.millis, measurement.found, QUERY_COUNT);
+	}
+}
+
+auto main() -> int
+{
+	Aegis::Random::seed(42);
+
+	std::cout << std::format("{:>9} | {:<20} | {:>10} | {:>12} | {}\n", "Grid", "Method", "Total (ms)", "Requests/ms", "Found");
+	for (uint32_t size : { 128u, 256u, 512u })
+	{
+		Aegis::AI::NavigationGrid grid;
+		createGrid(grid, size);
+
+		std::vector<Aegis::AI::PathQuery> queries(QUERY_COUNT);
+		for (auto& query : queries)
+		{
+			query = Aegis::AI::PathQuery{ randomWalkableLocation(grid), randomWalkableLocation(grid) };
+		}
+
+		Aegis::AI::Pathfinder uncached{ grid, 0 };
+		uncached.setHierarchical(false);
+		print(size, "A*", measureSerial(uncached, queries));
+
+		uncached.setHierarchical(true);
+		print(size, "Hierarchical A*", measureSerial(uncached, queries));
+		print(size, "Hierarchical (pool)", measureParallel(uncached, queries));
+
+		// The first pass fills the cache, the second one only measures hits
+		Aegis::AI::Pathfinder cached{ grid, QUERY_COUNT };
+		measureParallel(cached, queries);
+		print(size, "Cached (pool)", measureParallel(cached, queries));
+	}
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include <aegis/graphics/radix_sort.h>
+#include <aegis/math/random.h>
+#include <aegis/utils/timer.h>
+
+#include <format>
+#include <iostream>
+
+// Headless transparent sort benchmark: the CPU reference of the GPU radix sort (RadixSort::sort) against
+// std::stable_sort on the same transparent sort keys, both must give the same order (the sort is stable)
+
+namespace
+{
+	constexpr uint32_t ITERATIONS = 10;
+	constexpr float MAX_VIEW_DEPTH = 500.0f;
+
+	struct Input
+	{
+		std::vector<uint32_t> keys;
+		std::vector<uint32_t> values;
+	};
+
+	auto createInput(uint32_t count) -> Input
+	{
+		Input input;
+		input.keys.reserve(count);
+		input.values.reserve(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const auto batch = static_cast<uint32_t>(Aegis::Random::uniformInt(0, Aegis::Graphics::DrawBatchRegistry::MAX_DRAW_BATCHES - 1));
+			input.keys.emplace_back(Aegis::Graphics::RadixSort::transparentKey(batch, Aegis::Random::uniformFloat(0.0f, MAX_VIEW_DEPTH)));
+			input.values.emplace_back(i);
+		}
+		return input;
+	}
+
+	auto measureRadixSort(const Input& input, Input& output) -> double
+	{
+		double millis = 0.0;
+		for (uint32_t i = 0; i < ITERATIONS; i++)
+		{
+			output = input;
+
+			Aegis::Timer timer;
+			Aegis::Graphics::RadixSort::sort(output.keys, output.values);
+			millis += timer.elapsedMillis();
+		}
+		return millis / ITERATIONS;
+	}
+
+	auto measureStableSort(const Input& input, Input& output) -> double
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> pairs(input.keys.size());
+		double millis = 0.0;
+		for (uint32_t i = 0; i < ITERATIONS; i++)
+		{
+			for (size_t j = 0; j < pairs.size(); j++)
+			{
+				pairs[j] = { input.keys[j], input.values[j] };
+			}
+
+			Aegis::Timer timer;
+			std::stable_sort(pairs.begin(), pairs.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+			millis += timer.elapsedMillis();
+		}
+
+		output.keys.resize(pairs.size());
+		output.values.resize(pairs.size());
+		for (size_t j = 0; j < pairs.size(); j++)
+		{
+			output.keys[j] = pairs[j].first;
+			output.values[j] = pairs[j].second;
+		}
+		return millis / ITERATIONS;
+	}
+}
+
+auto main() -> int
+{
+	Aegis::Random::seed(42);
+
+	std::cout << std::format("{:>10} | {:>10} | {:>13} | {:>16} | {:>8} | {}\n", "Instances", "GPU groups", "Radix (ms)",
+		"Stable sort (ms)", "Speedup", "Order");
+	for (uint32_t count : { 1'000u, 10'000u, 100'000u, 1'000'000u })
+	{
+		const Input input = createInput(count);
+
+		Input radixOutput;
+		Input stableOutput;
+		const double radixMillis = measureRadixSort(input, radixOutput);
+		const double stableMillis = measureStableSort(input, stableOutput);
+
+		// Equal keys keep their input order in both sorts, so the values must match as well
+		const bool match = radixOutput.keys == stableOutput.keys && radixOutput.values == stableOutput.values;
+
+		std::cout << std::format("{:>10} | {:>10} | {:>13.3f} | {:>16.3f} | {:>7.1f}x | {}\n", count,
+			Aegis::Graphics::RadixSort::groupCount(count), radixMillis, stableMillis, stableMillis / radixMillis,
+			match ? "match" : "MISMATCH");
+	}
+
+	return 0;
+}
@@ -0,0 +1,161 @@
+#include <aegis/ai/steering/steering_agent.h>
+#include <aegis/ai/steering/steering_system.h>
+#include <aegis/math/random.h>
+#include <aegis/scene/components.h>
+#include <aegis/scene/scene.h>
+#include <aegis/scene/spatial_hash_grid.h>
+#include <aegis/utils/timer.h>
+
+#include <format>
+#include <iostream>
+
+// Headless flocking benchmark: ticks the engine's SteeringSystem on a scene of flocking agents, serial and on the
+// thread pool, and compares the neighbour queries of its spatial hash grid with a brute force loop
+
+namespace
+{
+	constexpr float AREA_PER_AGENT = 16.0f;
+	constexpr float TICK_SECONDS = 1.0f / 60.0f;
+	constexpr uint32_t TICK_COUNT = 10;
+	constexpr uint32_t BRUTE_FORCE_LIMIT = 10'000;
+
+	struct Swarm
+	{
+		std::vector<glm::vec3> locations;
+		std::vector<glm::vec3> velocities;
+	};
+
+	auto createSwarm(uint32_t agentCount) -> Swarm
+	{
+		// Constant density, so the neighbour count per agent stays the same for every swarm size
+		const float halfExtent = std::sqrt(static_cast<float>(agentCount) * AREA_PER_AGENT) * 0.5f;
+
+		Swarm swarm;
+		swarm.locations.resize(agentCount);
+		swarm.velocities.resize(agentCount);
+		for (uint32_t i = 0; i < agentCount; i++)
+		{
+			swarm.locations[i] = glm::vec3{
+				Aegis::Random::uniformFloat(-halfExtent, halfExtent),
+				Aegis::Random::uniformFloat(-halfExtent, halfExtent),
+				0.0f };
+			swarm.velocities[i] = glm::vec3{ Aegis::Random::uniformFloat(-1.0f, 1.0f), Aegis::Random::uniformFloat(-1.0f, 1.0f), 0.0f };
+		}
+		return swarm;
+	}
+
+	void populate(Aegis::Scene::Scene& scene, const Swarm& swarm)
+	{
+		for (size_t i = 0; i < swarm.locations.size(); i++)
+		{
+			auto agent = scene.createEntity("Agent", swarm.locations[i]);
+			agent.add<Aegis::AI::SteeringAgent>(Aegis::AI::SteeringAgent{
+				.behaviours = Aegis::AI::SteeringAgent::Flocking,
+				.velocity = swarm.velocities[i],
+				});
+		}
+
+		scene.addSystem<Aegis::AI::SteeringSystem>();
+		scene.begin();
+	}
+
+	auto measureTicks(Aegis::Scene::Scene& scene, bool parallel) -> double
+	{
+		auto steering = scene.system<Aegis::AI::SteeringSystem>();
+		steering->setParallel(parallel);
+
+		Aegis::Timer timer;
+		for (uint32_t tick = 0; tick < TICK_COUNT; tick++)
+		{
+			steering->onFixedUpdate(TICK_SECONDS, scene);
+		}
+		return timer.elapsedMillis() / TICK_COUNT;
+	}
+
+	auto checksum(Aegis::Scene::Scene& scene) -> double
+	{
+		double sum = 0.0;
+		for (auto&& [entity, transform] : scene.registry().view<Aegis::Transform, Aegis::AI::SteeringAgent>().each())
+		{
+			sum += transform.location.x + transform.location.y;
+		}
+		return sum;
+	}
+
+	/// @brief Counts the neighbours within the cohesion radius of every agent, returns the time in ms and the total count
+	auto measureGridQueries(const Swarm& swarm) -> std::pair<double, uint64_t>
+	{
+		Aegis::Timer timer;
+		Aegis::Scene::SpatialHashGrid grid{ Aegis::AI::SteeringSystem::COHESION_RADIUS };
+		for (size_t i = 0; i < swarm.locations.size(); i++)
+		{
+			grid.insert(static_cast<entt::entity>(i), swarm.locations[i]);
+		}
+		grid.build();
+
+		uint64_t neighbours = 0;
+		for (const auto& location : swarm.locations)
+		{
+			grid.forEachInRadius(location, Aegis::AI::SteeringSystem::COHESION_RADIUS, [&](entt::entity, const glm::vec3&)
+				{
+					neighbours++;
+				});
+		}
+		return { timer.elapsedMillis(), neighbours };
+	}
+
+	auto measureBruteForceQueries(const Swarm& swarm) -> std::pair<double, uint64_t>
+	{
+		constexpr float radiusSquared = Aegis::AI::SteeringSystem::COHESION_RADIUS * Aegis::AI::SteeringSystem::COHESION_RADIUS;
+
+		Aegis::Timer timer;
+		uint64_t neighbours = 0;
+		for (const auto& location : swarm.locations)
+		{
+			for (const auto& other : swarm.locations)
+			{
+				const glm::vec3 offset = other - location;
+				neighbours += glm::dot(offset, offset) <= radiusSquared ? 1 : 0;
+			}
+		}
+		return { timer.elapsedMillis(), neighbours };
+	}
+}
+
+auto main() -> int
+{
+	Aegis::Random::seed(42);
+
+	std::cout << std::format("{:>8} | {:>16} | {:>14} | {:>8} | {:>8} | {:>13} | {:>14} | {}\n", "Agents", "Serial (ms/tick)",
+		"Pool (ms/tick)", "Speedup", "Result", "Grid query ms", "Brute query ms", "Neighbours");
+	for (uint32_t agentCount : { 1'000u, 10'000u, 100'000u })
+	{
+		const Swarm swarm = createSwarm(agentCount);
+
+		Aegis::Scene::Scene serialScene;
+		populate(serialScene, swarm);
+		const double serialMs = measureTicks(serialScene, false);
+
+		Aegis::Scene::Scene parallelScene;
+		populate(parallelScene, swarm);
+		const double parallelMs = measureTicks(parallelScene, true);
+
+		// Every agent sums its own neighbours, so the chunks on the pool must give the same result as the serial ticks
+		const char* result = checksum(serialScene) == checksum(parallelScene) ? "match" : "MISMATCH";
+
+		const auto [gridMs, gridNeighbours] = measureGridQueries(swarm);
+		std::string bruteMs = "skipped";
+		std::string neighbours = "-";
+		if (agentCount <= BRUTE_FORCE_LIMIT)
+		{
+			const auto [millis, bruteNeighbours] = measureBruteForceQueries(swarm);
+			bruteMs = std::format("{:.3f}", millis);
+			neighbours = gridNeighbours == bruteNeighbours ? "match" : "MISMATCH";
+		}
+
+		std::cout << std::format("{:>8} | {:>16.3f} | {:>14.3f} | {:>7.1f}x | {:>8} | {:>13.3f} | {:>14} | {}\n", agentCount,
+			serialMs, parallelMs, serialMs / parallelMs, result, gridMs, bruteMs, neighbours);
+	}
+
+	return 0;
+}
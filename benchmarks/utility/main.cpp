@@ -0,0 +1,142 @@
+#include <aegis/ai/utility/utility_reasoner.h>
+#include <aegis/math/interpolation.h>
+#include <aegis/math/random.h>
+#include <aegis/utils/timer.h>
+
+#include <format>
+#include <iostream>
+
+// Headless utility AI benchmark: scoring every option of every agent one agent at a time (scalar curves) against
+// UtilityReasoner::evaluate (one consideration at a time over all agents with the batched curves)
+
+namespace
+{
+	constexpr uint32_t INPUT_COUNT = 6;
+	constexpr uint32_t OPTION_COUNT = 8;
+	constexpr uint32_t CONSIDERATIONS_PER_OPTION = 3;
+	constexpr uint32_t ITERATIONS = 20;
+
+	auto randomCurve() -> Aegis::AI::ResponseCurve
+	{
+		const float min = Aegis::Random::uniformFloat(0.0f, 0.4f);
+		return Aegis::AI::ResponseCurve{
+			.type = static_cast<Aegis::AI::ResponseCurve::Type>(Aegis::Random::uniformInt(0, 3)),
+			.min = min,
+			.max = min + Aegis::Random::uniformFloat(0.2f, 0.6f),
+			.inverted = Aegis::Random::uniformInt(0, 1) == 1,
+		};
+	}
+
+	auto applyCurve(const Aegis::AI::ResponseCurve& curve, float input) -> float
+	{
+		float value = std::clamp((input - curve.min) / (curve.max - curve.min), 0.0f, 1.0f);
+		switch (curve.type)
+		{
+		case Aegis::AI::ResponseCurve::Type::Linear:
+			break;
+		case Aegis::AI::ResponseCurve::Type::Sigmoid:
+			value = Aegis::Math::sigmoid01(value);
+			break;
+		case Aegis::AI::ResponseCurve::Type::FastSigmoid:
+			value = Aegis::Math::fastSigmoid01(value);
+			break;
+		case Aegis::AI::ResponseCurve::Type::Tanh:
+			value = Aegis::Math::tanh01(value);
+			break;
+		}
+		return curve.inverted ? 1.0f - value : value;
+	}
+
+	/// @brief Scores the options of one agent after the other, like a utility reasoner per agent would
+	auto evaluatePerAgent(const std::vector<Aegis::AI::UtilityReasoner::Option>& options,
+		const std::vector<std::span<float>>& inputs, std::vector<uint32_t>& choices) -> double
+	{
+		Aegis::Timer timer;
+		for (uint32_t agent = 0; agent < choices.size(); agent++)
+		{
+			float bestScore = -1.0f;
+			for (uint32_t option = 0; option < options.size(); option++)
+			{
+				float score = options[option].weight;
+				for (const auto& consideration : options[option].considerations)
+				{
+					score *= applyCurve(consideration.curve, inputs[consideration.input][agent]);
+				}
+
+				if (score > bestScore)
+				{
+					bestScore = score;
+					choices[agent] = option;
+				}
+			}
+		}
+		return timer.elapsedMillis();
+	}
+
+	void print(uint32_t agentCount, const char* method, double millis, uint32_t matching)
+	{
+		std::cout << std::format("{:>7} | {:<10} | {:>10.3f} | {:>13.1f} | {:>6}/{}\n", agentCount, method, millis,
+			agentCount / (millis * 1000.0), matching, agentCount);
+	}
+}
+
+auto main() -> int
+{
+	Aegis::Random::seed(42);
+
+	std::cout << std::format("{:>7} | {:<10} | {:>10} | {:>13} | {}\n", "Agents", "Method", "Avg (ms)", "Agents/us", "Same choice");
+	for (uint32_t agentCount : { 1'000u, 10'000u, 100'000u })
+	{
+		Aegis::AI::UtilityReasoner reasoner;
+		std::vector<Aegis::AI::UtilityReasoner::Option> options;
+		for (uint32_t i = 0; i < INPUT_COUNT; i++)
+		{
+			reasoner.addInput();
+		}
+		for (uint32_t i = 0; i < OPTION_COUNT; i++)
+		{
+			auto& option = options.emplace_back(Aegis::AI::UtilityReasoner::Option{ .weight = Aegis::Random::uniformFloat(0.5f, 1.0f) });
+			const uint32_t index = reasoner.addOption(option.weight);
+			for (uint32_t j = 0; j < CONSIDERATIONS_PER_OPTION; j++)
+			{
+				const auto& consideration = option.considerations.emplace_back(Aegis::AI::UtilityReasoner::Consideration{
+					static_cast<uint32_t>(Aegis::Random::uniformInt(0, static_cast<int>(INPUT_COUNT) - 1)), randomCurve() });
+				reasoner.addConsideration(index, consideration.input, consideration.curve);
+			}
+		}
+
+		reasoner.setAgentCount(agentCount);
+		std::vector<std::span<float>> inputs;
+		for (uint32_t i = 0; i < INPUT_COUNT; i++)
+		{
+			for (float& value : inputs.emplace_back(reasoner.input(i)))
+			{
+				value = Aegis::Random::uniformFloat();
+			}
+		}
+
+		std::vector<uint32_t> choices(agentCount);
+		double perAgentMillis = 0.0;
+		double batchedMillis = 0.0;
+		for (uint32_t i = 0; i < ITERATIONS; i++)
+		{
+			perAgentMillis += evaluatePerAgent(options, inputs, choices);
+
+			Aegis::Timer timer;
+			reasoner.evaluate();
+			batchedMillis += timer.elapsedMillis();
+		}
+
+		// The batched curves are approximations, nearly equal scores can pick a different option
+		uint32_t matching = 0;
+		for (uint32_t agent = 0; agent < agentCount; agent++)
+		{
+			matching += choices[agent] == reasoner.choices()[agent] ? 1 : 0;
+		}
+
+		print(agentCount, "Per agent", perAgentMillis / ITERATIONS, agentCount);
+		print(agentCount, "Batched", batchedMillis / ITERATIONS, matching);
+	}
+
+	return 0;
+}
@@ -0,0 +1,74 @@
+#include <aegis/ai/scheduler/ai_scheduler.h>
+#include <aegis/ai/scheduler/scheduled_agent.h>
+#include <aegis/ai/steering/steering_agent.h>
+#include <aegis/ai/steering/steering_system.h>
+#include <aegis/engine.h>
+#include <aegis/math/random.h>
+#include <aegis/scene/components.h>
+#include <aegis/scene/description.h>
+
+/// @brief Crowd of agents walking to random goals, their decisions are time sliced by the AIScheduler
+/// @note The scheduler stats (ticked, skipped and deferred agents) are shown in the scene statistics panel
+class CrowdScene : public Aegis::Scene::Description
+{
+public:
+	static constexpr int AGENT_COUNT = 5'000;
+	static constexpr float AREA_SIZE = 200.0f;
+	static constexpr float GOAL_REACHED_DISTANCE = 2.0f;
+
+	void initialize(Aegis::Scene::Scene& scene) override
+	{
+		using namespace Aegis;
+
+		scene.addSystem<AI::SteeringSystem>();
+		scene.addSystem<AI::AIScheduler>();
+
+		// CAMERA
+		scene.mainCamera().get<Transform>() = Transform{
+			.location = { 0.0f, -40.0f, 15.0f },
+			.rotation = glm::radians(glm::vec3{ -20.0f, 0.0f, 0.0f })
+		};
+
+		// ENTITIES
+		auto teapot = scene.load(ASSETS_DIR "Misc/teapot.obj");
+		teapot.get<Transform>().scale = glm::vec3{ 2.0f, 2.0f, 2.0f };
+		auto mesh = teapot.get<Mesh>().staticMesh;
+		auto material = teapot.get<Material>().instance;
+
+		for (int i = 0; i < AGENT_COUNT; i++)
+		{
+			auto agent = scene.createEntity("Agent " + std::to_string(i), randomLocation());
+			agent.get<Transform>().scale = glm::vec3{ 0.3f };
+			agent.add<Mesh>(mesh);
+			agent.add<Material>(material);
+			agent.add<DynamicTag>();
+			agent.add<AI::SteeringAgent>(AI::SteeringAgent{
+				.behaviours = AI::SteeringAgent::Arrive | AI::SteeringAgent::Separation,
+				.target = randomLocation(),
+				.maxSpeed = Random::uniformFloat(2.0f, 5.0f),
+				});
+
+			// Reasoning update: pick a new goal once the current one is reached
+			agent.add<AI::ScheduledAgent>().think = [agent](float)
+				{
+					auto& steering = agent.get<AI::SteeringAgent>();
+					if (glm::distance(agent.get<Transform>().location, steering.target) < GOAL_REACHED_DISTANCE)
+						steering.target = randomLocation();
+				};
+		}
+	}
+
+private:
+	static auto randomLocation() -> glm::vec3
+	{
+		constexpr float halfSize = AREA_SIZE / 2.0f;
+		return glm::vec3{ Aegis::Random::uniformFloat(-halfSize, halfSize), Aegis::Random::uniformFloat(-halfSize, halfSize), 0.0f };
+	}
+};
+
+auto main() -> int
+{
+	Aegis::Engine engine;
+	engine.loadScene<CrowdScene>();
+	engine.run();
+}
@@ -8,6 +8,12 @@
 class ColorChanger : public Aegis::Scripting::ScriptBase
 {
 public:
+	void begin() override
+	{
+		auto& material = get<Aegis::Material>().instance;
+		m_albedo = material->materialTemplate()->parameterID("albedo");
+	}
+
 	void update(float deltaSeconds) override
 	{
 		// Cycle through colors
@@ -20,8 +26,11 @@ public:
 		};
 
 		auto& material = get<Aegis::Material>().instance;
-		material->setParameter("albedo", color);
+		material->setParameter(m_albedo, color);
 	}
+
+private:
+	Aegis::Graphics::MaterialParameterID m_albedo{ Aegis::Graphics::INVALID_MATERIAL_PARAMETER };
 };
 
 
@@ -22,7 +22,7 @@ public:
 		env.prefiltered = Graphics::Texture::prefilteredMap(env.skybox);
 
 		// MODELS
-		scene.load(ASSETS_DIR "Sponza/Sponza.gltf");
+		scene.load(ASSETS_DIR "Sponza/Sponza.gltf", { .generateClusterLOD = true, .quantizeVertices = true });
 
 		// LIGHTS
 		scene.ambientLight().get<AmbientLight>().intensity = 0.5f;
@@ -2,6 +2,9 @@
 
 #include "ai/blackboard.h"
 #include "ai/option_manager.h"
+#include "ai/pathfinding/pathfinding_system.h"
+#include "ai/scheduler/scheduled_agent.h"
+#include "scene/scene.h"
 #include "scripting/script_base.h"
 
 namespace Aegis::AI
@@ -11,9 +14,36 @@ namespace Aegis::AI
     public:
         AIComponent(Blackboard& blackboard) : m_blackboard(blackboard) {}
 
+        void begin() override
+        {
+            add<ScheduledAgent>().think = [this](float deltaSeconds) { m_optionManager.update(deltaSeconds); };
+        }
+
+        /// @brief Updates the options every frame, unless an AIScheduler is part of the scene and takes over
         void update(float deltaSeconds) override
         {
-            m_optionManager.update(deltaSeconds);
+            if (!get<ScheduledAgent>().scheduled)
+                m_optionManager.update(deltaSeconds);
+        }
+
+        /// @brief Requests a path from the entity to the goal, it is written to the blackboard as PathKnowledge once solved
+        /// @note The scene needs a PathfindingSystem, the path is empty if the goal is not reachable.
+        ///       The result is dropped if the entity was destroyed before the path was solved.
+        void requestPath(const glm::vec3& goal, const std::string& pathKey)
+        {
+            auto pathfinding = entity().scene().system<PathfindingSystem>();
+            AGX_ASSERT_X(pathfinding, "Scene has no PathfindingSystem");
+
+            BlackboardKey key = m_blackboard.key(pathKey);
+            pathfinding->request(get<Aegis::GlobalTransform>().location, goal,
+                [entity = entity(), blackboard = &m_blackboard, key](const PathResult& result)
+                {
+                    // The versioned handle is invalid once the entity is destroyed, even if the id is reused
+                    if (!entity.registry().valid(entity))
+                        return;
+
+                    blackboard->set<PathKnowledge>(key, result.path);
+                });
         }
 
     protected:
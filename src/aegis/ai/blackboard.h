@@ -2,12 +2,56 @@
 
 #include "ai/knowledge.h"
 
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
-#include <memory>
 
 namespace Aegis::AI
 {
+	/// @brief Interned name of a knowledge (resolved once, compared as integer)
+	/// @note Keys are interned globally (thread safe), so the same name has the same key in every blackboard and one
+	///       compiled decision tree can evaluate the blackboards of many agents
+	struct BlackboardKey
+	{
+		static constexpr uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+
+		uint32_t id = INVALID;
+
+		bool isValid() const { return id != INVALID; }
+		bool operator==(const BlackboardKey&) const = default;
+	};
+
+	/// @brief Typed reference to a knowledge in a blackboard, reading it is a single pointer dereference
+	/// @note Cache it instead of looking up the name on every access. The slot is stamped with the generation of its
+	///       key, call Blackboard::refresh before reading a cached slot since the key may have been re-typed.
+	template <typename T>
+	class BlackboardSlot
+	{
+	public:
+		BlackboardSlot() = default;
+		explicit BlackboardSlot(BlackboardKey key, T* value = nullptr, uint32_t generation = 0)
+			: m_value(value), m_key(key), m_generation(generation) {}
+
+		bool isValid() const { return m_value != nullptr; }
+		explicit operator bool() const { return isValid(); }
+
+		BlackboardKey key() const { return m_key; }
+		uint32_t generation() const { return m_generation; }
+
+		T& operator*() const { return *m_value; }
+		T* operator->() const { return m_value; }
+		T* get() const { return m_value; }
+
+	private:
+		T* m_value = nullptr;
+		BlackboardKey m_key;
+		uint32_t m_generation = 0;
+	};
+
 	class Blackboard
 	{
 	public:
@@ -16,10 +60,60 @@ namespace Aegis::AI
 		Blackboard(Blackboard&&) = default;
 		~Blackboard() = default;
 
+		/// @brief Interns the name and returns its key (registers the name if it is new)
+		static BlackboardKey key(const std::string& name)
+		{
+			std::lock_guard lock{ s_keyMutex };
+			auto [it, inserted] = s_keys.try_emplace(name, static_cast<uint32_t>(s_keys.size()));
+			return BlackboardKey{ it->second };
+		}
+
+		/// @brief Returns the key of the name or an invalid key if the name was never interned
+		static BlackboardKey findKey(const std::string& name)
+		{
+			std::lock_guard lock{ s_keyMutex };
+			auto it = s_keys.find(name);
+			return it != s_keys.end() ? BlackboardKey{ it->second } : BlackboardKey{};
+		}
+
 		/// @brief Returns true if a knowledge with given name exists
 		bool exists(const std::string& name) const
 		{
-			return m_knowledgeBase.find(name) != m_knowledgeBase.end();
+			BlackboardKey key = findKey(name);
+			return key.id < m_entries.size() && m_entries[key.id].knowledge != nullptr;
+		}
+
+		/// @brief Set knowledge by key
+		/// @note Knowledge is created with given arguments in the typed storage of T
+		/// @note Setting a key to another type destroys the old knowledge and its storage is reused by other keys of that
+		///       type. The key gets a new generation, so cached slots are resolved again by refresh().
+		template <typename T, typename... Args>
+		void set(BlackboardKey key, Args&&... args)
+		{
+			AGX_ASSERT_X(key.isValid(), "Invalid blackboard key");
+
+			if (key.id >= m_entries.size())
+				m_entries.resize(key.id + 1);
+
+			auto& entry = m_entries[key.id];
+			if (entry.knowledge && entry.type == typeIndex<T>())
+			{
+				// Replaced in place, so slots handed out before stay valid
+				entry.knowledge = &static_cast<std::optional<T>*>(entry.value)->emplace(std::forward<Args>(args)...);
+				return;
+			}
+
+			// The old knowledge can only be destroyed by the storage of its own type
+			if (entry.knowledge)
+			{
+				m_storages[entry.type]->release(entry.value);
+				entry.generation++;
+			}
+
+			auto* value = storage<T>().acquire();
+			entry.type = typeIndex<T>();
+			entry.knowledge = &value->emplace(std::forward<Args>(args)...);
+			entry.value = value;
 		}
 
 		/// @brief Set knowledge by name
@@ -27,22 +121,60 @@ namespace Aegis::AI
 		template <typename T, typename... Args>
 		void set(const std::string& name, Args&&... args)
 		{
-			m_knowledgeBase[name] = std::make_unique<T>(std::forward<Args>(args)...);
+			set<T>(key(name), std::forward<Args>(args)...);
+		}
+
+		/// @brief Returns the typed slot of the key
+		/// @note The slot is invalid if the knowledge is not set (yet) or has another type
+		template <typename T>
+		BlackboardSlot<T> slot(BlackboardKey key) const
+		{
+			if (key.id >= m_entries.size())
+				return BlackboardSlot<T>{ key };
+
+			const auto& entry = m_entries[key.id];
+			if (!entry.knowledge || entry.type != typeIndex<T>())
+				return BlackboardSlot<T>{ key };
+
+			return BlackboardSlot<T>{ key, static_cast<T*>(entry.knowledge), entry.generation };
+		}
+
+		template <typename T>
+		BlackboardSlot<T> slot(const std::string& name) const
+		{
+			return slot<T>(findKey(name));
+		}
+
+		/// @brief Returns true if the slot still references the knowledge of its key (set and not re-typed since)
+		template <typename T>
+		bool isCurrent(const BlackboardSlot<T>& slot) const
+		{
+			if (!slot || slot.key().id >= m_entries.size())
+				return false;
+
+			const auto& entry = m_entries[slot.key().id];
+			return entry.knowledge && entry.generation == slot.generation();
+		}
+
+		/// @brief Resolves the slot again if it is not current (e.g. the knowledge was set after the slot was created)
+		template <typename T>
+		void refresh(BlackboardSlot<T>& slot) const
+		{
+			if (!isCurrent(slot))
+				slot = this->slot<T>(slot.key());
 		}
 
 		/// @brief Get knowledge by name
 		/// @note If knowledge is not found, nullptr is returned
 		Knowledge* get(const std::string& name)
 		{
-			auto it = m_knowledgeBase.find(name);
-			if (it != m_knowledgeBase.end())
-				return it->second.get();
-
-			return nullptr;
+			BlackboardKey key = findKey(name);
+			return key.id < m_entries.size() ? m_entries[key.id].knowledge : nullptr;
 		}
 
 		/// @brief Get knowledge by name and cast it to T
-		/// @note If knowledge is not found or cast fails, nullptr is returned
+		/// @note If knowledge is not found or is not a T (or derived from T), nullptr is returned
+		/// @note Looks up the name and casts on every call, prefer caching a slot (exact type only) for frequent reads
 		template <typename T>
 		T* get(const std::string& name)
 		{
@@ -50,6 +182,72 @@ namespace Aegis::AI
 		}
 
 	private:
-		std::unordered_map<std::string, std::unique_ptr<Knowledge>> m_knowledgeBase;
+		struct Entry
+		{
+			uint32_t type = 0;
+			Knowledge* knowledge = nullptr;
+			uint32_t generation = 0; // Incremented when the key is re-typed
+			void* value = nullptr; // std::optional<T> holding the knowledge, only its storage knows T
+		};
+
+		struct StorageBase
+		{
+			virtual ~StorageBase() = default;
+
+			/// @brief Destroys the knowledge of the value and keeps the value for reuse
+			virtual void release(void* value) = 0;
+		};
+
+		/// @brief All knowledge of one type, a deque keeps the addresses stable when growing
+		template <typename T>
+		struct Storage : StorageBase
+		{
+			std::deque<std::optional<T>> values;
+			std::vector<std::optional<T>*> freeValues;
+
+			std::optional<T>* acquire()
+			{
+				if (freeValues.empty())
+					return &values.emplace_back();
+
+				auto* value = freeValues.back();
+				freeValues.pop_back();
+				return value;
+			}
+
+			void release(void* value) override
+			{
+				auto* typedValue = static_cast<std::optional<T>*>(value);
+				typedValue->reset();
+				freeValues.emplace_back(typedValue);
+			}
+		};
+
+		template <typename T>
+		static uint32_t typeIndex()
+		{
+			static const uint32_t index = s_typeCount.fetch_add(1, std::memory_order_relaxed);
+			return index;
+		}
+
+		template <typename T>
+		Storage<T>& storage()
+		{
+			static_assert(std::is_base_of_v<Knowledge, T>, "Blackboard can only store types derived from Knowledge");
+
+			auto& storage = m_storages[typeIndex<T>()];
+			if (!storage)
+				storage = std::make_unique<Storage<T>>();
+
+			return static_cast<Storage<T>&>(*storage);
+		}
+
+		inline static std::mutex s_keyMutex;
+		inline static std::unordered_map<std::string, uint32_t> s_keys;
+		inline static std::atomic<uint32_t> s_typeCount{ 0 };
+
+		// Indexed by key id, keys that are not set in this blackboard have no knowledge
+		std::vector<Entry> m_entries;
+		std::unordered_map<uint32_t, std::unique_ptr<StorageBase>> m_storages;
 	};
 }
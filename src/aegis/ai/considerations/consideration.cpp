@@ -1,58 +1,67 @@
+#include "pch.h"
 #include "consideration.h"
 
 #include "scene/components.h"
-#include "utils/math_utils.h"
-
-#include <cassert>
-
 
 namespace Aegis::AI
 {
 	BoolConsideration::BoolConsideration(Blackboard& blackboard, std::string key)
 		: Consideration(blackboard), 
-		m_key(std::move(key)) 
+		m_key(blackboard.key(key)) 
 	{
 	}
 
 	bool BoolConsideration::evaluate() const
 	{
-		auto value = m_blackboard.get<BoolKnowledge>(m_key);
-		assert(value != nullptr && "Key does not exist in blackboard");
-		
-		return value->value;
+		return resolve(m_key, m_value).value;
+	}
+
+	FlatConsideration BoolConsideration::flatten() const
+	{
+		return FlatConsideration{ .type = FlatConsideration::Type::Bool, .keyA = m_key };
 	}
 
 	ThresholdConsideration::ThresholdConsideration(Blackboard& blackboard, std::string key, float threshold)
 		: Consideration(blackboard),
-		m_key(std::move(key)),
+		m_key(blackboard.key(key)),
 		m_threshold(threshold)
 	{
 	}
 
 	bool ThresholdConsideration::evaluate() const
 	{
-		auto value = m_blackboard.get<FloatKnowledge>(m_key);
-		assert(value != nullptr && "Key does not exist in blackboard");
-		
-		return value->value >= m_threshold;
+		return resolve(m_key, m_value).value >= m_threshold;
+	}
+
+	FlatConsideration ThresholdConsideration::flatten() const
+	{
+		return FlatConsideration{ .type = FlatConsideration::Type::Threshold, .keyA = m_key, .value = m_threshold };
 	}
 
 	EntityDistanceConsideration::EntityDistanceConsideration(Blackboard& blackboard, std::string entityKeyA, std::string entityKeyB, float distance)
 		: Consideration(blackboard),
-		m_entityKeyA(std::move(entityKeyA)),
-		m_entityKeyB(std::move(entityKeyB)),
+		m_entityKeyA(blackboard.key(entityKeyA)),
+		m_entityKeyB(blackboard.key(entityKeyB)),
 		m_distance(distance)
 	{
 	}
 
 	bool EntityDistanceConsideration::evaluate() const
 	{
-		auto entityA = m_blackboard.get<EntityKnowledge>(m_entityKeyA);
-		auto entityB = m_blackboard.get<EntityKnowledge>(m_entityKeyB);
-		assert(entityA && entityB && "Entity key does not exist in blackboard");
+		auto& entityA = resolve(m_entityKeyA, m_entityA);
+		auto& entityB = resolve(m_entityKeyB, m_entityB);
 
-		auto& positionA = entityA->entity.getComponent<Aegis::Component::Transform>().location;
-		auto& positionB = entityB->entity.getComponent<Aegis::Component::Transform>().location;
+		auto& positionA = entityA.entity.get<Transform>().location;
+		auto& positionB = entityB.entity.get<Transform>().location;
 		return glm::distance(positionA, positionB) < m_distance;
 	}
+
+	FlatConsideration EntityDistanceConsideration::flatten() const
+	{
+		return FlatConsideration{
+			.type = FlatConsideration::Type::EntityDistance,
+			.keyA = m_entityKeyA,
+			.keyB = m_entityKeyB,
+			.value = m_distance };
+	}
 }
@@ -7,7 +7,29 @@
 
 namespace Aegis::AI
 {
+	class Consideration;
+
+	///@brief Plain data of a consideration, used by the FlatDecisionTree to evaluate it by type tag instead of a virtual call
+	struct FlatConsideration
+	{
+		enum class Type : uint8_t
+		{
+			Bool,
+			Threshold,
+			EntityDistance,
+			Custom, // Unknown consideration, falls back to the virtual evaluate() (bound to its own blackboard)
+		};
+
+		Type type = Type::Custom;
+		BlackboardKey keyA;
+		BlackboardKey keyB;
+		float value = 0.0f;
+		const Consideration* custom = nullptr;
+	};
+
 	///@brief Base class for all considerations
+	///@note Keys are interned on construction, the typed slots are resolved on the first evaluation and cached
+	///      (the knowledge may be set after the consideration is created). Stale slots are resolved again.
 	class Consideration
 	{
 	public:
@@ -16,7 +38,23 @@ namespace Aegis::AI
 
 		virtual bool evaluate() const = 0;
 
+		const Blackboard& blackboard() const { return m_blackboard; }
+
+		///@brief Returns the plain data of the consideration for the FlatDecisionTree
+		///@note Override it for new consideration types that should be evaluated without a virtual call
+		virtual FlatConsideration flatten() const { return FlatConsideration{ .custom = this }; }
+
 	protected:
+		template <typename T>
+		T& resolve(BlackboardKey key, BlackboardSlot<T>& slot) const
+		{
+			if (!m_blackboard.isCurrent(slot))
+				slot = m_blackboard.slot<T>(key);
+
+			AGX_ASSERT_X(slot, "Key does not exist in blackboard");
+			return *slot;
+		}
+
 		Blackboard& m_blackboard;
 	};
 
@@ -28,9 +66,11 @@ namespace Aegis::AI
 		BoolConsideration(Blackboard& blackboard, std::string boolKey);
 
 		virtual bool evaluate() const override;
+		virtual FlatConsideration flatten() const override;
 
 	private:
-		std::string m_key;
+		BlackboardKey m_key;
+		mutable BlackboardSlot<BoolKnowledge> m_value;
 	};
 
 
@@ -42,9 +82,11 @@ namespace Aegis::AI
 		ThresholdConsideration(Blackboard& blackboard, std::string floatKey, float threshold);
 
 		virtual bool evaluate() const override;
+		virtual FlatConsideration flatten() const override;
 
 	private:
-		std::string m_key;
+		BlackboardKey m_key;
+		mutable BlackboardSlot<FloatKnowledge> m_value;
 		float m_threshold;
 	};
 
@@ -57,10 +99,13 @@ namespace Aegis::AI
 		EntityDistanceConsideration(Blackboard& blackboard, std::string entityKeyA, std::string entityKeyB, float distance);
 
 		virtual bool evaluate() const override;
+		virtual FlatConsideration flatten() const override;
 
 	private:
-		std::string m_entityKeyA;
-		std::string m_entityKeyB;
+		BlackboardKey m_entityKeyA;
+		BlackboardKey m_entityKeyB;
+		mutable BlackboardSlot<EntityKnowledge> m_entityA;
+		mutable BlackboardSlot<EntityKnowledge> m_entityB;
 		float m_distance;
 	};
 }
@@ -10,6 +10,10 @@ namespace Aegis::AI
     DecisionTreeAiComponent::DecisionTreeAiComponent(Blackboard& blackboard)
         : AIComponent(blackboard), m_decisionTree(blackboard)
     {
+        // Set by the decision tree, so the slots can be cached right away
+        m_time = m_blackboard.slot<FloatKnowledge>("Time");
+        m_atWar = m_blackboard.slot<BoolKnowledge>("AtWar");
+
         auto& input = Aegis::Input::instance();
         input.bind(this, &DecisionTreeAiComponent::toggleWar, Aegis::Input::One);
     }
@@ -26,21 +30,20 @@ namespace Aegis::AI
 
     void DecisionTreeAiComponent::updateTime(float delta)
     {
-        auto time = m_blackboard.get<FloatKnowledge>("Time")->value;
+        m_blackboard.refresh(m_time);
+        auto& time = m_time->value;
         time += delta / 3.0f;
 
         if (time > 1.0f)
             time = 0.0f;
-
-        m_blackboard.set<FloatKnowledge>("Time", time);
     }
 
     void DecisionTreeAiComponent::toggleWar()
     {
-        auto atWar = m_blackboard.get<BoolKnowledge>("AtWar")->value;
-        m_blackboard.set<BoolKnowledge>("AtWar", !atWar);
+        m_blackboard.refresh(m_atWar);
+        m_atWar->value = !m_atWar->value;
 
-        std::cout << "AtWar: " << m_blackboard.get<BoolKnowledge>("AtWar")->value << std::endl;
+        std::cout << "AtWar: " << m_atWar->value << std::endl;
     }
 
     void DecisionTreeAiComponent::update(float delta)
@@ -18,5 +18,8 @@ namespace Aegis::AI
 
     private:
         MyDecisionTree m_decisionTree;
+
+        BlackboardSlot<FloatKnowledge> m_time;
+        BlackboardSlot<BoolKnowledge> m_atWar;
     };
 } 
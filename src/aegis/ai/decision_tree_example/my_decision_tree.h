@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ai/reasoners/decision_tree.h"
+#include "ai/reasoners/flat_decision_tree.h"
 #include "ai/considerations/consideration.h"
 #include "ai/decision_tree_example/example_options.h"
 
@@ -10,6 +11,7 @@ namespace Aegis::AI
 	{
 	public:
 		MyDecisionTree(Aegis::AI::Blackboard& blackboard) 
+			: m_blackboard(blackboard)
 		{
 			blackboard.set<Aegis::AI::BoolKnowledge>("PlayerNear", true);
 			blackboard.set<Aegis::AI::BoolKnowledge>("AtWar", false);
@@ -27,14 +29,18 @@ namespace Aegis::AI
 
 			Aegis::AI::DecisionTree::addTrue<Aegis::AI::MurderOption>(atWarNode, comp);
 			Aegis::AI::DecisionTree::addFalse<Aegis::AI::GreetOption>(atWarNode, comp);
+
+			m_flatTree = FlatDecisionTree(m_tree);
 		}
 
 		std::unique_ptr<Option> evaluate() const
 		{
-			return m_tree.evaluate();
+			return m_flatTree.createOption(m_flatTree.evaluate(m_blackboard));
 		}
 
 	private:
+		Blackboard& m_blackboard;
 		DecisionTree m_tree;
+		FlatDecisionTree m_flatTree;
 	};
 }
\ No newline at end of file
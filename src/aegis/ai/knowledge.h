@@ -1,7 +1,7 @@
 #pragma once
 
 #include "scene/entity.h"
-#include "utils/math_utils.h"
+#include "math/math.h"
 
 namespace Aegis::AI
 {
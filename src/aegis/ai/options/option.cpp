@@ -1,3 +1,4 @@
+#include "pch.h"
 #include "option.h"
 
 namespace Aegis::AI
@@ -0,0 +1,181 @@
+#include "pch.h"
+#include "navigation_grid.h"
+
+#include "core/profiler.h"
+#include "scene/components.h"
+#include "scene/scene.h"
+
+namespace Aegis::AI
+{
+	void NavigationGrid::resize(const glm::vec2& min, const glm::vec2& max, float cellSize, float elevation)
+	{
+		AGX_ASSERT_X(cellSize > 0.0f, "Navigation grid cell size must be greater than zero");
+
+		m_origin = min;
+		m_elevation = elevation;
+		m_cellSize = cellSize;
+		m_width = std::max(static_cast<uint32_t>(std::ceil((max.x - min.x) / cellSize)), 1u);
+		m_height = std::max(static_cast<uint32_t>(std::ceil((max.y - min.y) / cellSize)), 1u);
+		m_walkable.assign(static_cast<size_t>(m_width) * m_height, 1);
+
+		m_clusterCountX = (m_width + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+		m_clusterCountY = (m_height + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+		m_clusterLinks.assign(static_cast<size_t>(m_clusterCountX) * m_clusterCountY, 0);
+
+		m_version++;
+	}
+
+	void NavigationGrid::blockCircle(const glm::vec2& center, float radius)
+	{
+		if (m_walkable.empty())
+			return;
+
+		const glm::vec2 min = (center - radius - m_origin) / m_cellSize;
+		const glm::vec2 max = (center + radius - m_origin) / m_cellSize;
+		const uint32_t minX = static_cast<uint32_t>(std::clamp(min.x, 0.0f, static_cast<float>(m_width - 1)));
+		const uint32_t minY = static_cast<uint32_t>(std::clamp(min.y, 0.0f, static_cast<float>(m_height - 1)));
+		const uint32_t maxX = static_cast<uint32_t>(std::clamp(max.x, 0.0f, static_cast<float>(m_width - 1)));
+		const uint32_t maxY = static_cast<uint32_t>(std::clamp(max.y, 0.0f, static_cast<float>(m_height - 1)));
+
+		const float radiusSquared = radius * radius;
+		for (uint32_t y = minY; y <= maxY; y++)
+		{
+			for (uint32_t x = minX; x <= maxX; x++)
+			{
+				glm::vec2 offset = glm::vec2{ cellCenter(cellIndex(x, y)) } - center;
+				if (glm::dot(offset, offset) <= radiusSquared)
+					m_walkable[cellIndex(x, y)] = 0;
+			}
+		}
+
+		m_version++;
+	}
+
+	void NavigationGrid::build(Scene::Scene& scene, float cellSize)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		struct Footprint
+		{
+			glm::vec2 center;
+			float radius;
+		};
+
+		std::vector<Footprint> obstacles;
+		glm::vec2 min{ std::numeric_limits<float>::max() };
+		glm::vec2 max{ std::numeric_limits<float>::lowest() };
+		float elevation = std::numeric_limits<float>::max();
+
+		auto& registry = scene.registry();
+		auto view = registry.view<GlobalTransform, Mesh>(entt::exclude<DynamicTag>);
+		for (auto&& [entity, transform, mesh] : view.each())
+		{
+			if (!mesh.staticMesh)
+				continue;
+
+			const auto& bounds = mesh.staticMesh->bounds();
+			const glm::vec3 scale = glm::abs(transform.scale);
+			const glm::vec3 center = transform.location + transform.rotation * (transform.scale * bounds.center);
+			const float radius = bounds.radius * std::max({ scale.x, scale.y, scale.z });
+
+			min = glm::min(min, glm::vec2{ center } - radius);
+			max = glm::max(max, glm::vec2{ center } + radius);
+
+			if (registry.all_of<NavigationObstacle>(entity))
+			{
+				obstacles.emplace_back(Footprint{ glm::vec2{ center }, radius });
+			}
+			else
+			{
+				elevation = std::min(elevation, center.z);
+			}
+		}
+
+		if (min.x > max.x)
+		{
+			ALOG::warn("Navigation: No static meshes to build the grid from");
+			resize(glm::vec2{ 0.0f }, glm::vec2{ cellSize }, cellSize);
+			buildClusters();
+			return;
+		}
+
+		resize(min, max, cellSize, elevation == std::numeric_limits<float>::max() ? 0.0f : elevation);
+		for (const auto& obstacle : obstacles)
+		{
+			blockCircle(obstacle.center, obstacle.radius);
+		}
+		buildClusters();
+	}
+
+	void NavigationGrid::buildClusters()
+	{
+		AGX_PROFILE_FUNCTION();
+
+		std::fill(m_clusterLinks.begin(), m_clusterLinks.end(), uint8_t{ 0 });
+		for (uint32_t clusterY = 0; clusterY < m_clusterCountY; clusterY++)
+		{
+			for (uint32_t clusterX = 0; clusterX < m_clusterCountX; clusterX++)
+			{
+				const uint32_t cluster = clusterY * m_clusterCountX + clusterX;
+				if (clusterX + 1 < m_clusterCountX && borderConnected(clusterX, clusterY, true))
+				{
+					m_clusterLinks[cluster] |= PositiveX;
+					m_clusterLinks[cluster + 1] |= NegativeX;
+				}
+				if (clusterY + 1 < m_clusterCountY && borderConnected(clusterX, clusterY, false))
+				{
+					m_clusterLinks[cluster] |= PositiveY;
+					m_clusterLinks[cluster + m_clusterCountX] |= NegativeY;
+				}
+			}
+		}
+
+		m_version++;
+	}
+
+	auto NavigationGrid::cellAt(const glm::vec3& location) const -> uint32_t
+	{
+		const glm::vec2 cell = glm::floor((glm::vec2{ location } - m_origin) / m_cellSize);
+		if (cell.x < 0.0f || cell.y < 0.0f || cell.x >= static_cast<float>(m_width) || cell.y >= static_cast<float>(m_height))
+			return INVALID_INDEX;
+
+		return cellIndex(static_cast<uint32_t>(cell.x), static_cast<uint32_t>(cell.y));
+	}
+
+	auto NavigationGrid::cellCenter(uint32_t cell) const -> glm::vec3
+	{
+		const glm::vec2 center = m_origin + (glm::vec2{ static_cast<float>(cellX(cell)), static_cast<float>(cellY(cell)) } + 0.5f) * m_cellSize;
+		return glm::vec3{ center, m_elevation };
+	}
+
+	auto NavigationGrid::clusterOf(uint32_t cell) const -> uint32_t
+	{
+		return (cellY(cell) / CLUSTER_SIZE) * m_clusterCountX + cellX(cell) / CLUSTER_SIZE;
+	}
+
+	auto NavigationGrid::borderConnected(uint32_t clusterX, uint32_t clusterY, bool alongX) const -> bool
+	{
+		// Cells on both sides of the shared border, diagonal crossings need one of these pairs anyway
+		if (alongX)
+		{
+			const uint32_t x = (clusterX + 1) * CLUSTER_SIZE - 1;
+			const uint32_t lastY = std::min((clusterY + 1) * CLUSTER_SIZE, m_height);
+			for (uint32_t y = clusterY * CLUSTER_SIZE; y < lastY; y++)
+			{
+				if (isWalkable(cellIndex(x, y)) && isWalkable(cellIndex(x + 1, y)))
+					return true;
+			}
+		}
+		else
+		{
+			const uint32_t y = (clusterY + 1) * CLUSTER_SIZE - 1;
+			const uint32_t lastX = std::min((clusterX + 1) * CLUSTER_SIZE, m_width);
+			for (uint32_t x = clusterX * CLUSTER_SIZE; x < lastX; x++)
+			{
+				if (isWalkable(cellIndex(x, y)) && isWalkable(cellIndex(x, y + 1)))
+					return true;
+			}
+		}
+		return false;
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "math/math.h"
+
+namespace Aegis::Scene
+{
+	class Scene;
+}
+
+namespace Aegis::AI
+{
+	/// @brief Walkable cells on the ground plane (XY) for pathfinding, grouped into square clusters
+	/// @note The cluster links are the abstract graph of the hierarchical search: two neighbouring clusters are linked
+	///       if any pair of cells on their shared border is walkable
+	class NavigationGrid
+	{
+	public:
+		static constexpr float DEFAULT_CELL_SIZE = 1.0f;
+		static constexpr uint32_t CLUSTER_SIZE = 16;
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+		/// @brief Bit per direction in the cluster links
+		enum Link : uint8_t
+		{
+			PositiveX = 1 << 0,
+			NegativeX = 1 << 1,
+			PositiveY = 1 << 2,
+			NegativeY = 1 << 3,
+		};
+
+		NavigationGrid() = default;
+		~NavigationGrid() = default;
+
+		[[nodiscard]] auto width() const -> uint32_t { return m_width; }
+		[[nodiscard]] auto height() const -> uint32_t { return m_height; }
+		[[nodiscard]] auto cellCount() const -> uint32_t { return m_width * m_height; }
+		[[nodiscard]] auto cellSize() const -> float { return m_cellSize; }
+		[[nodiscard]] auto clusterCountX() const -> uint32_t { return m_clusterCountX; }
+		[[nodiscard]] auto clusterCountY() const -> uint32_t { return m_clusterCountY; }
+		[[nodiscard]] auto clusterCount() const -> uint32_t { return m_clusterCountX * m_clusterCountY; }
+
+		/// @brief Incremented on every change, used to invalidate cached paths
+		[[nodiscard]] auto version() const -> uint32_t { return m_version; }
+
+		/// @brief Resets the grid to walkable cells covering the area between min and max
+		void resize(const glm::vec2& min, const glm::vec2& max, float cellSize = DEFAULT_CELL_SIZE, float elevation = 0.0f);
+
+		/// @brief Blocks all cells with their center inside the circle
+		void blockCircle(const glm::vec2& center, float radius);
+
+		/// @brief Covers the bounds of all static meshes and blocks the footprint of each NavigationObstacle
+		/// @note Static means without DynamicTag, the global transforms have to be up to date
+		void build(Scene::Scene& scene, float cellSize = DEFAULT_CELL_SIZE);
+
+		/// @brief Recomputes the cluster links, call it after blocking cells
+		void buildClusters();
+
+		[[nodiscard]] auto cellIndex(uint32_t x, uint32_t y) const -> uint32_t { return y * m_width + x; }
+		[[nodiscard]] auto cellX(uint32_t cell) const -> uint32_t { return cell % m_width; }
+		[[nodiscard]] auto cellY(uint32_t cell) const -> uint32_t { return cell / m_width; }
+		[[nodiscard]] auto isWalkable(uint32_t cell) const -> bool { return m_walkable[cell] != 0; }
+
+		/// @brief Returns the cell containing the location or INVALID_INDEX if it is outside of the grid
+		[[nodiscard]] auto cellAt(const glm::vec3& location) const -> uint32_t;
+		[[nodiscard]] auto cellCenter(uint32_t cell) const -> glm::vec3;
+
+		[[nodiscard]] auto clusterOf(uint32_t cell) const -> uint32_t;
+		[[nodiscard]] auto clusterLinks(uint32_t cluster) const -> uint8_t { return m_clusterLinks[cluster]; }
+
+	private:
+		auto borderConnected(uint32_t clusterX, uint32_t clusterY, bool alongX) const -> bool;
+
+		glm::vec2 m_origin{ 0.0f };
+		float m_elevation{ 0.0f };
+		float m_cellSize{ DEFAULT_CELL_SIZE };
+		uint32_t m_width{ 0 };
+		uint32_t m_height{ 0 };
+		std::vector<uint8_t> m_walkable;
+
+		uint32_t m_clusterCountX{ 0 };
+		uint32_t m_clusterCountY{ 0 };
+		std::vector<uint8_t> m_clusterLinks;
+
+		uint32_t m_version{ 0 };
+	};
+}
@@ -0,0 +1,350 @@
+#include "pch.h"
+#include "pathfinder.h"
+
+#include "core/profiler.h"
+#include "core/thread_pool.h"
+
+namespace Aegis::AI
+{
+	namespace
+	{
+		constexpr float DIAGONAL_COST = 1.41421356f;
+
+		struct OpenNode
+		{
+			float priority;
+			uint32_t index;
+		};
+
+		/// @brief Search state per thread, reused so no allocations happen once it has grown to the grid size
+		/// @note Nodes are reset lazily by comparing their stamp with the stamp of the current search
+		struct SearchScratch
+		{
+			std::vector<float> cost;
+			std::vector<uint32_t> parent;
+			std::vector<uint32_t> visited;
+			std::vector<uint32_t> closed;
+			std::vector<OpenNode> open;
+			uint32_t stamp = 0;
+
+			void begin(size_t nodeCount)
+			{
+				if (visited.size() < nodeCount)
+				{
+					cost.resize(nodeCount);
+					parent.resize(nodeCount);
+					visited.resize(nodeCount, 0);
+					closed.resize(nodeCount, 0);
+				}
+				open.clear();
+
+				if (++stamp == 0)
+				{
+					std::fill(visited.begin(), visited.end(), 0u);
+					std::fill(closed.begin(), closed.end(), 0u);
+					stamp = 1;
+				}
+			}
+		};
+
+		thread_local SearchScratch t_cellSearch;
+		thread_local SearchScratch t_clusterSearch;
+
+		template <typename Heuristic, typename Neighbours>
+		auto aStar(SearchScratch& search, uint32_t start, uint32_t goal, size_t nodeCount, Heuristic&& heuristic,
+			Neighbours&& forEachNeighbour) -> bool
+		{
+			constexpr auto compare = [](const OpenNode& a, const OpenNode& b) { return a.priority > b.priority; };
+
+			search.begin(nodeCount);
+			search.cost[start] = 0.0f;
+			search.parent[start] = start;
+			search.visited[start] = search.stamp;
+			search.open.emplace_back(OpenNode{ heuristic(start), start });
+
+			while (!search.open.empty())
+			{
+				std::pop_heap(search.open.begin(), search.open.end(), compare);
+				const uint32_t current = search.open.back().index;
+				search.open.pop_back();
+
+				if (search.closed[current] == search.stamp)
+					continue;
+
+				if (current == goal)
+					return true;
+
+				search.closed[current] = search.stamp;
+				forEachNeighbour(current, [&](uint32_t neighbour, float stepCost)
+					{
+						if (search.closed[neighbour] == search.stamp)
+							return;
+
+						const float cost = search.cost[current] + stepCost;
+						if (search.visited[neighbour] == search.stamp && cost >= search.cost[neighbour])
+							return;
+
+						search.visited[neighbour] = search.stamp;
+						search.cost[neighbour] = cost;
+						search.parent[neighbour] = current;
+						search.open.emplace_back(OpenNode{ cost + heuristic(neighbour), neighbour });
+						std::push_heap(search.open.begin(), search.open.end(), compare);
+					});
+			}
+			return false;
+		}
+
+		auto octileDistance(int32_t dx, int32_t dy) -> float
+		{
+			const float x = static_cast<float>(std::abs(dx));
+			const float y = static_cast<float>(std::abs(dy));
+			return x + y + (DIAGONAL_COST - 2.0f) * std::min(x, y);
+		}
+	}
+
+	Pathfinder::Pathfinder(const NavigationGrid& grid, size_t cacheCapacity)
+		: m_grid{ grid }, m_cacheCapacity{ cacheCapacity }
+	{
+	}
+
+	void Pathfinder::clearCache()
+	{
+		std::lock_guard lock{ m_cacheMutex };
+		m_cache.clear();
+		m_cacheOrder.clear();
+		m_cacheNext = 0;
+	}
+
+	auto Pathfinder::findPath(const PathQuery& query) -> PathResult
+	{
+		const uint32_t start = m_grid.cellAt(query.start);
+		const uint32_t goal = m_grid.cellAt(query.goal);
+		if (start == NavigationGrid::INVALID_INDEX || goal == NavigationGrid::INVALID_INDEX ||
+			!m_grid.isWalkable(start) || !m_grid.isWalkable(goal))
+			return PathResult{};
+
+		PathResult result;
+		const uint64_t key = static_cast<uint64_t>(start) << 32 | goal;
+		const bool cached = m_cacheCapacity > 0 && cacheLookup(key, result.path);
+		if (!cached)
+		{
+			thread_local CellPath cells;
+			thread_local std::vector<uint8_t> corridor;
+
+			bool found = false;
+			const uint32_t startCluster = m_grid.clusterOf(start);
+			const uint32_t goalCluster = m_grid.clusterOf(goal);
+			if (m_hierarchical && startCluster != goalCluster)
+			{
+				// Every path crosses linked cluster borders, so no corridor means no path at all
+				if (!findCorridor(startCluster, goalCluster, corridor))
+					return PathResult{};
+
+				found = findCells(start, goal, &corridor, cells);
+			}
+
+			if (!found && !findCells(start, goal, nullptr, cells))
+				return PathResult{};
+
+			result.path = toWaypoints(cells);
+			cacheStore(key, result.path);
+		}
+
+		// Cached paths go through cell centers, the ends are the exact locations of the query
+		if (result.path.size() == 1)
+			result.path.emplace_back(query.goal);
+
+		result.path.front() = query.start;
+		result.path.back() = query.goal;
+		result.found = true;
+		return result;
+	}
+
+	auto Pathfinder::submitPaths(std::span<const PathQuery> queries, std::span<PathResult> results) -> std::vector<std::future<void>>
+	{
+		AGX_ASSERT_X(queries.size() == results.size(), "Each path query needs a result");
+
+		std::vector<std::future<void>> futures;
+		if (queries.empty())
+			return futures;
+
+		auto& threadPool = Core::ThreadPool::instance();
+		const size_t chunkCount = std::min(queries.size(), static_cast<size_t>(std::max(threadPool.threadCount(), 1u)) * 4);
+		const size_t chunkSize = (queries.size() + chunkCount - 1) / chunkCount;
+
+		futures.reserve(chunkCount);
+		for (size_t first = 0; first < queries.size(); first += chunkSize)
+		{
+			const size_t last = std::min(first + chunkSize, queries.size());
+			futures.emplace_back(threadPool.submit([this, queries, results, first, last]()
+				{
+					for (size_t i = first; i < last; i++)
+					{
+						results[i] = findPath(queries[i]);
+					}
+				}));
+		}
+		return futures;
+	}
+
+	void Pathfinder::findPaths(std::span<const PathQuery> queries, std::span<PathResult> results)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		for (auto& future : submitPaths(queries, results))
+		{
+			future.get();
+		}
+	}
+
+	auto Pathfinder::findCorridor(uint32_t startCluster, uint32_t goalCluster, std::vector<uint8_t>& corridor) const -> bool
+	{
+		const int32_t countX = static_cast<int32_t>(m_grid.clusterCountX());
+		const int32_t goalX = static_cast<int32_t>(goalCluster) % countX;
+		const int32_t goalY = static_cast<int32_t>(goalCluster) / countX;
+
+		auto heuristic = [&](uint32_t cluster)
+			{
+				const int32_t x = static_cast<int32_t>(cluster) % countX;
+				const int32_t y = static_cast<int32_t>(cluster) / countX;
+				return static_cast<float>(std::abs(goalX - x) + std::abs(goalY - y));
+			};
+
+		auto forEachNeighbour = [&](uint32_t cluster, auto&& visit)
+			{
+				const uint8_t links = m_grid.clusterLinks(cluster);
+				if (links & NavigationGrid::PositiveX) visit(cluster + 1, 1.0f);
+				if (links & NavigationGrid::NegativeX) visit(cluster - 1, 1.0f);
+				if (links & NavigationGrid::PositiveY) visit(cluster + m_grid.clusterCountX(), 1.0f);
+				if (links & NavigationGrid::NegativeY) visit(cluster - m_grid.clusterCountX(), 1.0f);
+			};
+
+		if (!aStar(t_clusterSearch, startCluster, goalCluster, m_grid.clusterCount(), heuristic, forEachNeighbour))
+			return false;
+
+		corridor.assign(m_grid.clusterCount(), 0);
+		for (uint32_t cluster = goalCluster; cluster != startCluster; cluster = t_clusterSearch.parent[cluster])
+		{
+			corridor[cluster] = 1;
+		}
+		corridor[startCluster] = 1;
+		return true;
+	}
+
+	auto Pathfinder::findCells(uint32_t start, uint32_t goal, const std::vector<uint8_t>* corridor, CellPath& path) const -> bool
+	{
+		const int32_t width = static_cast<int32_t>(m_grid.width());
+		const int32_t height = static_cast<int32_t>(m_grid.height());
+		const int32_t goalX = static_cast<int32_t>(m_grid.cellX(goal));
+		const int32_t goalY = static_cast<int32_t>(m_grid.cellY(goal));
+
+		auto heuristic = [&](uint32_t cell)
+			{
+				return octileDistance(goalX - static_cast<int32_t>(m_grid.cellX(cell)), goalY - static_cast<int32_t>(m_grid.cellY(cell)));
+			};
+
+		auto walkable = [&](int32_t x, int32_t y)
+			{
+				if (x < 0 || y < 0 || x >= width || y >= height)
+					return false;
+
+				const uint32_t cell = m_grid.cellIndex(static_cast<uint32_t>(x), static_cast<uint32_t>(y));
+				return m_grid.isWalkable(cell) && (!corridor || (*corridor)[m_grid.clusterOf(cell)]);
+			};
+
+		auto forEachNeighbour = [&](uint32_t cell, auto&& visit)
+			{
+				const int32_t x = static_cast<int32_t>(m_grid.cellX(cell));
+				const int32_t y = static_cast<int32_t>(m_grid.cellY(cell));
+				for (int32_t dy = -1; dy <= 1; dy++)
+				{
+					for (int32_t dx = -1; dx <= 1; dx++)
+					{
+						if ((dx == 0 && dy == 0) || !walkable(x + dx, y + dy))
+							continue;
+
+						// Diagonal steps must not cut corners
+						const bool diagonal = dx != 0 && dy != 0;
+						if (diagonal && (!walkable(x + dx, y) || !walkable(x, y + dy)))
+							continue;
+
+						visit(m_grid.cellIndex(static_cast<uint32_t>(x + dx), static_cast<uint32_t>(y + dy)), diagonal ? DIAGONAL_COST : 1.0f);
+					}
+				}
+			};
+
+		if (!aStar(t_cellSearch, start, goal, m_grid.cellCount(), heuristic, forEachNeighbour))
+			return false;
+
+		path.clear();
+		for (uint32_t cell = goal; cell != start; cell = t_cellSearch.parent[cell])
+		{
+			path.emplace_back(cell);
+		}
+		path.emplace_back(start);
+		std::reverse(path.begin(), path.end());
+		return true;
+	}
+
+	auto Pathfinder::toWaypoints(const CellPath& cells) const -> std::vector<glm::vec3>
+	{
+		// Only keep the cells where the direction changes
+		std::vector<glm::vec3> waypoints;
+		waypoints.emplace_back(m_grid.cellCenter(cells.front()));
+		for (size_t i = 1; i + 1 < cells.size(); i++)
+		{
+			const int64_t previousStep = static_cast<int64_t>(cells[i]) - static_cast<int64_t>(cells[i - 1]);
+			const int64_t nextStep = static_cast<int64_t>(cells[i + 1]) - static_cast<int64_t>(cells[i]);
+			if (previousStep != nextStep)
+				waypoints.emplace_back(m_grid.cellCenter(cells[i]));
+		}
+		if (cells.size() > 1)
+			waypoints.emplace_back(m_grid.cellCenter(cells.back()));
+
+		return waypoints;
+	}
+
+	auto Pathfinder::cacheLookup(uint64_t key, std::vector<glm::vec3>& path) -> bool
+	{
+		std::lock_guard lock{ m_cacheMutex };
+		if (m_cacheVersion != m_grid.version())
+		{
+			m_cache.clear();
+			m_cacheOrder.clear();
+			m_cacheNext = 0;
+			m_cacheVersion = m_grid.version();
+		}
+
+		auto it = m_cache.find(key);
+		if (it == m_cache.end())
+		{
+			m_cacheMisses++;
+			return false;
+		}
+
+		path = it->second;
+		m_cacheHits++;
+		return true;
+	}
+
+	void Pathfinder::cacheStore(uint64_t key, const std::vector<glm::vec3>& path)
+	{
+		if (m_cacheCapacity == 0)
+			return;
+
+		std::lock_guard lock{ m_cacheMutex };
+		auto [it, inserted] = m_cache.try_emplace(key, path);
+		if (!inserted)
+			return;
+
+		if (m_cacheOrder.size() < m_cacheCapacity)
+		{
+			m_cacheOrder.emplace_back(key);
+			return;
+		}
+
+		m_cache.erase(m_cacheOrder[m_cacheNext]);
+		m_cacheOrder[m_cacheNext] = key;
+		m_cacheNext = (m_cacheNext + 1) % m_cacheCapacity;
+	}
+}
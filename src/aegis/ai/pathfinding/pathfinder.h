@@ -0,0 +1,77 @@
+#pragma once
+
+#include "ai/pathfinding/navigation_grid.h"
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <span>
+
+namespace Aegis::AI
+{
+	struct PathQuery
+	{
+		glm::vec3 start{ 0.0f };
+		glm::vec3 goal{ 0.0f };
+	};
+
+	struct PathResult
+	{
+		/// @brief Waypoints from start to goal (corners only), empty if no path was found
+		std::vector<glm::vec3> path;
+		bool found = false;
+	};
+
+	/// @brief Hierarchical A* on a NavigationGrid with a cache of solved paths
+	/// @note First searches the cluster graph for a corridor and then runs A* on the cells restricted to that corridor.
+	///       If the corridor fails (a cluster is split inside) it falls back to A* on the whole grid.
+	///       Paths through the corridor can be slightly longer than the optimal path.
+	///       findPath is thread safe as long as the grid is not changed while searching.
+	class Pathfinder
+	{
+	public:
+		static constexpr size_t DEFAULT_CACHE_CAPACITY = 4096;
+
+		/// @brief A cache capacity of 0 disables the cache, searches then never take the cache lock
+		explicit Pathfinder(const NavigationGrid& grid, size_t cacheCapacity = DEFAULT_CACHE_CAPACITY);
+		~Pathfinder() = default;
+
+		[[nodiscard]] auto cacheHits() const -> uint64_t { return m_cacheHits; }
+		[[nodiscard]] auto cacheMisses() const -> uint64_t { return m_cacheMisses; }
+
+		/// @brief Disables the cluster search to always run A* on the whole grid (for comparison)
+		void setHierarchical(bool hierarchical) { m_hierarchical = hierarchical; }
+
+		void clearCache();
+
+		auto findPath(const PathQuery& query) -> PathResult;
+
+		/// @brief Solves the queries in chunks on the thread pool, wait for all returned futures before reading results
+		auto submitPaths(std::span<const PathQuery> queries, std::span<PathResult> results) -> std::vector<std::future<void>>;
+
+		/// @brief Solves the queries on the thread pool and waits for all of them
+		void findPaths(std::span<const PathQuery> queries, std::span<PathResult> results);
+
+	private:
+		using CellPath = std::vector<uint32_t>;
+
+		auto findCorridor(uint32_t startCluster, uint32_t goalCluster, std::vector<uint8_t>& corridor) const -> bool;
+		auto findCells(uint32_t start, uint32_t goal, const std::vector<uint8_t>* corridor, CellPath& path) const -> bool;
+		auto toWaypoints(const CellPath& cells) const -> std::vector<glm::vec3>;
+
+		auto cacheLookup(uint64_t key, std::vector<glm::vec3>& path) -> bool;
+		void cacheStore(uint64_t key, const std::vector<glm::vec3>& path);
+
+		const NavigationGrid& m_grid;
+		bool m_hierarchical{ true };
+
+		std::mutex m_cacheMutex;
+		std::unordered_map<uint64_t, std::vector<glm::vec3>> m_cache;
+		std::vector<uint64_t> m_cacheOrder; // Ring of keys, the oldest entry is replaced when full
+		size_t m_cacheCapacity;
+		size_t m_cacheNext{ 0 };
+		uint32_t m_cacheVersion{ 0 };
+		std::atomic<uint64_t> m_cacheHits{ 0 };
+		std::atomic<uint64_t> m_cacheMisses{ 0 };
+	};
+}
@@ -0,0 +1,104 @@
+#include "pch.h"
+#include "pathfinding_system.h"
+
+#include "core/profiler.h"
+#include "scene/scene.h"
+
+namespace Aegis::AI
+{
+	auto PathfindingSystem::Batch::isDone() const -> bool
+	{
+		return std::ranges::all_of(tasks, [](const std::future<void>& task)
+			{
+				return task.wait_for(std::chrono::seconds{ 0 }) == std::future_status::ready;
+			});
+	}
+
+	PathfindingSystem::PathfindingSystem(float cellSize)
+		: m_cellSize{ cellSize }
+	{
+	}
+
+	PathfindingSystem::~PathfindingSystem()
+	{
+		// Workers still reference the grid and the pending results
+		for (auto& batch : m_batches)
+		{
+			for (auto& task : batch->tasks)
+			{
+				task.wait();
+			}
+		}
+	}
+
+	void PathfindingSystem::request(const glm::vec3& start, const glm::vec3& goal, Callback callback)
+	{
+		m_pendingQueries.emplace_back(PathQuery{ start, goal });
+		m_pendingCallbacks.emplace_back(std::move(callback));
+	}
+
+	void PathfindingSystem::onUpdate(float deltaSeconds, Scene::Scene& scene)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		m_stats.completed = 0;
+
+		if (m_gridOutdated)
+		{
+			// The grid can't change while workers are searching it
+			deliverFinishedBatches(true);
+			m_grid.build(scene, m_cellSize);
+			m_gridOutdated = false;
+		}
+		else
+		{
+			deliverFinishedBatches(false);
+		}
+
+		m_stats.requested = static_cast<uint32_t>(m_pendingQueries.size());
+		if (!m_pendingQueries.empty())
+		{
+			auto batch = std::make_unique<Batch>();
+			batch->queries = std::move(m_pendingQueries);
+			batch->callbacks = std::move(m_pendingCallbacks);
+			batch->results.resize(batch->queries.size());
+			batch->tasks = m_pathfinder.submitPaths(batch->queries, batch->results);
+			m_batches.emplace_back(std::move(batch));
+
+			m_pendingQueries.clear();
+			m_pendingCallbacks.clear();
+		}
+
+		m_stats.inFlight = 0;
+		for (const auto& batch : m_batches)
+		{
+			m_stats.inFlight += static_cast<uint32_t>(batch->queries.size());
+		}
+	}
+
+	void PathfindingSystem::deliverFinishedBatches(bool wait)
+	{
+		// Batches finish in any order, but callbacks are delivered in request order
+		auto firstPending = std::ranges::find_if(m_batches, [wait](const std::unique_ptr<Batch>& batch)
+			{
+				return !wait && !batch->isDone();
+			});
+
+		for (auto it = m_batches.begin(); it != firstPending; it++)
+		{
+			auto& batch = **it;
+			for (auto& task : batch.tasks)
+			{
+				task.get();
+			}
+
+			for (size_t i = 0; i < batch.callbacks.size(); i++)
+			{
+				if (batch.callbacks[i])
+					batch.callbacks[i](batch.results[i]);
+			}
+			m_stats.completed += static_cast<uint32_t>(batch.callbacks.size());
+		}
+		m_batches.erase(m_batches.begin(), firstPending);
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ai/pathfinding/navigation_grid.h"
+#include "ai/pathfinding/pathfinder.h"
+#include "scene/system.h"
+
+namespace Aegis::AI
+{
+	/// @brief Solves path requests of the scene asynchronously on the thread pool
+	/// @note Requests of a frame are solved as one batch, the callbacks are called on the main thread in the update after
+	///       the batch has finished. The navigation grid is built from the static scene geometry on the first update.
+	class PathfindingSystem : public Scene::System
+	{
+	public:
+		using Callback = std::function<void(const PathResult&)>;
+
+		struct Stats
+		{
+			uint32_t requested = 0; // Requests queued since the last update
+			uint32_t completed = 0; // Callbacks called this frame
+			uint32_t inFlight = 0;  // Requests solved on worker threads
+		};
+
+		explicit PathfindingSystem(float cellSize = NavigationGrid::DEFAULT_CELL_SIZE);
+		PathfindingSystem(const PathfindingSystem&) = delete;
+		PathfindingSystem(PathfindingSystem&&) = delete;
+		~PathfindingSystem();
+
+		auto operator=(const PathfindingSystem&) -> PathfindingSystem& = delete;
+		auto operator=(PathfindingSystem&&) -> PathfindingSystem& = delete;
+
+		[[nodiscard]] auto grid() const -> const NavigationGrid& { return m_grid; }
+		[[nodiscard]] auto pathfinder() -> Pathfinder& { return m_pathfinder; }
+		[[nodiscard]] auto stats() const -> const Stats& { return m_stats; }
+
+		/// @brief Queues a path request, the callback is called on the main thread once the path is solved
+		void request(const glm::vec3& start, const glm::vec3& goal, Callback callback);
+
+		/// @brief Rebuilds the navigation grid from the scene with the next update (e.g. after moving obstacles)
+		void invalidateGrid() { m_gridOutdated = true; }
+
+		void onUpdate(float deltaSeconds, Scene::Scene& scene) override;
+
+	private:
+		struct Batch
+		{
+			std::vector<PathQuery> queries;
+			std::vector<Callback> callbacks;
+			std::vector<PathResult> results;
+			std::vector<std::future<void>> tasks;
+
+			auto isDone() const -> bool;
+		};
+
+		void deliverFinishedBatches(bool wait);
+
+		NavigationGrid m_grid;
+		Pathfinder m_pathfinder{ m_grid };
+		float m_cellSize;
+		bool m_gridOutdated{ true };
+
+		std::vector<PathQuery> m_pendingQueries;
+		std::vector<Callback> m_pendingCallbacks;
+		std::vector<std::unique_ptr<Batch>> m_batches;
+		Stats m_stats;
+	};
+}
@@ -13,12 +13,14 @@ namespace Aegis::AI
 	public:
 		virtual TreeNode* next() const { return nullptr; }
 		virtual std::unique_ptr<Option> createOption() const { return nullptr; }
+		virtual const Consideration* consideration() const { return nullptr; }
 
 	protected:
 		std::unique_ptr<TreeNode> m_true;
 		std::unique_ptr<TreeNode> m_false;
 
 		friend class DecisionTree;
+		friend class FlatDecisionTree;
 	};
 
 	template <typename T>
@@ -33,6 +35,11 @@ namespace Aegis::AI
 			return m_decision->evaluate() ? m_true.get() : m_false.get();
 		}
 
+		virtual const Consideration* consideration() const override
+		{
+			return m_decision.get();
+		}
+
 	private:
 		std::unique_ptr<T> m_decision;
 	};
@@ -76,6 +83,8 @@ namespace Aegis::AI
 			return addNode<T>(node->m_false, std::forward<Args>(args)...);
 		}
 
+		const TreeNode* root() const { return m_root.get(); }
+
 		std::unique_ptr<Option> evaluate() const 
 		{
 			auto node = m_root.get();
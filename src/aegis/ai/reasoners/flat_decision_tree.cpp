@@ -0,0 +1,113 @@
+#include "pch.h"
+#include "flat_decision_tree.h"
+
+#include "scene/components.h"
+
+namespace Aegis::AI
+{
+	FlatDecisionTree::FlatDecisionTree(const DecisionTree& tree)
+	{
+		compileNode(tree.root());
+	}
+
+	uint32_t FlatDecisionTree::evaluate(const Blackboard& blackboard) const
+	{
+		if (m_nodes.empty())
+			return INVALID_INDEX;
+
+		uint32_t index = 0;
+		while (!m_nodes[index].isLeaf())
+		{
+			const auto& node = m_nodes[index];
+
+			// Custom considerations can only read the blackboard they were created with
+			if (node.consideration.type == FlatConsideration::Type::Custom && &node.consideration.custom->blackboard() != &blackboard)
+				return INVALID_INDEX;
+
+			index = evaluateConsideration(node.consideration, blackboard) ? node.trueIndex : node.falseIndex;
+
+			if (index == INVALID_INDEX)
+				return INVALID_INDEX;
+		}
+
+		return m_nodes[index].option;
+	}
+
+	void FlatDecisionTree::evaluate(std::span<const Blackboard* const> blackboards, std::span<uint32_t> options) const
+	{
+		AGX_ASSERT_X(blackboards.size() == options.size(), "Each blackboard needs an option slot");
+
+		for (size_t i = 0; i < blackboards.size(); i++)
+		{
+			options[i] = evaluate(*blackboards[i]);
+		}
+	}
+
+	std::unique_ptr<Option> FlatDecisionTree::createOption(uint32_t option) const
+	{
+		if (option >= m_options.size())
+			return nullptr;
+
+		return m_options[option]->createOption();
+	}
+
+	uint32_t FlatDecisionTree::compileNode(const TreeNode* node)
+	{
+		if (!node)
+			return INVALID_INDEX;
+
+		// Pre-order, so the true branch mostly follows its parent in memory
+		uint32_t index = static_cast<uint32_t>(m_nodes.size());
+		m_nodes.emplace_back();
+
+		if (auto consideration = node->consideration())
+		{
+			m_nodes[index].consideration = consideration->flatten();
+
+			uint32_t trueIndex = compileNode(node->m_true.get());
+			uint32_t falseIndex = compileNode(node->m_false.get());
+			m_nodes[index].trueIndex = trueIndex;
+			m_nodes[index].falseIndex = falseIndex;
+		}
+		else
+		{
+			m_nodes[index].option = static_cast<uint32_t>(m_options.size());
+			m_options.emplace_back(node);
+		}
+
+		return index;
+	}
+
+	bool FlatDecisionTree::evaluateConsideration(const FlatConsideration& consideration, const Blackboard& blackboard) const
+	{
+		switch (consideration.type)
+		{
+		case FlatConsideration::Type::Bool:
+		{
+			auto value = blackboard.slot<BoolKnowledge>(consideration.keyA);
+			return value && value->value;
+		}
+		case FlatConsideration::Type::Threshold:
+		{
+			auto value = blackboard.slot<FloatKnowledge>(consideration.keyA);
+			return value && value->value >= consideration.value;
+		}
+		case FlatConsideration::Type::EntityDistance:
+		{
+			auto entityA = blackboard.slot<EntityKnowledge>(consideration.keyA);
+			auto entityB = blackboard.slot<EntityKnowledge>(consideration.keyB);
+			if (!entityA || !entityB)
+				return false;
+
+			auto& positionA = entityA->entity.get<Transform>().location;
+			auto& positionB = entityB->entity.get<Transform>().location;
+			return glm::distance(positionA, positionB) < consideration.value;
+		}
+		case FlatConsideration::Type::Custom:
+			// Only reached for the blackboard it was created with (see evaluate)
+			return consideration.custom->evaluate();
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "ai/reasoners/decision_tree.h"
+
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Aegis::AI
+{
+	///@brief Decision tree compiled into a contiguous node array
+	///@note Children are indices instead of pointers and considerations are evaluated by type tag instead of a virtual
+	///      call. Blackboard keys are interned globally, so one compiled tree can evaluate the blackboards of many agents.
+	///      The options are still created by the factories of the source tree, which has to outlive the compiled tree.
+	///      Knowledge that is missing in a blackboard evaluates to false.
+	class FlatDecisionTree
+	{
+	public:
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+		struct Node
+		{
+			FlatConsideration consideration;
+			uint32_t trueIndex = INVALID_INDEX;
+			uint32_t falseIndex = INVALID_INDEX;
+			uint32_t option = INVALID_INDEX; // Only set for leaves
+
+			bool isLeaf() const { return option != INVALID_INDEX; }
+		};
+
+		FlatDecisionTree() = default;
+		explicit FlatDecisionTree(const DecisionTree& tree);
+
+		size_t nodeCount() const { return m_nodes.size(); }
+		size_t optionCount() const { return m_options.size(); }
+
+		///@brief Returns the index of the chosen option or INVALID_INDEX if the path ends without an option
+		///@note Custom considerations are bound to the blackboard they were created with, a path through one of them
+		///      ends without an option for any other blackboard
+		uint32_t evaluate(const Blackboard& blackboard) const;
+
+		///@brief Evaluates the tree for the blackboard of each agent and writes the chosen option index per agent
+		void evaluate(std::span<const Blackboard* const> blackboards, std::span<uint32_t> options) const;
+
+		///@brief Creates the option of the given index (as returned by evaluate)
+		std::unique_ptr<Option> createOption(uint32_t option) const;
+
+	private:
+		uint32_t compileNode(const TreeNode* node);
+		bool evaluateConsideration(const FlatConsideration& consideration, const Blackboard& blackboard) const;
+
+		std::vector<Node> m_nodes;
+		std::vector<const TreeNode*> m_options;
+	};
+}
@@ -0,0 +1,93 @@
+#include "pch.h"
+#include "ai_scheduler.h"
+
+#include "core/profiler.h"
+#include "scene/components.h"
+#include "scene/scene.h"
+#include "utils/timer.h"
+
+namespace Aegis::AI
+{
+	AIScheduler::AIScheduler()
+	{
+		setLODLevels({
+			{ .distance = 25.0f, .interval = 1 },
+			{ .distance = 50.0f, .interval = 4 },
+			{ .distance = 100.0f, .interval = 16 },
+		});
+	}
+
+	void AIScheduler::setLODLevels(std::vector<LODLevel> levels)
+	{
+		AGX_ASSERT_X(!levels.empty(), "AI scheduler needs at least one LOD level");
+
+		std::ranges::sort(levels, {}, &LODLevel::distance);
+		for (auto& level : levels)
+		{
+			level.interval = std::max(level.interval, 1u);
+		}
+		m_lodLevels = std::move(levels);
+	}
+
+	void AIScheduler::onUpdate(float deltaSeconds, Scene::Scene& scene)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		m_stats = {};
+
+		glm::vec3 cameraLocation{ 0.0f };
+		if (auto camera = scene.mainCamera())
+			cameraLocation = camera.get<GlobalTransform>().location;
+
+		auto view = scene.registry().view<GlobalTransform, ScheduledAgent>();
+
+		m_dueAgents.clear();
+		for (auto&& [entity, transform, agent] : view.each())
+		{
+			agent.scheduled = true;
+			agent.pendingSeconds += deltaSeconds;
+			agent.framesSinceUpdate++;
+
+			float distance = glm::distance(transform.location, cameraLocation) / std::max(agent.importance, 0.001f);
+			uint32_t interval = updateInterval(distance);
+			if (agent.framesSinceUpdate < interval)
+			{
+				m_stats.skipped++;
+				continue;
+			}
+
+			m_dueAgents.emplace_back(DueAgent{ entity, static_cast<float>(agent.framesSinceUpdate) / static_cast<float>(interval) });
+		}
+
+		// Most overdue first, so agents deferred by the budget are the first to update next frame
+		std::ranges::sort(m_dueAgents, std::greater{}, &DueAgent::urgency);
+
+		Timer timer;
+		for (size_t i = 0; i < m_dueAgents.size(); i++)
+		{
+			if (i > 0 && timer.elapsedMillis() > m_budgetMillis)
+			{
+				m_stats.deferred = static_cast<uint32_t>(m_dueAgents.size() - i);
+				break;
+			}
+
+			auto& agent = view.get<ScheduledAgent>(m_dueAgents[i].entity);
+			if (agent.think)
+				agent.think(agent.pendingSeconds);
+
+			agent.pendingSeconds = 0.0f;
+			agent.framesSinceUpdate = 0;
+			m_stats.ticked++;
+		}
+	}
+
+	auto AIScheduler::updateInterval(float distance) const -> uint32_t
+	{
+		for (const auto& level : m_lodLevels)
+		{
+			if (distance < level.distance)
+				return level.interval;
+		}
+		return m_lodLevels.back().interval;
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ai/scheduler/scheduled_agent.h"
+#include "scene/system.h"
+
+#include <entt/entt.hpp>
+
+namespace Aegis::AI
+{
+	/// @brief Distributes the reasoning updates of all ScheduledAgents across frames
+	/// @note Agents further away from the main camera update less often (LOD). Agents that are due are updated most
+	///       overdue first until the frame budget is used up, the rest is deferred to the next frame.
+	class AIScheduler : public Scene::System
+	{
+	public:
+		/// @brief Agents closer than 'distance' to the camera update every 'interval' frames
+		struct LODLevel
+		{
+			float distance;
+			uint32_t interval;
+		};
+
+		struct Stats
+		{
+			uint32_t ticked = 0;
+			uint32_t skipped = 0;  // Not due yet because of the LOD
+			uint32_t deferred = 0; // Due but over the frame budget
+		};
+
+		static constexpr float DEFAULT_BUDGET_MILLIS = 2.0f;
+
+		AIScheduler();
+		~AIScheduler() = default;
+
+		[[nodiscard]] auto stats() const -> const Stats& { return m_stats; }
+		[[nodiscard]] auto budgetMillis() const -> float { return m_budgetMillis; }
+
+		/// @brief Sets the time per frame for reasoning updates (at least one agent is updated each frame)
+		void setBudgetMillis(float budgetMillis) { m_budgetMillis = budgetMillis; }
+
+		/// @brief Sets the LOD levels, the last level is used for all agents beyond its distance
+		void setLODLevels(std::vector<LODLevel> levels);
+
+		void onUpdate(float deltaSeconds, Scene::Scene& scene) override;
+
+	private:
+		struct DueAgent
+		{
+			entt::entity entity;
+			float urgency;
+		};
+
+		auto updateInterval(float distance) const -> uint32_t;
+
+		std::vector<LODLevel> m_lodLevels;
+		std::vector<DueAgent> m_dueAgents;
+		float m_budgetMillis{ DEFAULT_BUDGET_MILLIS };
+		Stats m_stats;
+	};
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <functional>
+
+namespace Aegis::AI
+{
+	/// @brief Marks an entity whose reasoning is updated by the AIScheduler instead of every frame
+	struct ScheduledAgent
+	{
+		/// @brief Reasoning update, called with the seconds accumulated since the last update
+		std::function<void(float)> think;
+
+		/// @brief Scales the distance to the camera for the LOD, agents with a higher importance update more often
+		float importance = 1.0f;
+
+		/// @brief State of the scheduler
+		float pendingSeconds = 0.0f;
+		uint32_t framesSinceUpdate = 0;
+		bool scheduled = false;
+	};
+}
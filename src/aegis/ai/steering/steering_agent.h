@@ -0,0 +1,51 @@
+#pragma once
+
+#include "math/math.h"
+
+namespace Aegis::AI
+{
+	/// @brief Marks an entity as agent of the batched SteeringSystem
+	/// @note Agents are simulated by the system itself and don't need MotionDynamics or an AIComponent
+	struct SteeringAgent
+	{
+		enum Behaviour : uint32_t
+		{
+			None = 0,
+			Seek = 1 << 0,
+			Flee = 1 << 1,
+			Arrive = 1 << 2,
+			Wander = 1 << 3,
+			Separation = 1 << 4,
+			Cohesion = 1 << 5,
+			VelocityMatching = 1 << 6,
+			Flocking = Separation | Cohesion | VelocityMatching,
+		};
+
+		/// @brief Weight of each behaviour in the blended force (only used if enabled in 'behaviours')
+		struct Weights
+		{
+			float seek = 1.0f;
+			float flee = 1.0f;
+			float arrive = 1.0f;
+			float wander = 1.0f;
+			float separation = 1.0f;
+			float cohesion = 1.0f;
+			float velocityMatching = 1.0f;
+		};
+
+		uint32_t behaviours = None;
+		Weights weights;
+
+		/// @brief Location used by seek, flee and arrive
+		glm::vec3 target{ 0.0f };
+
+		float mass = 1.0f;
+		float friction = 1.0f;
+		float maxForce = 10.0f;
+		float maxSpeed = 5.0f;
+
+		/// @brief Current state, written by the system each tick
+		glm::vec3 velocity{ 0.0f };
+		float wanderAngle = 0.0f;
+	};
+}
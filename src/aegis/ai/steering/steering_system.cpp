@@ -0,0 +1,293 @@
+#include "pch.h"
+#include "steering_system.h"
+
+#include "core/profiler.h"
+#include "core/thread_pool.h"
+#include "scene/components.h"
+#include "scene/scene.h"
+
+#include <cmath>
+#include <future>
+
+namespace Aegis::AI
+{
+	namespace
+	{
+		/// @brief Stateless random value in [-1, 1] per agent and tick (the thread pool can't share a generator)
+		auto signedNoise(uint32_t agent, uint64_t tick) -> float
+		{
+			uint32_t h = agent * 0x9E3779B1u ^ static_cast<uint32_t>(tick) * 0x85EBCA77u;
+			h ^= h >> 16;
+			h *= 0x7FEB352Du;
+			h ^= h >> 15;
+			h *= 0x846CA68Bu;
+			h ^= h >> 16;
+			return static_cast<float>(h) * (2.0f / 4294967295.0f) - 1.0f;
+		}
+
+		auto weightIf(uint32_t behaviours, SteeringAgent::Behaviour behaviour, float weight) -> float
+		{
+			return (behaviours & behaviour) ? weight : 0.0f;
+		}
+	}
+
+	void SteeringSystem::Agents::resize(size_t count)
+	{
+		entities.resize(count);
+		for (auto* array : { &x, &y, &z, &velocityX, &velocityY, &velocityZ, &forceX, &forceY, &forceZ,
+			&targetX, &targetY, &targetZ, &seekWeight, &fleeWeight, &arriveWeight, &wanderWeight,
+			&separationWeight, &cohesionWeight, &velocityMatchingWeight, &mass, &friction, &maxForce, &maxSpeed, &wanderAngle })
+		{
+			array->resize(count);
+		}
+	}
+
+	void SteeringSystem::onBegin(Scene::Scene& scene)
+	{
+		auto& registry = scene.registry();
+		auto view = registry.view<Transform, SteeringAgent>(entt::exclude<InterpolatedTransform>);
+		std::vector<entt::entity> added{ view.begin(), view.end() };
+		for (auto entity : added)
+		{
+			const auto& transform = registry.get<Transform>(entity);
+			registry.emplace<InterpolatedTransform>(entity, transform, transform);
+		}
+	}
+
+	void SteeringSystem::onFixedUpdate(float fixedDeltaSeconds, Scene::Scene& scene)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		// Agents created after the scene began need the interpolated transform as well
+		onBegin(scene);
+
+		gather(scene.registry());
+
+		const uint32_t count = agentCount();
+		if (count == 0)
+			return;
+
+		m_grid.clear();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			// The grid stores agent indices instead of entities to avoid registry lookups for neighbours
+			m_grid.insert(static_cast<entt::entity>(i), glm::vec3{ m_agents.x[i], m_agents.y[i], m_agents.z[i] });
+		}
+		m_grid.build();
+
+		if (m_parallel && count > CHUNK_SIZE)
+		{
+			std::vector<std::future<void>> tasks;
+			tasks.reserve((count + CHUNK_SIZE - 1) / CHUNK_SIZE);
+			for (uint32_t first = 0; first < count; first += CHUNK_SIZE)
+			{
+				uint32_t last = std::min(first + CHUNK_SIZE, count);
+				tasks.emplace_back(Core::ThreadPool::instance().submit([this, first, last, fixedDeltaSeconds]() {
+					computeForces(first, last, fixedDeltaSeconds);
+					}));
+			}
+			for (auto& task : tasks)
+			{
+				task.get();
+			}
+		}
+		else
+		{
+			computeForces(0, count, fixedDeltaSeconds);
+		}
+
+		integrate(fixedDeltaSeconds);
+		scatter(scene.registry());
+		m_tickCount++;
+	}
+
+	void SteeringSystem::gather(entt::registry& registry)
+	{
+		auto view = registry.view<Transform, SteeringAgent>();
+		m_agents.resize(view.size_hint());
+
+		uint32_t i = 0;
+		for (auto&& [entity, transform, agent] : view.each())
+		{
+			m_agents.entities[i] = entity;
+			m_agents.x[i] = transform.location.x;
+			m_agents.y[i] = transform.location.y;
+			m_agents.z[i] = transform.location.z;
+			m_agents.velocityX[i] = agent.velocity.x;
+			m_agents.velocityY[i] = agent.velocity.y;
+			m_agents.velocityZ[i] = agent.velocity.z;
+			m_agents.targetX[i] = agent.target.x;
+			m_agents.targetY[i] = agent.target.y;
+			m_agents.targetZ[i] = agent.target.z;
+
+			m_agents.seekWeight[i] = weightIf(agent.behaviours, SteeringAgent::Seek, agent.weights.seek);
+			m_agents.fleeWeight[i] = weightIf(agent.behaviours, SteeringAgent::Flee, agent.weights.flee);
+			m_agents.arriveWeight[i] = weightIf(agent.behaviours, SteeringAgent::Arrive, agent.weights.arrive);
+			m_agents.wanderWeight[i] = weightIf(agent.behaviours, SteeringAgent::Wander, agent.weights.wander);
+			m_agents.separationWeight[i] = weightIf(agent.behaviours, SteeringAgent::Separation, agent.weights.separation);
+			m_agents.cohesionWeight[i] = weightIf(agent.behaviours, SteeringAgent::Cohesion, agent.weights.cohesion);
+			m_agents.velocityMatchingWeight[i] = weightIf(agent.behaviours, SteeringAgent::VelocityMatching, agent.weights.velocityMatching);
+
+			m_agents.mass[i] = agent.mass;
+			m_agents.friction[i] = agent.friction;
+			m_agents.maxForce[i] = agent.maxForce;
+			m_agents.maxSpeed[i] = agent.maxSpeed;
+			m_agents.wanderAngle[i] = agent.wanderAngle;
+			i++;
+		}
+
+		// The size hint of a multi component view is an upper bound
+		m_agents.resize(i);
+	}
+
+	void SteeringSystem::computeForces(uint32_t first, uint32_t last, float fixedDeltaSeconds)
+	{
+		for (uint32_t i = first; i < last; i++)
+		{
+			m_agents.forceX[i] = 0.0f;
+			m_agents.forceY[i] = 0.0f;
+			m_agents.forceZ[i] = 0.0f;
+		}
+
+		computeTargetForces(first, last, fixedDeltaSeconds);
+		computeWanderForces(first, last);
+		computeFlockingForces(first, last);
+	}
+
+	void SteeringSystem::computeTargetForces(uint32_t first, uint32_t last, float fixedDeltaSeconds)
+	{
+		auto& a = m_agents;
+		for (uint32_t i = first; i < last; i++)
+		{
+			const float dx = a.targetX[i] - a.x[i];
+			const float dy = a.targetY[i] - a.y[i];
+			const float dz = a.targetZ[i] - a.z[i];
+			const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+			const float inverseDistance = distance > 0.0f ? 1.0f / distance : 0.0f;
+
+			// Seek pulls and flee pushes with the full force
+			const float pull = (a.seekWeight[i] - a.fleeWeight[i]) * a.maxForce[i] * inverseDistance;
+
+			// Arrive slows down within the brake distance, the steering force reaches the desired velocity if possible
+			const float brakeDistance = a.maxSpeed[i] * a.maxSpeed[i] * a.mass[i] / (2.0f * a.maxForce[i]);
+			const float desiredSpeed = a.maxSpeed[i] * std::min(distance / brakeDistance, 1.0f);
+			const float desiredX = dx * inverseDistance * desiredSpeed - a.velocityX[i];
+			const float desiredY = dy * inverseDistance * desiredSpeed - a.velocityY[i];
+			const float desiredZ = dz * inverseDistance * desiredSpeed - a.velocityZ[i];
+			const float desiredLength = std::sqrt(desiredX * desiredX + desiredY * desiredY + desiredZ * desiredZ);
+			const float arriveForce = std::min(desiredLength * a.mass[i] / fixedDeltaSeconds, a.maxForce[i]);
+			const float arrive = desiredLength > 0.0f ? a.arriveWeight[i] * arriveForce / desiredLength : 0.0f;
+
+			a.forceX[i] += dx * pull + desiredX * arrive;
+			a.forceY[i] += dy * pull + desiredY * arrive;
+			a.forceZ[i] += dz * pull + desiredZ * arrive;
+		}
+	}
+
+	void SteeringSystem::computeWanderForces(uint32_t first, uint32_t last)
+	{
+		// Wanders in the ground plane (Z is up)
+		auto& a = m_agents;
+		for (uint32_t i = first; i < last; i++)
+		{
+			a.wanderAngle[i] += WANDER_JITTER * signedNoise(static_cast<uint32_t>(a.entities[i]), m_tickCount);
+
+			const float strength = a.wanderWeight[i] * a.maxForce[i];
+			a.forceX[i] += std::cos(a.wanderAngle[i]) * strength;
+			a.forceY[i] += std::sin(a.wanderAngle[i]) * strength;
+		}
+	}
+
+	void SteeringSystem::computeFlockingForces(uint32_t first, uint32_t last)
+	{
+		auto& a = m_agents;
+		for (uint32_t i = first; i < last; i++)
+		{
+			if (a.separationWeight[i] == 0.0f && a.cohesionWeight[i] == 0.0f && a.velocityMatchingWeight[i] == 0.0f)
+				continue;
+
+			const glm::vec3 location{ a.x[i], a.y[i], a.z[i] };
+			glm::vec3 separation{ 0.0f };
+			glm::vec3 centerOfMass{ 0.0f };
+			glm::vec3 velocity{ 0.0f };
+			uint32_t cohesionCount = 0;
+			uint32_t velocityCount = 0;
+
+			m_grid.forEachInRadius(location, COHESION_RADIUS, [&](entt::entity neighbour, const glm::vec3& otherLocation)
+				{
+					const uint32_t other = static_cast<uint32_t>(neighbour);
+					if (other == i)
+						return;
+
+					const glm::vec3 direction = otherLocation - location;
+					const float distance = glm::length(direction);
+					if (distance > 0.0f && distance < SEPARATION_RADIUS)
+						separation -= direction / distance * ((SEPARATION_RADIUS - distance) / SEPARATION_RADIUS);
+
+					if (distance < COHESION_RADIUS)
+					{
+						centerOfMass += otherLocation;
+						cohesionCount++;
+					}
+
+					if (distance < VELOCITY_MATCHING_RADIUS)
+					{
+						velocity += glm::vec3{ a.velocityX[other], a.velocityY[other], a.velocityZ[other] };
+						velocityCount++;
+					}
+				});
+
+			// Each behaviour is normalized to about [0, 1] and scaled by the max force, so the weights compare directly
+			glm::vec3 force = separation * a.separationWeight[i];
+			if (cohesionCount > 0)
+				force += (centerOfMass / static_cast<float>(cohesionCount) - location) / COHESION_RADIUS * a.cohesionWeight[i];
+			if (velocityCount > 0)
+				force += velocity / (static_cast<float>(velocityCount) * a.maxSpeed[i]) * a.velocityMatchingWeight[i];
+			force *= a.maxForce[i];
+
+			a.forceX[i] += force.x;
+			a.forceY[i] += force.y;
+			a.forceZ[i] += force.z;
+		}
+	}
+
+	void SteeringSystem::integrate(float fixedDeltaSeconds)
+	{
+		auto& a = m_agents;
+		const uint32_t count = agentCount();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const float inverseMass = fixedDeltaSeconds / a.mass[i];
+			float vx = a.velocityX[i] + (a.forceX[i] - a.velocityX[i] * a.friction[i]) * inverseMass;
+			float vy = a.velocityY[i] + (a.forceY[i] - a.velocityY[i] * a.friction[i]) * inverseMass;
+			float vz = a.velocityZ[i] + (a.forceZ[i] - a.velocityZ[i] * a.friction[i]) * inverseMass;
+
+			const float speed = std::sqrt(vx * vx + vy * vy + vz * vz);
+			const float limit = speed > a.maxSpeed[i] ? a.maxSpeed[i] / speed : 1.0f;
+			vx *= limit;
+			vy *= limit;
+			vz *= limit;
+
+			a.velocityX[i] = vx;
+			a.velocityY[i] = vy;
+			a.velocityZ[i] = vz;
+			a.x[i] += vx * fixedDeltaSeconds;
+			a.y[i] += vy * fixedDeltaSeconds;
+			a.z[i] += vz * fixedDeltaSeconds;
+		}
+	}
+
+	void SteeringSystem::scatter(entt::registry& registry)
+	{
+		const uint32_t count = agentCount();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			auto& transform = registry.get<Transform>(m_agents.entities[i]);
+			transform.location = glm::vec3{ m_agents.x[i], m_agents.y[i], m_agents.z[i] };
+
+			auto& agent = registry.get<SteeringAgent>(m_agents.entities[i]);
+			agent.velocity = glm::vec3{ m_agents.velocityX[i], m_agents.velocityY[i], m_agents.velocityZ[i] };
+			agent.wanderAngle = m_agents.wanderAngle[i];
+		}
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ai/steering/steering_agent.h"
+#include "scene/spatial_hash_grid.h"
+#include "scene/system.h"
+
+#include <entt/entt.hpp>
+
+namespace Aegis::AI
+{
+	/// @brief Evaluates the steering behaviours of all SteeringAgents in batches each simulation tick
+	/// @note The agents are copied into SoA arrays, each behaviour is a branch free loop over all of them and
+	///       large crowds are split into chunks for the thread pool. This is the data oriented counterpart of the
+	///       SteeringBehaviour options, which stay the high level API for individual agents.
+	class SteeringSystem : public Scene::System
+	{
+	public:
+		static constexpr float SEPARATION_RADIUS = 5.0f;
+		static constexpr float COHESION_RADIUS = 7.0f;
+		static constexpr float VELOCITY_MATCHING_RADIUS = 1.0f;
+		static constexpr float WANDER_JITTER = glm::pi<float>() / 18.0f; // 10 degrees per tick
+		static constexpr uint32_t CHUNK_SIZE = 4096;
+
+		SteeringSystem() = default;
+		~SteeringSystem() = default;
+
+		[[nodiscard]] auto agentCount() const -> uint32_t { return static_cast<uint32_t>(m_agents.entities.size()); }
+
+		/// @brief Splits the force computation of large crowds into chunks for the thread pool
+		void setParallel(bool parallel) { m_parallel = parallel; }
+
+		void onBegin(Scene::Scene& scene) override;
+		void onFixedUpdate(float fixedDeltaSeconds, Scene::Scene& scene) override;
+
+	private:
+		struct Agents
+		{
+			std::vector<entt::entity> entities;
+
+			std::vector<float> x, y, z;
+			std::vector<float> velocityX, velocityY, velocityZ;
+			std::vector<float> forceX, forceY, forceZ;
+			std::vector<float> targetX, targetY, targetZ;
+
+			// Disabled behaviours have a weight of zero, so no loop has to branch on them
+			std::vector<float> seekWeight, fleeWeight, arriveWeight, wanderWeight;
+			std::vector<float> separationWeight, cohesionWeight, velocityMatchingWeight;
+
+			std::vector<float> mass, friction, maxForce, maxSpeed;
+			std::vector<float> wanderAngle;
+
+			void resize(size_t count);
+		};
+
+		void gather(entt::registry& registry);
+		void computeForces(uint32_t first, uint32_t last, float fixedDeltaSeconds);
+		void computeTargetForces(uint32_t first, uint32_t last, float fixedDeltaSeconds);
+		void computeWanderForces(uint32_t first, uint32_t last);
+		void computeFlockingForces(uint32_t first, uint32_t last);
+		void integrate(float fixedDeltaSeconds);
+		void scatter(entt::registry& registry);
+
+		Agents m_agents;
+		Scene::SpatialHashGrid m_grid{ COHESION_RADIUS };
+		uint64_t m_tickCount{ 0 };
+		bool m_parallel{ true };
+	};
+}
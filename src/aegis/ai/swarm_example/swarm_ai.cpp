@@ -13,6 +13,8 @@ SwarmAIComponent::SwarmAIComponent(Aegis::AI::Blackboard& blackboard) : Aegis::A
 
 void SwarmAIComponent::begin()
 {
+	Aegis::AI::AIComponent::begin();
+
 	m_food = m_blackboard.get<Aegis::AI::EntityGroupKnowledge>("food");
 	m_swarm = m_blackboard.get<Aegis::AI::EntityGroupKnowledge>("swarm");
 
@@ -3,6 +3,7 @@
 #include "scene/scene.h"
 #include "scene/components.h"
 #include "physics/motion_dynamics.h"
+#include "ai/scheduler/ai_scheduler.h"
 #include "ai/swarm_example/swarm_ai.h"
 #include "scripting/movement/world_border.h"
 #include "utils/random.h"
@@ -14,6 +15,8 @@ public:
 
 	void initialize() override
 	{
+		addSystem<Aegis::AI::AIScheduler>();
+
 		{
 			const float worldSize = 50.0f;
 
@@ -29,6 +29,8 @@ namespace Aegis::AI
 
     void TestAIComponent::begin()
     {
+        AIComponent::begin();
+
         m_player = m_blackboard.get<EntityKnowledge>("Player");
         m_npcs = m_blackboard.get<EntityGroupKnowledge>("NPCs");
 
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace Aegis::AI
+{
+	/// @brief Maps an input value to a utility score in [0, 1]
+	/// @note The input is normalized from [min, max] to [0, 1] and then shaped by the curve (see math/interpolation.h)
+	struct ResponseCurve
+	{
+		enum class Type : uint8_t
+		{
+			Linear,
+			Sigmoid,
+			FastSigmoid,
+			Tanh,
+		};
+
+		Type type = Type::Linear;
+		float min = 0.0f;
+		float max = 1.0f;
+		bool inverted = false;
+	};
+}
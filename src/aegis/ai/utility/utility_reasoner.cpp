@@ -0,0 +1,125 @@
+#include "pch.h"
+#include "utility_reasoner.h"
+
+#include "core/profiler.h"
+#include "math/interpolation.h"
+
+namespace Aegis::AI
+{
+	auto UtilityReasoner::addInput() -> uint32_t
+	{
+		m_inputCount++;
+		m_inputs.resize(static_cast<size_t>(m_inputCount) * m_agentCount);
+		return m_inputCount - 1;
+	}
+
+	auto UtilityReasoner::addOption(float weight) -> uint32_t
+	{
+		m_options.emplace_back(Option{ .weight = weight });
+		m_scores.resize(m_options.size() * m_agentCount);
+		return static_cast<uint32_t>(m_options.size() - 1);
+	}
+
+	void UtilityReasoner::addConsideration(uint32_t option, uint32_t input, const ResponseCurve& curve)
+	{
+		AGX_ASSERT_X(option < m_options.size(), "Utility option index out of range");
+		AGX_ASSERT_X(input < m_inputCount, "Utility input index out of range");
+
+		m_options[option].considerations.emplace_back(Consideration{ input, curve });
+	}
+
+	void UtilityReasoner::setAgentCount(uint32_t agentCount)
+	{
+		m_agentCount = agentCount;
+		m_inputs.assign(static_cast<size_t>(m_inputCount) * agentCount, 0.0f);
+		m_scores.assign(m_options.size() * agentCount, 0.0f);
+		m_curveScores.resize(agentCount);
+		m_bestScores.resize(agentCount);
+		m_choices.assign(agentCount, INVALID_INDEX);
+	}
+
+	auto UtilityReasoner::input(uint32_t input) -> std::span<float>
+	{
+		AGX_ASSERT_X(input < m_inputCount, "Utility input index out of range");
+		return std::span<float>{ m_inputs }.subspan(static_cast<size_t>(input) * m_agentCount, m_agentCount);
+	}
+
+	auto UtilityReasoner::scores(uint32_t option) const -> std::span<const float>
+	{
+		AGX_ASSERT_X(option < m_options.size(), "Utility option index out of range");
+		return std::span<const float>{ m_scores }.subspan(static_cast<size_t>(option) * m_agentCount, m_agentCount);
+	}
+
+	void UtilityReasoner::evaluate()
+	{
+		AGX_PROFILE_FUNCTION();
+
+		if (m_options.empty())
+			return;
+
+		// Score = weight * product of all consideration curves, one option at a time over all agents
+		for (size_t option = 0; option < m_options.size(); option++)
+		{
+			float* scores = m_scores.data() + option * m_agentCount;
+			std::fill_n(scores, m_agentCount, m_options[option].weight);
+
+			for (const auto& consideration : m_options[option].considerations)
+			{
+				applyCurve(consideration.curve, input(consideration.input), m_curveScores);
+
+				const float* curveScores = m_curveScores.data();
+				for (uint32_t i = 0; i < m_agentCount; i++)
+				{
+					scores[i] *= curveScores[i];
+				}
+			}
+		}
+
+		// Best option per agent, selects instead of branches so the loop stays vectorizable
+		std::copy_n(m_scores.data(), m_agentCount, m_bestScores.data());
+		std::fill(m_choices.begin(), m_choices.end(), 0u);
+		for (uint32_t option = 1; option < m_options.size(); option++)
+		{
+			const float* scores = m_scores.data() + static_cast<size_t>(option) * m_agentCount;
+			for (uint32_t i = 0; i < m_agentCount; i++)
+			{
+				bool better = scores[i] > m_bestScores[i];
+				m_bestScores[i] = better ? scores[i] : m_bestScores[i];
+				m_choices[i] = better ? option : m_choices[i];
+			}
+		}
+	}
+
+	void UtilityReasoner::applyCurve(const ResponseCurve& curve, std::span<const float> input, std::span<float> result)
+	{
+		const float range = curve.max - curve.min;
+		const float scale = std::abs(range) > std::numeric_limits<float>::epsilon() ? 1.0f / range : 0.0f;
+		for (size_t i = 0; i < input.size(); i++)
+		{
+			result[i] = std::clamp((input[i] - curve.min) * scale, 0.0f, 1.0f);
+		}
+
+		switch (curve.type)
+		{
+		case ResponseCurve::Type::Linear:
+			break;
+		case ResponseCurve::Type::Sigmoid:
+			Math::sigmoid01(result, result);
+			break;
+		case ResponseCurve::Type::FastSigmoid:
+			Math::fastSigmoid01(result, result);
+			break;
+		case ResponseCurve::Type::Tanh:
+			Math::tanh01(result, result);
+			break;
+		}
+
+		if (curve.inverted)
+		{
+			for (size_t i = 0; i < result.size(); i++)
+			{
+				result[i] = 1.0f - result[i];
+			}
+		}
+	}
+}
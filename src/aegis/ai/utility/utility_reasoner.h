@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ai/utility/response_curve.h"
+
+#include <span>
+
+namespace Aegis::AI
+{
+	/// @brief Utility AI that scores all options of many agents at once and chooses the best option per agent
+	/// @note Inputs and scores are stored per input/option as one contiguous array over all agents (SoA). Each
+	///       consideration is evaluated as a plain loop over all agents, so there is no per agent virtual call and the
+	///       compiler can vectorize the loops.
+	class UtilityReasoner
+	{
+	public:
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+		/// @brief Multiplies the score of an option by the curve of an input
+		struct Consideration
+		{
+			uint32_t input;
+			ResponseCurve curve;
+		};
+
+		struct Option
+		{
+			float weight = 1.0f;
+			std::vector<Consideration> considerations;
+		};
+
+		UtilityReasoner() = default;
+		~UtilityReasoner() = default;
+
+		[[nodiscard]] auto agentCount() const -> uint32_t { return m_agentCount; }
+		[[nodiscard]] auto inputCount() const -> uint32_t { return m_inputCount; }
+		[[nodiscard]] auto optionCount() const -> uint32_t { return static_cast<uint32_t>(m_options.size()); }
+
+		/// @brief Adds an input and returns its index (the values of all agents are set with input())
+		auto addInput() -> uint32_t;
+
+		/// @brief Adds an option and returns its index
+		auto addOption(float weight = 1.0f) -> uint32_t;
+
+		void addConsideration(uint32_t option, uint32_t input, const ResponseCurve& curve);
+
+		/// @brief Resizes the inputs and scores, the values of existing agents are not kept
+		void setAgentCount(uint32_t agentCount);
+
+		/// @brief Returns the values of the input for all agents to fill before evaluate()
+		[[nodiscard]] auto input(uint32_t input) -> std::span<float>;
+
+		/// @brief Returns the scores of the option for all agents of the last evaluate()
+		[[nodiscard]] auto scores(uint32_t option) const -> std::span<const float>;
+
+		/// @brief Returns the index of the best option per agent of the last evaluate()
+		[[nodiscard]] auto choices() const -> std::span<const uint32_t> { return m_choices; }
+
+		/// @brief Scores all options for all agents and chooses the best option per agent
+		void evaluate();
+
+	private:
+		void applyCurve(const ResponseCurve& curve, std::span<const float> input, std::span<float> result);
+
+		std::vector<Option> m_options;
+		uint32_t m_inputCount{ 0 };
+		uint32_t m_agentCount{ 0 };
+
+		std::vector<float> m_inputs;      // [input][agent]
+		std::vector<float> m_scores;      // [option][agent]
+		std::vector<float> m_curveScores; // [agent]
+		std::vector<float> m_bestScores;  // [agent]
+		std::vector<uint32_t> m_choices;  // [agent]
+	};
+}
@@ -23,7 +23,7 @@ namespace Aegis::Core
 		add("default/cubemap_black", Texture::solidColorCube(glm::vec4{ 0.0f }));
 		add("default/cubemap_white", Texture::solidColorCube(glm::vec4{ 1.0f }));
 
-		// Default PBR Material
+		// Default PBR Material (pipeline compiles in the background while the scene loads)
 		{
 			auto pipeline = []() {
 				Pipeline::GraphicsBuilder builder{};
@@ -42,14 +42,14 @@ namespace Aegis::Core
 						.addShaderStages(VK_SHADER_STAGE_MESH_BIT_EXT | VK_SHADER_STAGE_FRAGMENT_BIT,
 							SHADER_DIR "pbr/mesh_geometry_indirect.slang.spv")
 						.addFlag(Pipeline::Flags::MeshShader)
-						.build();
+						.buildAsync();
 				}
 				else
 				{
 					return builder
 						.addShaderStages(VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
 							SHADER_DIR "pbr/default_geometry_bindless.slang.spv")
-						.build();
+						.buildAsync();
 				}
 			}();
 
@@ -70,5 +70,40 @@ namespace Aegis::Core
 			defaultPBRMaterial->setParameter("albedo", glm::vec3{ 0.8f, 0.8f, 0.9f });
 			add("default/PBR_instance", defaultPBRMaterial);
 		}
+
+		// Default transparent PBR Material (forward shaded after lighting, only drawn by the GPU driven renderer)
+		if constexpr (Renderer::ENABLE_GPU_DRIVEN_RENDERING)
+		{
+			auto pipeline = Pipeline::GraphicsBuilder{}
+				.addDescriptorSetLayout(Engine::renderer().bindlessDescriptorSet().layout())
+				.addPushConstantRange(VK_SHADER_STAGE_ALL, 128)
+				.addColorAttachment(VK_FORMAT_R16G16B16A16_SFLOAT, true)
+				.setDepthAttachment(VK_FORMAT_D32_SFLOAT)
+				.setDepthTest(true, false)
+				.setCullMode(VK_CULL_MODE_NONE)
+				.addShaderStages(VK_SHADER_STAGE_TASK_BIT_EXT, SHADER_DIR "pbr/task_meshlet_cull.slang.spv")
+				.addShaderStages(VK_SHADER_STAGE_MESH_BIT_EXT, SHADER_DIR "pbr/mesh_geometry_indirect.slang.spv")
+				.addShaderStages(VK_SHADER_STAGE_FRAGMENT_BIT, SHADER_DIR "pbr/mesh_transparent_indirect.slang.spv")
+				.addFlag(Pipeline::Flags::MeshShader)
+				.buildAsync();
+
+			auto transparentTemplate = std::make_shared<MaterialTemplate>(std::move(pipeline));
+			transparentTemplate->setType(MaterialType::Transparent);
+			transparentTemplate->addParameter("albedo", glm::vec3{ 1.0f, 1.0f, 1.0f });
+			transparentTemplate->addParameter("emissive", glm::vec3{ 0.0f, 0.0f, 0.0f });
+			transparentTemplate->addParameter("metallic", 0.0f);
+			transparentTemplate->addParameter("roughness", 1.0f);
+			transparentTemplate->addParameter("ambientOcclusion", 1.0f);
+			transparentTemplate->addParameter("albedoMap", get<Texture>("default/texture_white"));
+			transparentTemplate->addParameter("normalMap", get<Texture>("default/texture_normal"));
+			transparentTemplate->addParameter("metalRoughnessMap", get<Texture>("default/texture_white"));
+			transparentTemplate->addParameter("ambientOcclusionMap", get<Texture>("default/texture_white"));
+			transparentTemplate->addParameter("emissiveMap", get<Texture>("default/texture_white"));
+			transparentTemplate->addParameter("opacity", 0.5f);
+			add("default/PBR_transparent_template", transparentTemplate);
+
+			auto transparentMaterial = Graphics::MaterialInstance::create(transparentTemplate);
+			add("default/PBR_transparent_instance", transparentMaterial);
+		}
 	}
 }
\ No newline at end of file
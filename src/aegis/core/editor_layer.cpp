@@ -42,6 +42,9 @@ namespace Aegis::Core
 		if (m_menuBarPanel.flagActive(UI::MenuBarPanel::Profiler))
 			m_profilerPanel.draw();
 
+		if (m_menuBarPanel.flagActive(UI::MenuBarPanel::Memory))
+			m_memoryPanel.draw();
+
 		if (m_menuBarPanel.flagActive(UI::MenuBarPanel::Demo))
 			m_demoPanel.draw();
 
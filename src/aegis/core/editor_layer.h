@@ -2,6 +2,7 @@
 
 #include "core/layer.h"
 #include "ui/panels/demo_panel.h"
+#include "ui/panels/memory_panel.h"
 #include "ui/panels/menu_bar_panel.h"
 #include "ui/panels/profiler_panel.h"
 #include "ui/panels/renderer_panel.h"
@@ -26,6 +27,7 @@ namespace Aegis::Core
 		UI::ScenePanel m_scenePanel{};
 		UI::StatisticsPanel m_statisticsPanel{};
 		UI::ProfilerPanel m_profilerPanel{};
+		UI::MemoryPanel m_memoryPanel{};
 		UI::DemoPanel m_demoPanel{};
 		int m_gizmoType = -1;
 		bool m_snapping = false;
@@ -0,0 +1,91 @@
+#include "pch.h"
+#include "frame_pacer.h"
+
+#include "core/profiler.h"
+
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <timeapi.h>
+#endif
+
+namespace Aegis::Core
+{
+	FramePacer::FramePacer()
+	{
+#ifdef _WIN32
+		// The default timer resolution of about 15.6 ms exceeds the frame time of high refresh rates
+		timeBeginPeriod(1);
+#endif
+	}
+
+	FramePacer::~FramePacer()
+	{
+#ifdef _WIN32
+		timeEndPeriod(1);
+#endif
+	}
+
+	void FramePacer::wait(std::chrono::steady_clock::time_point frameBegin)
+	{
+		using namespace std::chrono;
+
+		AGX_PROFILE_SCOPE("Wait for FPS limit");
+
+		if (!m_enabled || m_mode == Mode::Present)
+			return;
+
+		auto target = frameBegin + duration_cast<steady_clock::duration>(duration<double, std::milli>(targetFrameTime()));
+		auto waitBegin = steady_clock::now();
+		if (waitBegin >= target)
+			return;
+
+		if (m_mode == Mode::Hybrid)
+			sleepUntil(target);
+
+		auto spinBegin = steady_clock::now();
+		while (steady_clock::now() < target)
+		{
+			// Spin for the last part, sleep is not accurate enough for it (especially on Windows)
+		}
+		auto waitEnd = steady_clock::now();
+
+		m_sleepTime.add(duration<double, std::milli>(spinBegin - waitBegin).count());
+		m_spinTime.add(duration<double, std::milli>(waitEnd - spinBegin).count());
+		m_overshoot.add(duration<double, std::milli>(waitEnd - target).count());
+	}
+
+	void FramePacer::sleepUntil(std::chrono::steady_clock::time_point target)
+	{
+		using namespace std::chrono;
+
+		// Sleep in short slices so each one only overshoots by the scheduler granularity
+		while (true)
+		{
+			auto sliceBegin = steady_clock::now();
+			double remaining = duration<double, std::milli>(target - sliceBegin).count();
+			if (remaining <= m_spinThreshold)
+				break;
+
+			double slice = std::min(SLEEP_SLICE_MS, remaining - m_spinThreshold);
+			std::this_thread::sleep_for(duration<double, std::milli>(slice));
+
+			double slept = duration<double, std::milli>(steady_clock::now() - sliceBegin).count();
+			updateSleepEstimate(slept - slice);
+		}
+	}
+
+	void FramePacer::updateSleepEstimate(double overshootMs)
+	{
+		double delta = overshootMs - m_sleepMean;
+		m_sleepMean += SLEEP_ESTIMATE_WEIGHT * delta;
+		m_sleepVariance = (1.0 - SLEEP_ESTIMATE_WEIGHT) * (m_sleepVariance + SLEEP_ESTIMATE_WEIGHT * delta * delta);
+
+		// Stop sleeping early enough to absorb almost all overshoots, however large the timer granularity is
+		m_spinThreshold = std::max(m_sleepMean + 2.0 * std::sqrt(m_sleepVariance), MIN_SPIN_MS);
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "core/globals.h"
+#include "utils/rolling_average.h"
+
+namespace Aegis::Core
+{
+	/// @brief Limits the frame rate by waiting at the end of each frame
+	/// @note Hybrid pacing sleeps for the bulk of the wait and only spins for the last part. The spin part adapts
+	///       to the measured sleep overshoot, so the frame ends on time without burning a full core. On Windows the
+	///       pacer requests a 1 ms timer resolution while it exists, otherwise a sleep takes up to 15.6 ms.
+	class FramePacer
+	{
+	public:
+		enum class Mode : uint8_t
+		{
+			Hybrid = 0,   // Sleep and spin the remaining time
+			BusyWait = 1, // Spin for the whole wait (most precise, keeps a core at 100%)
+			Present = 2,  // Let the swap chain pace the frames by presenting with vsync (FIFO)
+		};
+
+		static constexpr int AVERAGE_FRAME_COUNT = 50;
+		static constexpr uint32_t MIN_TARGET_FPS = 10;
+		static constexpr uint32_t MAX_TARGET_FPS = 1000;
+		static constexpr double SLEEP_SLICE_MS = 1.0;
+		static constexpr double MIN_SPIN_MS = 0.05;
+		static constexpr double SLEEP_ESTIMATE_WEIGHT = 0.05;
+
+		FramePacer();
+		FramePacer(const FramePacer&) = delete;
+		FramePacer(FramePacer&&) = delete;
+		~FramePacer();
+
+		auto operator=(const FramePacer&) -> FramePacer& = delete;
+		auto operator=(FramePacer&&) -> FramePacer& = delete;
+
+		[[nodiscard]] auto isEnabled() const -> bool { return m_enabled; }
+		[[nodiscard]] auto mode() const -> Mode { return m_mode; }
+		[[nodiscard]] auto targetFPS() const -> uint32_t { return m_targetFPS; }
+		[[nodiscard]] auto targetFrameTime() const -> double { return 1000.0 / static_cast<double>(m_targetFPS); }
+
+		/// @brief Returns true if the swap chain should present with vsync
+		[[nodiscard]] auto usesPresentPacing() const -> bool { return m_enabled && m_mode == Mode::Present; }
+
+		/// @brief Average time in ms the wait ended after the target frame time
+		[[nodiscard]] auto overshoot() const -> double { return m_overshoot.average(); }
+		/// @brief Average time in ms spent sleeping and spinning per frame
+		[[nodiscard]] auto sleepTime() const -> double { return m_sleepTime.average(); }
+		[[nodiscard]] auto spinTime() const -> double { return m_spinTime.average(); }
+		/// @brief Remaining time in ms that is spun instead of slept (estimated sleep overshoot)
+		[[nodiscard]] auto spinThreshold() const -> double { return m_spinThreshold; }
+
+		void setEnabled(bool enabled) { m_enabled = enabled; }
+		void setMode(Mode mode) { m_mode = mode; }
+		void setTargetFPS(uint32_t fps) { m_targetFPS = std::clamp(fps, MIN_TARGET_FPS, MAX_TARGET_FPS); }
+
+		/// @brief Waits until the target frame time has passed since 'frameBegin'
+		void wait(std::chrono::steady_clock::time_point frameBegin);
+
+	private:
+		void sleepUntil(std::chrono::steady_clock::time_point target);
+		void updateSleepEstimate(double overshootMs);
+
+		bool m_enabled{ ENABLE_FPS_LIMIT };
+		Mode m_mode{ Mode::Hybrid };
+		uint32_t m_targetFPS{ TARGET_FPS };
+
+		// Exponentially weighted mean and variance of the overshoot of a single sleep in ms
+		double m_sleepMean{ SLEEP_SLICE_MS };
+		double m_sleepVariance{ 0.0 };
+		double m_spinThreshold{ SLEEP_SLICE_MS };
+
+		RollingAverage<AVERAGE_FRAME_COUNT> m_overshoot;
+		RollingAverage<AVERAGE_FRAME_COUNT> m_sleepTime;
+		RollingAverage<AVERAGE_FRAME_COUNT> m_spinTime;
+	};
+}
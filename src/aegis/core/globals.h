@@ -5,15 +5,16 @@
 #define ENGINE_DIR PROJECT_DIR "/"
 #define SHADER_DIR BUILD_DIR "/shaders/"
 #define ASSETS_DIR ENGINE_DIR "modules/aegis-assets/"
+#define CACHE_DIR BUILD_DIR "/cache/"
 
 namespace Aegis::Core
 {
 	constexpr uint32_t DEFAULT_WIDTH{ 1920 };
 	constexpr uint32_t DEFAULT_HEIGHT{ 1080 };
 
+	// Defaults of the frame pacer, both can be changed at runtime (see FramePacer)
 	constexpr bool ENABLE_FPS_LIMIT{ true };
 	constexpr uint32_t TARGET_FPS{ 144 };
-	constexpr double TARGET_FRAME_TIME{ 1000.0 / static_cast<double>(TARGET_FPS) };
 
 	constexpr uint32_t INVALID_HANDLE{ std::numeric_limits<uint32_t>::max() };
 }
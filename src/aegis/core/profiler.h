@@ -3,6 +3,8 @@
 #include "utils/rolling_average.h"
 #include "utils/timer.h"
 
+#include <mutex>
+
 #define AGX_PROFILE_SCOPE(name) Aegis::ScopeProfiler profiler##__LINE__(name)
 #define AGX_PROFILE_FUNCTION() AGX_PROFILE_SCOPE(__FUNCTION__)
 
@@ -10,6 +12,7 @@ namespace Aegis
 {
 	/// @brief Utility class for profiling code execution
 	/// @note Uses a rolling average over 'AVERAGE_FRAME_COUNT' frames
+	/// @note Thread safe, scopes of the main and the render thread are added concurrently
 	class Profiler
 	{
 	public:
@@ -31,19 +34,23 @@ namespace Aegis
 		/// @brief Retrieve the average time for a given name or 0.0 if not found
 		[[nodiscard]] auto time(const std::string& name) const -> double
 		{
+			std::lock_guard lock{ m_mutex };
 			auto it = m_times.find(name);
 			if (it == m_times.end())
 				return 0.0;
 			return it->second.average();
 		}
 
-		[[nodiscard]] auto times() const -> const std::unordered_map<std::string, RollingAverage<AVERAGE_FRAME_COUNT>>&
+		/// @brief Returns a copy of all times (the map may change while iterating otherwise)
+		[[nodiscard]] auto times() const -> std::unordered_map<std::string, RollingAverage<AVERAGE_FRAME_COUNT>>
 		{
+			std::lock_guard lock{ m_mutex };
 			return m_times;
 		}
 
 		void addTime(const std::string& name, double time)
 		{
+			std::lock_guard lock{ m_mutex };
 			m_times[name].add(time);
 		}
 
@@ -51,6 +58,7 @@ namespace Aegis
 		Profiler() = default;
 
 		std::unordered_map<std::string, RollingAverage<AVERAGE_FRAME_COUNT>> m_times;
+		mutable std::mutex m_mutex;
 	};
 
 
@@ -0,0 +1,55 @@
+#include "pch.h"
+#include "thread_pool.h"
+
+namespace Aegis::Core
+{
+	ThreadPool::ThreadPool(uint32_t threadCount)
+	{
+		AGX_ASSERT_X(threadCount > 0, "Thread pool requires at least one worker thread");
+
+		m_workers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			m_workers.emplace_back(&ThreadPool::workerLoop, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stop = true;
+		}
+		m_condition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			worker.join();
+		}
+	}
+
+	auto ThreadPool::instance() -> ThreadPool&
+	{
+		static ThreadPool instance{ std::max(std::thread::hardware_concurrency(), 2u) - 1 };
+		return instance;
+	}
+
+	void ThreadPool::workerLoop()
+	{
+		t_isWorker = true;
+		while (true)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock lock{ m_mutex };
+				m_condition.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+				if (m_stop && m_tasks.empty())
+					return;
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop();
+			}
+			task();
+		}
+	}
+}
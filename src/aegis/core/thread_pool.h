@@ -0,0 +1,59 @@
+#pragma once
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace Aegis::Core
+{
+	/// @brief Fixed number of worker threads executing submitted tasks in FIFO order
+	class ThreadPool
+	{
+	public:
+		explicit ThreadPool(uint32_t threadCount);
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		~ThreadPool();
+
+		auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+		auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+		/// @brief Returns the engine wide pool (one worker per hardware thread, minus the main thread)
+		[[nodiscard]] static auto instance() -> ThreadPool&;
+
+		[[nodiscard]] auto threadCount() const -> uint32_t { return static_cast<uint32_t>(m_workers.size()); }
+
+		/// @brief Returns true if called from a worker thread of any pool
+		/// @note Tasks must not wait on other tasks of the pool, once every worker waits nothing is left to run them
+		[[nodiscard]] static auto isWorkerThread() -> bool { return t_isWorker; }
+
+		/// @brief Queues the task for execution on a worker thread
+		template<typename F>
+		auto submit(F&& task) -> std::future<std::invoke_result_t<F>>
+		{
+			using Result = std::invoke_result_t<F>;
+			auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+			auto future = packagedTask->get_future();
+			{
+				std::lock_guard lock{ m_mutex };
+				AGX_ASSERT_X(!m_stop, "Cannot submit tasks to a stopped thread pool");
+				m_tasks.emplace([packagedTask]() { (*packagedTask)(); });
+			}
+			m_condition.notify_one();
+			return future;
+		}
+
+	private:
+		void workerLoop();
+
+		inline static thread_local bool t_isWorker{ false };
+
+		std::vector<std::thread> m_workers;
+		std::queue<std::function<void()>> m_tasks;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_stop{ false };
+	};
+}
@@ -45,27 +45,12 @@ namespace Aegis
 			m_layerStack.update(frameTimeSec);
 
 			// Rendering
+			m_renderer.setVSync(m_framePacer.usesPresentPacing());
 			m_renderer.renderFrame(m_scene, m_ui);
 
-			applyFrameBrake(currentFrameBegin);
+			m_framePacer.wait(currentFrameBegin);
 		}
 
 		m_renderer.waitIdle();
 	}
-
-	void Engine::applyFrameBrake(std::chrono::steady_clock::time_point frameBegin)
-	{
-		using namespace std::chrono;
-
-		AGX_PROFILE_SCOPE("Wait for FPS limit");
-
-		if constexpr (!Core::ENABLE_FPS_LIMIT)
-			return;
-
-		// Note: This has to be a busy wait since sleep_for is not accurate enough (especially on Windows)
-		while (duration<double, std::milli>(steady_clock::now() - frameBegin).count() < Core::TARGET_FRAME_TIME)
-		{
-			// busy wait
-		}
-	}
 }
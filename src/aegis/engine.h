@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/asset_manager.h"
+#include "core/frame_pacer.h"
 #include "core/globals.h"
 #include "core/input.h"
 #include "core/layer_stack.h"
@@ -30,6 +31,7 @@ namespace Aegis
 		[[nodiscard]] static auto renderer() -> Graphics::Renderer& { return Engine::instance().m_renderer; }
 		[[nodiscard]] static auto ui() -> UI::UI& { return Engine::instance().m_ui; }
 		[[nodiscard]] static auto scene() -> Scene::Scene& { return Engine::instance().m_scene; }
+		[[nodiscard]] static auto framePacer() -> Core::FramePacer& { return Engine::instance().m_framePacer; }
 
 		void run();
 
@@ -47,8 +49,6 @@ namespace Aegis
 		}
 
 	private:
-		void applyFrameBrake(std::chrono::steady_clock::time_point frameBeginTime);
-
 		inline static Engine* s_instance{ nullptr };
 
 		Logging m_logging{};
@@ -59,5 +59,6 @@ namespace Aegis
 		UI::UI m_ui{ m_renderer, m_layerStack};
 		Input m_input{ m_window };
 		Scene::Scene m_scene;
+		Core::FramePacer m_framePacer;
 	};
 }
@@ -7,22 +7,32 @@ namespace Aegis::Graphics
 	// DescriptorHandleCache --------------------
 
 	DescriptorHandleCache::DescriptorHandleCache(uint32_t capacity) :
-		m_capacity{ capacity }
+		m_capacity{ capacity },
+		m_freeList{ std::make_unique<std::atomic<uint32_t>[]>(capacity) }
 	{
 	}
 
 	auto DescriptorHandleCache::fetch(DescriptorHandle::Type type) -> DescriptorHandle
 	{
-		if (!m_availableHandles.empty())
+		// Pop a freed index, the tag in the upper bits prevents ABA when the same index is freed again meanwhile
+		uint64_t head = m_freeHead.load(std::memory_order_acquire);
+		while (static_cast<uint32_t>(head) != EMPTY)
 		{
-			DescriptorHandle handle = m_availableHandles.back();
-			m_availableHandles.pop_back();
-			handle.recycle(type);
-			return handle;
+			uint32_t index = static_cast<uint32_t>(head);
+			uint32_t entry = m_freeList[index].load(std::memory_order_relaxed);
+			uint64_t next = (((head >> 32) + 1) << 32) | (entry & DescriptorHandle::INDEX_MASK);
+			if (m_freeHead.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+			{
+				DescriptorHandle handle;
+				handle.m_handle = handle.pack(index, entry >> DescriptorHandle::INDEX_BITS, type);
+				handle.recycle(type);
+				return handle;
+			}
 		}
 
-		AGX_ASSERT_X(m_nextIndex < m_capacity, "DescriptorHandleCache capacity exceeded!");
-		return DescriptorHandle{ m_nextIndex++, type };
+		uint32_t index = m_nextIndex.fetch_add(1, std::memory_order_relaxed);
+		AGX_ASSERT_X(index < m_capacity, "DescriptorHandleCache capacity exceeded!");
+		return DescriptorHandle{ index, type };
 	}
 
 	void DescriptorHandleCache::free(DescriptorHandle& handle)
@@ -30,8 +40,18 @@ namespace Aegis::Graphics
 		if (!handle.isValid())
 			return;
 
-		AGX_ASSERT_X(handle.index() < m_capacity, "DescriptorHandle index out of bounds!");
-		m_availableHandles.emplace_back(handle);
+		uint32_t index = handle.index();
+		AGX_ASSERT_X(index < m_capacity, "DescriptorHandle index out of bounds!");
+
+		uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+		uint64_t newHead;
+		do
+		{
+			m_freeList[index].store((handle.version() << DescriptorHandle::INDEX_BITS) | static_cast<uint32_t>(head),
+				std::memory_order_relaxed);
+			newHead = (((head >> 32) + 1) << 32) | index;
+		} while (!m_freeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+
 		handle.invalidate();
 	}
 
@@ -47,55 +67,106 @@ namespace Aegis::Graphics
 
 	BindlessDescriptorSet::~BindlessDescriptorSet()
 	{
+		VulkanContext::deletionQueue().flushDescriptorHandles(*this);
 	}
 
 	auto BindlessDescriptorSet::allocateSampledImage(const Texture& texture) -> DescriptorHandle
 	{
 		auto handle = m_sampledImageCache.fetch(DescriptorHandle::Type::SampledImage);
-		auto textureInfo = texture.descriptorImageInfo(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-		writeSet(SAMPLED_IMAGE_BINDING, handle.index(), VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, &textureInfo, nullptr);
+		queueWrite(PendingWrite{
+			.binding = SAMPLED_IMAGE_BINDING,
+			.index = handle.index(),
+			.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+			.imageInfo = texture.descriptorImageInfo(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL),
+		});
 		return handle;
 	}
 
 	auto BindlessDescriptorSet::allocateStorageImage(const Texture& texture) -> DescriptorHandle
 	{
 		auto handle = m_storageImageCache.fetch(DescriptorHandle::Type::StorageImage);
-		auto textureInfo = texture.descriptorImageInfo(VK_IMAGE_LAYOUT_GENERAL);
-		writeSet(STORAGE_IMAGE_BINDING, handle.index(), VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, &textureInfo, nullptr);
+		queueWrite(PendingWrite{
+			.binding = STORAGE_IMAGE_BINDING,
+			.index = handle.index(),
+			.type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+			.imageInfo = texture.descriptorImageInfo(VK_IMAGE_LAYOUT_GENERAL),
+		});
 		return handle;
 	}
 
 	auto BindlessDescriptorSet::allocateStorageBuffer(const VkDescriptorBufferInfo& bufferInfo) -> DescriptorHandle
 	{
 		auto handle = m_storageBufferCache.fetch(DescriptorHandle::Type::StorageBuffer);
-		writeSet(STORAGE_BUFFER_BINDING, handle.index(), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, nullptr, &bufferInfo);
+		queueWrite(PendingWrite{
+			.binding = STORAGE_BUFFER_BINDING,
+			.index = handle.index(),
+			.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.bufferInfo = bufferInfo,
+		});
 		return handle;
 	}
 
 	auto BindlessDescriptorSet::allocateUniformBuffer(const VkDescriptorBufferInfo& bufferInfo) -> DescriptorHandle
 	{
 		auto handle = m_uniformBufferCache.fetch(DescriptorHandle::Type::UniformBuffer);
-		writeSet(UNIFORM_BUFFER_BINDING, handle.index(), VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, nullptr, &bufferInfo);
+		queueWrite(PendingWrite{
+			.binding = UNIFORM_BUFFER_BINDING,
+			.index = handle.index(),
+			.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+			.bufferInfo = bufferInfo,
+		});
 		return handle;
 	}
 
-	void BindlessDescriptorSet::writeSet(uint32_t binding, uint32_t index, VkDescriptorType type, 
-		const VkDescriptorImageInfo* imageInfo, const VkDescriptorBufferInfo* bufferInfo)
+	void BindlessDescriptorSet::flushWrites()
+	{
+		{
+			std::lock_guard lock{ m_writeMutex };
+			if (m_pendingWrites.empty())
+				return;
+
+			std::swap(m_pendingWrites, m_flushingWrites);
+		}
+
+		// Writes keep their queue order, so a later write to the same index wins
+		m_writes.clear();
+		m_writes.reserve(m_flushingWrites.size());
+		for (const auto& pending : m_flushingWrites)
+		{
+			bool isImage = pending.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER || pending.type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+			m_writes.emplace_back(VkWriteDescriptorSet{
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.dstSet = m_bindlessDescriptorSet,
+				.dstBinding = pending.binding,
+				.dstArrayElement = pending.index,
+				.descriptorCount = 1,
+				.descriptorType = pending.type,
+				.pImageInfo = isImage ? &pending.imageInfo : nullptr,
+				.pBufferInfo = isImage ? nullptr : &pending.bufferInfo,
+			});
+		}
+		vkUpdateDescriptorSets(VulkanContext::device(), static_cast<uint32_t>(m_writes.size()), m_writes.data(), 0, nullptr);
+
+		m_flushingWrites.clear();
+	}
+
+	void BindlessDescriptorSet::queueWrite(const PendingWrite& write)
 	{
-		VkWriteDescriptorSet write{
-			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-			.dstSet = m_bindlessDescriptorSet,
-			.dstBinding = binding,
-			.dstArrayElement = index,
-			.descriptorCount = 1,
-			.descriptorType = type,
-			.pImageInfo = imageInfo,
-			.pBufferInfo = bufferInfo,
-		};
-		vkUpdateDescriptorSets(VulkanContext::device(), 1, &write, 0, nullptr);
+		std::lock_guard lock{ m_writeMutex };
+		m_pendingWrites.emplace_back(write);
 	}
 
 	void BindlessDescriptorSet::freeHandle(DescriptorHandle& handle)
+	{
+		if (!handle.isValid())
+			return;
+
+		// Shaders of in flight frames may still access the descriptor
+		VulkanContext::deletionQueue().schedule(*this, handle);
+		handle.invalidate();
+	}
+
+	void BindlessDescriptorSet::releaseHandle(DescriptorHandle& handle)
 	{
 		if (!handle.isValid())
 			return;
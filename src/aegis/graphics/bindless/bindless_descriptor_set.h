@@ -5,11 +5,18 @@
 #include "graphics/resources/buffer.h"
 #include "graphics/resources/texture.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace Aegis::Graphics
 {
+	/// @brief Lock-free allocator of descriptor indices (safe to use from any thread)
+	/// @note Freed indices are kept in a tagged stack where each entry stores the next free index and its version
 	class DescriptorHandleCache
 	{
 	public:
+		static constexpr uint32_t EMPTY = DescriptorHandle::INDEX_MASK;
+
 		DescriptorHandleCache(uint32_t capacity);
 
 		auto fetch(DescriptorHandle::Type type) -> DescriptorHandle;
@@ -17,8 +24,9 @@ namespace Aegis::Graphics
 
 	private:
 		uint32_t m_capacity;
-		uint32_t m_nextIndex{ 0 };
-		std::vector<DescriptorHandle> m_availableHandles;
+		std::atomic<uint32_t> m_nextIndex{ 0 };
+		std::atomic<uint64_t> m_freeHead{ EMPTY }; // | 32 bits tag | 32 bits index |
+		std::unique_ptr<std::atomic<uint32_t>[]> m_freeList; // | 6 bits version | 24 bits next index |
 	};
 
 
@@ -49,13 +57,29 @@ namespace Aegis::Graphics
 		auto allocateStorageBuffer(const VkDescriptorBufferInfo& bufferInfo) -> DescriptorHandle;
 		auto allocateUniformBuffer(const VkDescriptorBufferInfo& bufferInfo) -> DescriptorHandle;
 
+		/// @brief Issues all descriptor writes queued by allocate* in a single update
+		/// @note Called by the renderer before each submit, the set is update-after-bind so bound sets stay valid
+		void flushWrites();
+
+		/// @brief Returns the handle for reuse once the frames in flight finished (see DeletionQueue)
 		void freeHandle(DescriptorHandle& handle);
 
+		/// @brief Returns the handle for reuse immediately
+		void releaseHandle(DescriptorHandle& handle);
+
 	private:
 		auto createDescriptorPool() -> DescriptorPool;
 		auto createDescriptorSetLayout() -> DescriptorSetLayout;
-		void writeSet(uint32_t binding, uint32_t index, VkDescriptorType type,
-			const VkDescriptorImageInfo* imageInfo, const VkDescriptorBufferInfo* bufferInfo);
+		struct PendingWrite
+		{
+			uint32_t binding;
+			uint32_t index;
+			VkDescriptorType type;
+			VkDescriptorImageInfo imageInfo;
+			VkDescriptorBufferInfo bufferInfo;
+		};
+
+		void queueWrite(const PendingWrite& write);
 
 		DescriptorPool m_bindlessPool;
 		DescriptorSetLayout m_bindlessSetLayout;
@@ -65,5 +89,10 @@ namespace Aegis::Graphics
 		DescriptorHandleCache m_storageImageCache{ MAX_STORAGE_IMAGES };
 		DescriptorHandleCache m_storageBufferCache{ MAX_STORAGE_BUFFERS };
 		DescriptorHandleCache m_uniformBufferCache{ MAX_UNIFORM_BUFFERS };
+
+		std::vector<PendingWrite> m_pendingWrites;
+		std::vector<PendingWrite> m_flushingWrites;
+		std::vector<VkWriteDescriptorSet> m_writes;
+		std::mutex m_writeMutex;
 	};
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "deletion_queue.h"
 
+#include "graphics/bindless/bindless_descriptor_set.h"
+
 namespace Aegis::Graphics
 {
 	DeletionQueue::~DeletionQueue()
@@ -8,22 +10,64 @@ namespace Aegis::Graphics
 		flushAll();
 	}
 
-	void DeletionQueue::schedule(std::function<void()>&& function)
+	void DeletionQueue::initialize(VkDevice device, VmaAllocator allocator)
 	{
-		m_pendingDeletions[m_currentFrameIndex].deletors.emplace_back(std::move(function));
+		m_device = device;
+		m_allocator = allocator;
 	}
 
-	void DeletionQueue::flush(uint32_t frameIndex)
+	void DeletionQueue::schedule(VkBuffer buffer, VmaAllocation allocation)
 	{
-		m_currentFrameIndex = frameIndex;
+		std::lock_guard lock{ m_mutex };
+		m_pendingDeletions[m_currentFrameIndex].buffers.emplace_back(buffer, allocation);
+	}
 
-		auto& deletors = m_pendingDeletions[frameIndex].deletors;
-		for (auto& deleteFunc : deletors)
+	void DeletionQueue::schedule(VkImage image, VmaAllocation allocation)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_pendingDeletions[m_currentFrameIndex].images.emplace_back(image, allocation);
+	}
+
+	void DeletionQueue::schedule(VkImageView view)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_pendingDeletions[m_currentFrameIndex].imageViews.emplace_back(view);
+	}
+
+	void DeletionQueue::schedule(VkSampler sampler)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_pendingDeletions[m_currentFrameIndex].samplers.emplace_back(sampler);
+	}
+
+	void DeletionQueue::schedule(VkPipeline pipeline)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_pendingDeletions[m_currentFrameIndex].pipelines.emplace_back(pipeline);
+	}
+
+	void DeletionQueue::schedule(VkPipelineLayout pipelineLayout)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_pendingDeletions[m_currentFrameIndex].pipelineLayouts.emplace_back(pipelineLayout);
+	}
+
+	void DeletionQueue::schedule(BindlessDescriptorSet& descriptorSet, DescriptorHandle handle)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_pendingDeletions[m_currentFrameIndex].descriptorHandles.emplace_back(&descriptorSet, handle);
+	}
+
+	void DeletionQueue::flush(uint32_t frameIndex)
+	{
 		{
-			if (deleteFunc)
-				deleteFunc();
+			std::lock_guard lock{ m_mutex };
+			m_currentFrameIndex = frameIndex;
+			std::swap(m_flushing, m_pendingDeletions[frameIndex]);
 		}
-		deletors.clear();
+
+		destroy(m_flushing);
+		m_flushing.clear();
 	}
 
 	void DeletionQueue::flushAll()
@@ -33,4 +77,62 @@ namespace Aegis::Graphics
 			flush(i);
 		}
 	}
+
+	void DeletionQueue::flushDescriptorHandles(const BindlessDescriptorSet& descriptorSet)
+	{
+		std::lock_guard lock{ m_mutex };
+		for (auto& deletions : m_pendingDeletions)
+		{
+			std::erase_if(deletions.descriptorHandles, [&descriptorSet](HandleDeletion& deletion) {
+				if (deletion.descriptorSet != &descriptorSet)
+					return false;
+
+				deletion.descriptorSet->releaseHandle(deletion.handle);
+				return true;
+			});
+		}
+	}
+
+	void DeletionQueue::destroy(FrameDeletions& deletions)
+	{
+		for (const auto& [buffer, allocation] : deletions.buffers)
+		{
+			vmaDestroyBuffer(m_allocator, buffer, allocation);
+		}
+		for (const auto& [image, allocation] : deletions.images)
+		{
+			vmaDestroyImage(m_allocator, image, allocation);
+		}
+		for (auto view : deletions.imageViews)
+		{
+			vkDestroyImageView(m_device, view, nullptr);
+		}
+		for (auto sampler : deletions.samplers)
+		{
+			vkDestroySampler(m_device, sampler, nullptr);
+		}
+		for (auto pipeline : deletions.pipelines)
+		{
+			vkDestroyPipeline(m_device, pipeline, nullptr);
+		}
+		for (auto pipelineLayout : deletions.pipelineLayouts)
+		{
+			vkDestroyPipelineLayout(m_device, pipelineLayout, nullptr);
+		}
+		for (auto& [descriptorSet, handle] : deletions.descriptorHandles)
+		{
+			descriptorSet->releaseHandle(handle);
+		}
+	}
+
+	void DeletionQueue::FrameDeletions::clear()
+	{
+		buffers.clear();
+		images.clear();
+		imageViews.clear();
+		samplers.clear();
+		pipelines.clear();
+		pipelineLayouts.clear();
+		descriptorHandles.clear();
+	}
 }
@@ -1,11 +1,19 @@
 #pragma once
 
+#include "graphics/bindless/descriptor_handle.h"
 #include "graphics/globals.h"
+#include "graphics/vulkan/volk_include.h"
+
+#include <vk_mem_alloc.h>
+
+#include <mutex>
 
 namespace Aegis::Graphics
 {
+	class BindlessDescriptorSet;
+
 	/// @brief Manages the deletion of vulkan objects to ensure they are not deleted while in use
-	/// @note Deletion is deferred for SwapChain::MAX_FRAMES_IN_FLIGHT frames 
+	/// @note Deletion is deferred for MAX_FRAMES_IN_FLIGHT frames, scheduling is thread safe
 	class DeletionQueue
 	{
 	public:
@@ -17,17 +25,63 @@ namespace Aegis::Graphics
 		DeletionQueue& operator=(const DeletionQueue&) = delete;
 		DeletionQueue& operator=(DeletionQueue&&) = delete;
 
-		void schedule(std::function<void()>&& function);
+		void initialize(VkDevice device, VmaAllocator allocator);
+
+		void schedule(VkBuffer buffer, VmaAllocation allocation);
+		void schedule(VkImage image, VmaAllocation allocation);
+		void schedule(VkImageView view);
+		void schedule(VkSampler sampler);
+		void schedule(VkPipeline pipeline);
+		void schedule(VkPipelineLayout pipelineLayout);
+		void schedule(BindlessDescriptorSet& descriptorSet, DescriptorHandle handle);
+
 		void flush(uint32_t frameIndex);
 		void flushAll();
 
+		/// @brief Releases all pending handles of the descriptor set right away (call before destroying it)
+		void flushDescriptorHandles(const BindlessDescriptorSet& descriptorSet);
+
 	private:
-		struct DeletorQueue
+		struct BufferDeletion
+		{
+			VkBuffer buffer;
+			VmaAllocation allocation;
+		};
+
+		struct ImageDeletion
 		{
-			std::vector<std::function<void()>> deletors;
+			VkImage image;
+			VmaAllocation allocation;
 		};
 
-		std::array<DeletorQueue, MAX_FRAMES_IN_FLIGHT> m_pendingDeletions;
+		struct HandleDeletion
+		{
+			BindlessDescriptorSet* descriptorSet;
+			DescriptorHandle handle;
+		};
+
+		/// @brief Objects retired during one frame (vectors keep their capacity between frames)
+		struct FrameDeletions
+		{
+			std::vector<BufferDeletion> buffers;
+			std::vector<ImageDeletion> images;
+			std::vector<VkImageView> imageViews;
+			std::vector<VkSampler> samplers;
+			std::vector<VkPipeline> pipelines;
+			std::vector<VkPipelineLayout> pipelineLayouts;
+			std::vector<HandleDeletion> descriptorHandles;
+
+			void clear();
+		};
+
+		void destroy(FrameDeletions& deletions);
+
+		VkDevice m_device{ VK_NULL_HANDLE };
+		VmaAllocator m_allocator{ VK_NULL_HANDLE };
+
+		std::array<FrameDeletions, MAX_FRAMES_IN_FLIGHT> m_pendingDeletions;
+		FrameDeletions m_flushing; // Swapped with the flushed frame so destruction runs without holding the lock
 		uint32_t m_currentFrameIndex{ 0 };
+		std::mutex m_mutex;
 	};
-}
\ No newline at end of file
+}
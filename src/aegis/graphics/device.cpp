@@ -9,11 +9,14 @@
 #define VMA_DYNAMIC_VULKAN_FUNCTIONS 0
 #include <vk_mem_alloc.h>
 
+#include <cstring>
+
 namespace Aegis::Graphics
 {
 	VulkanDevice::~VulkanDevice()
 	{
 		vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+		vkDestroyCommandPool(m_device, m_singleTimeCommandPool, nullptr);
 		vmaDestroyAllocator(m_allocator);
 		vkDestroyDevice(m_device, nullptr);
 		m_debugMessenger.destroy();
@@ -37,9 +40,11 @@ namespace Aegis::Graphics
 		VkCommandBufferAllocateInfo allocInfo{};
 		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
 		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-		allocInfo.commandPool = m_commandPool;
+		allocInfo.commandPool = m_singleTimeCommandPool;
 		allocInfo.commandBufferCount = 1;
 
+		std::lock_guard lock{ m_singleTimeMutex };
+
 		VkCommandBuffer commandBuffer;
 		vkAllocateCommandBuffers(m_device, &allocInfo, &commandBuffer);
 
@@ -60,10 +65,14 @@ namespace Aegis::Graphics
 		submitInfo.commandBufferCount = 1;
 		submitInfo.pCommandBuffers = &commandBuffer;
 
-		vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-		vkQueueWaitIdle(m_graphicsQueue);
+		{
+			std::lock_guard lock{ m_queueMutex };
+			vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
+			vkQueueWaitIdle(m_graphicsQueue);
+		}
 
-		vkFreeCommandBuffers(m_device, m_commandPool, 1, &commandBuffer);
+		std::lock_guard lock{ m_singleTimeMutex };
+		vkFreeCommandBuffers(m_device, m_singleTimeCommandPool, 1, &commandBuffer);
 	}
 
 	void VulkanDevice::createBuffer(VkBuffer& buffer, VmaAllocation& allocation, VkDeviceSize size,
@@ -338,6 +347,7 @@ namespace Aegis::Graphics
 		VkPhysicalDeviceFeatures2 features{
 			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
 			.features = VkPhysicalDeviceFeatures{
+					.pipelineStatisticsQuery = m_features.core.features.pipelineStatisticsQuery, // Optional
 					.samplerAnisotropy = VK_TRUE,
 				},
 		};
@@ -384,6 +394,7 @@ namespace Aegis::Graphics
 			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT,
 			.taskShader = m_features.meshShaderEXT.taskShader,
 			.meshShader = m_features.meshShaderEXT.meshShader,
+			.meshShaderQueries = m_features.meshShaderEXT.meshShaderQueries, // Optional (task and mesh pipeline statistics)
 		};
 
 		// Build the pNext chain
@@ -399,6 +410,13 @@ namespace Aegis::Graphics
 			enabledExtensions.emplace_back(VK_EXT_MESH_SHADER_EXTENSION_NAME);
 		}
 
+		// Optional: lets VMA report the actual heap budgets instead of estimating them
+		m_memoryBudgetSupported = isDeviceExtensionSupported(m_physicalDevice, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+		if (m_memoryBudgetSupported)
+		{
+			enabledExtensions.emplace_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+		}
+
 		QueueFamilyIndices indices = findQueueFamilies(m_physicalDevice);
 		AGX_ASSERT_X(indices.isComplete(), "Queue family indices are not complete");
 
@@ -447,6 +465,7 @@ namespace Aegis::Graphics
 	void VulkanDevice::createAllocator()
 	{
 		VmaAllocatorCreateInfo allocatorInfo{
+			.flags = m_memoryBudgetSupported ? VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT : 0u,
 			.physicalDevice = m_physicalDevice,
 			.device = m_device,
 			.instance = m_instance,
@@ -471,6 +490,7 @@ namespace Aegis::Graphics
 		poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 
 		VK_CHECK(vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool))
+		VK_CHECK(vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_singleTimeCommandPool))
 	}
 
 	auto VulkanDevice::checkValidationLayerSupport() -> bool
@@ -553,6 +573,19 @@ namespace Aegis::Graphics
 		return requiredExtensions.empty();
 	}
 
+	auto VulkanDevice::isDeviceExtensionSupported(VkPhysicalDevice device, const char* extension) const -> bool
+	{
+		uint32_t extensionCount;
+		vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
+
+		std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+		vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
+
+		return std::ranges::any_of(availableExtensions, [extension](const VkExtensionProperties& properties) {
+			return std::strcmp(properties.extensionName, extension) == 0;
+		});
+	}
+
 	auto VulkanDevice::checkDeviceFeatureSupport(VkPhysicalDevice device) -> bool
 	{
 		VkPhysicalDeviceMeshShaderFeaturesEXT meshShaderFeatures{
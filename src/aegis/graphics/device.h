@@ -7,6 +7,8 @@
 
 #include <vk_mem_alloc.h>
 
+#include <mutex>
+
 namespace Aegis::Graphics
 {
 	struct SwapChainSupportDetails
@@ -58,11 +60,15 @@ namespace Aegis::Graphics
 		[[nodiscard]] auto surface() const -> VkSurfaceKHR { return m_surface; }
 		[[nodiscard]] auto graphicsQueue() const -> VkQueue { return m_graphicsQueue; }
 		[[nodiscard]] auto presentQueue() const -> VkQueue { return m_presentQueue; }
+		/// @brief Queues are externally synchronized, lock this for every submit and present
+		[[nodiscard]] auto queueMutex() const -> std::mutex& { return m_queueMutex; }
 		[[nodiscard]] auto properties() const -> const VkPhysicalDeviceProperties& { return m_properties; }
 		[[nodiscard]] auto features() const -> const VulkanFeatures& { return m_features; }
+		[[nodiscard]] auto isMemoryBudgetSupported() const -> bool { return m_memoryBudgetSupported; }
 
 		void initialize(Core::Window& window);
 
+		/// @brief Uses a separate command pool, so it can be called while the render thread records a frame
 		auto beginSingleTimeCommands() const->VkCommandBuffer;
 		void endSingleTimeCommands(VkCommandBuffer commandBuffer) const;
 
@@ -98,6 +104,7 @@ namespace Aegis::Graphics
 		auto findQueueFamilies(VkPhysicalDevice device) const -> QueueFamilyIndices;
 		void checkGflwRequiredInstanceExtensions();
 		auto checkDeviceExtensionSupport(VkPhysicalDevice device) -> bool;
+		auto isDeviceExtensionSupported(VkPhysicalDevice device, const char* extension) const -> bool;
 		auto checkDeviceFeatureSupport(VkPhysicalDevice device) -> bool;
 		auto querySwapChainSupport(VkPhysicalDevice device) const -> SwapChainSupportDetails;
 
@@ -106,11 +113,15 @@ namespace Aegis::Graphics
 		VkDevice m_device = VK_NULL_HANDLE;
 		VmaAllocator m_allocator = VK_NULL_HANDLE;
 		VkCommandPool m_commandPool = VK_NULL_HANDLE;
+		VkCommandPool m_singleTimeCommandPool = VK_NULL_HANDLE;
+		mutable std::mutex m_singleTimeMutex;
+		mutable std::mutex m_queueMutex;
 
 		DebugUtilsMessenger m_debugMessenger;
 
 		VkPhysicalDeviceProperties m_properties{};
 		VulkanFeatures m_features{};
+		bool m_memoryBudgetSupported{ false };
 
 		VkSurfaceKHR m_surface = VK_NULL_HANDLE;
 		VkQueue m_graphicsQueue = VK_NULL_HANDLE;
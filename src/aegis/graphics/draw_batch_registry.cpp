@@ -14,11 +14,25 @@ namespace Aegis::Graphics
 		if (it != m_batches.end())
 			return *it;
 
+		AGX_ASSERT_X(m_batches.size() < MAX_DRAW_BATCHES, "Reached maximum draw batch count");
+
 		uint32_t nextId = static_cast<uint32_t>(m_batches.size());
+		mat->setDrawBatchId(nextId);
 		m_batches.emplace_back(nextId, m_totalCount, 0, std::move(mat));
 		return m_batches.back();
 	}
 
+	auto DrawBatchRegistry::transparentInstanceCount() const -> uint32_t
+	{
+		uint32_t count = 0;
+		for (const auto& batch : m_batches)
+		{
+			if (batch.materialTemplate->type() == MaterialType::Transparent)
+				count += batch.instanceCount;
+		}
+		return count;
+	}
+
 	void DrawBatchRegistry::addInstance(uint32_t batchId)
 	{
 		AGX_ASSERT_X(isValid(batchId), "Invalid batch ID");
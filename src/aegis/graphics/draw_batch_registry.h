@@ -29,6 +29,7 @@ namespace Aegis::Graphics
 		[[nodiscard]] auto instanceCount() const -> uint32_t { return m_totalCount; }
 		[[nodiscard]] auto staticInstanceCount() const -> uint32_t { return m_staticCount; }
 		[[nodiscard]] auto dynamicInstanceCount() const -> uint32_t { return m_dynamicCount; }
+		[[nodiscard]] auto transparentInstanceCount() const -> uint32_t;
 
 		auto registerDrawBatch(std::shared_ptr<MaterialTemplate> mat) -> const DrawBatch&;
 		void addInstance(uint32_t batchId);
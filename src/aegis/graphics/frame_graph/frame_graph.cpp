@@ -3,6 +3,7 @@
 
 #include "core/profiler.h"
 #include "graphics/frame_graph/frame_graph_render_pass.h"
+#include "graphics/gpu_timer.h"
 #include "graphics/vulkan/vulkan_context.h"
 #include "graphics/vulkan/vulkan_tools.h"
 
@@ -64,6 +65,10 @@ namespace Aegis::Graphics
 			Tools::vk::cmdBeginDebugUtilsLabel(frameInfo.cmd, node.info.name.c_str());
 			{
 				placeBarriers(frameInfo.cmd, node);
+
+				// Every pass is timed on CPU and GPU under its node name so both can be matched up
+				AGX_PROFILE_SCOPE(node.info.name);
+				GPUScopeTimer gpuTimer{ frameInfo.cmd, node.info.name, true };
 				node.pass->execute(m_pool, frameInfo);
 			}
 			Tools::vk::cmdEndDebugUtilsLabel(frameInfo.cmd);
@@ -169,7 +169,8 @@ namespace Aegis::Graphics
 			.instanceCount = info.instanceCount,
 			.usage = info.usage,
 			.allocFlags = info.allocFlags,
-			.minOffsetAlignment = alignment
+			.minOffsetAlignment = alignment,
+			.category = MemoryCategory::FrameGraph,
 		};
 		m_buffers.emplace_back(bufferCreateInfo);
 
@@ -189,6 +190,7 @@ namespace Aegis::Graphics
 		auto textureCreateInfo = Texture::CreateInfo::texture2D(info.extent.width, info.extent.height, info.format);
 		textureCreateInfo.image.usage = info.usage;
 		textureCreateInfo.image.mipLevels = info.mipLevels;
+		textureCreateInfo.image.category = MemoryCategory::FrameGraph;
 		m_textures.emplace_back(textureCreateInfo);
 		
 		Tools::vk::setDebugUtilsObjectName(m_textures.back().image(), name);
@@ -1,16 +1,14 @@
 #pragma once
 
 #include "graphics/draw_batch_registry.h"
+#include "graphics/render_world.h"
 #include "graphics/vulkan/volk_include.h"
-#include "scene/scene.h"
-#include "ui/ui.h"
 
 namespace Aegis::Graphics
 {
 	struct FrameInfo
 	{
-		Scene::Scene& scene;
-		UI::UI& ui;
+		const RenderWorld& world;
 		DrawBatchRegistry& drawBatcher;
 		VkCommandBuffer cmd{ VK_NULL_HANDLE };
 		uint32_t frameIndex{ 0 };
@@ -9,5 +9,4 @@ namespace Aegis::Graphics
 #endif
 
 	constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 2;
-	constexpr uint32_t MAX_POINT_LIGHTS = 128;
 }
\ No newline at end of file
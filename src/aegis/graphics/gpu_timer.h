@@ -3,35 +3,60 @@
 #include "graphics/globals.h"
 #include "graphics/vulkan/volk_include.h"
 #include "graphics/vulkan/vulkan_context.h"
+#include "graphics/vulkan/vulkan_tools.h"
+
+#include <atomic>
+#include <bit>
 
 #define AGX_GPU_PROFILE_SCOPE(cmd, name) Aegis::Graphics::GPUScopeTimer gpuTimer##__LINE__(cmd, name)
 #define AGX_GPU_PROFILE_FUNCTION(cmd) AGX_GPU_PROFILE_SCOPE(cmd, __FUNCTION__)
 
 namespace Aegis::Graphics
 {
+	/// @note Order has to match the bit order of GPUTimerManager::PIPELINE_STATISTICS
+	struct GPUPipelineStatistics
+	{
+		uint64_t clippingPrimitives{ 0 };
+		uint64_t fragmentInvocations{ 0 };
+		uint64_t computeInvocations{ 0 };
+		uint64_t taskInvocations{ 0 };
+		uint64_t meshInvocations{ 0 };
+	};
+
 	struct GPUTimingResult
 	{
 		std::string name;
 		double timeMs{ 0.0 };
+		std::optional<GPUPipelineStatistics> statistics;
 	};
 
+	/// @brief Records timestamp (and optionally pipeline statistics) queries per frame in flight
+	/// @note Query pools grow to the number of queries the frame needed once that frame is resolved again
 	class GPUTimerManager
 	{
 	public:
-		static constexpr uint32_t MAX_QUERY_COUNT = 128;
+		static constexpr uint32_t INITIAL_QUERY_COUNT = 128;
+		static constexpr uint32_t INVALID_SCOPE = std::numeric_limits<uint32_t>::max();
+		// All geometry is drawn with task and mesh shaders, vertex shader statistics are invalid during mesh draws
+		static constexpr VkQueryPipelineStatisticFlags PIPELINE_STATISTICS =
+			VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+			VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |
+			VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT |
+			VK_QUERY_PIPELINE_STATISTIC_TASK_SHADER_INVOCATIONS_BIT_EXT |
+			VK_QUERY_PIPELINE_STATISTIC_MESH_SHADER_INVOCATIONS_BIT_EXT;
+		static constexpr uint32_t PIPELINE_STATISTIC_COUNT = std::popcount(PIPELINE_STATISTICS);
+		static_assert(sizeof(GPUPipelineStatistics) == sizeof(uint64_t) * PIPELINE_STATISTIC_COUNT);
 
 		GPUTimerManager() :
-			m_timestampPeriod{ VulkanContext::device().properties().limits.timestampPeriod }
+			m_timestampPeriod{ VulkanContext::device().properties().limits.timestampPeriod },
+			m_statisticsSupported{ VulkanContext::device().features().core.features.pipelineStatisticsQuery == VK_TRUE &&
+				VulkanContext::device().features().meshShaderEXT.meshShaderQueries == VK_TRUE }
 		{
-			VkQueryPoolCreateInfo queryPoolInfo{
-				.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
-				.queryType = VK_QUERY_TYPE_TIMESTAMP,
-				.queryCount = MAX_QUERY_COUNT,
-			};
-
-			for (auto& pool : m_queryPools)
+			for (auto& frame : m_frames)
 			{
-				vkCreateQueryPool(VulkanContext::device(), &queryPoolInfo, nullptr, &pool);
+				createTimestampPool(frame, INITIAL_QUERY_COUNT);
+				if (m_statisticsSupported)
+					createStatisticsPool(frame, INITIAL_QUERY_COUNT / 2);
 			}
 
 			s_instance = this;
@@ -41,9 +66,10 @@ namespace Aegis::Graphics
 		{
 			s_instance = nullptr;
 
-			for (auto& pool : m_queryPools)
+			for (auto& frame : m_frames)
 			{
-				vkDestroyQueryPool(VulkanContext::device(), pool, nullptr);
+				vkDestroyQueryPool(VulkanContext::device(), frame.timestampPool, nullptr);
+				vkDestroyQueryPool(VulkanContext::device(), frame.statisticsPool, nullptr);
 			}
 		}
 
@@ -53,63 +79,184 @@ namespace Aegis::Graphics
 			return *s_instance;
 		}
 
-		[[nodiscard]] auto queryPool() const -> VkQueryPool { return m_queryPools[m_frameIndex]; }
 		[[nodiscard]] auto timings() const -> const std::vector<GPUTimingResult>& { return m_results; }
 
-		auto aquireQueryIndices(std::string_view name) -> std::pair<uint32_t, uint32_t>
+		/// @brief Number of the frame currently being recorded
+		[[nodiscard]] auto frameNumber() const -> uint64_t { return m_frameNumber; }
+
+		/// @brief Number of the frame the current timings were recorded in
+		[[nodiscard]] auto resultFrameNumber() const -> uint64_t { return m_resultFrameNumber; }
+
+		[[nodiscard]] auto isStatisticsSupported() const -> bool { return m_statisticsSupported; }
+		[[nodiscard]] auto isStatisticsEnabled() const -> bool { return m_statisticsEnabled; }
+		void setStatisticsEnabled(bool enabled) { m_statisticsEnabled = enabled && m_statisticsSupported; }
+
+		/// @brief Writes the start timestamp (and begins the statistics query) of a named scope
+		/// @note Statistics scopes must not be nested and must not begin inside a render pass instance
+		auto beginScope(VkCommandBuffer cmd, std::string_view name, bool pipelineStatistics = false) -> uint32_t
+		{
+			auto& frame = m_frames[m_frameIndex];
+			bool withStatistics = pipelineStatistics && m_statisticsEnabled;
+
+			frame.requiredTimestamps += 2;
+			frame.requiredStatistics += withStatistics ? 1 : 0;
+			if (frame.timestampCount + 2 > frame.timestampCapacity ||
+				(withStatistics && frame.statisticsCount + 1 > frame.statisticsCapacity))
+				return INVALID_SCOPE; // Skipped this frame, the pool is grown when the frame is resolved
+
+			Scope scope{
+				.name = std::string{ name },
+				.timestampQuery = frame.timestampCount,
+				.statisticsQuery = withStatistics ? frame.statisticsCount : INVALID_SCOPE,
+			};
+			frame.timestampCount += 2;
+			frame.statisticsCount += withStatistics ? 1 : 0;
+
+			vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, frame.timestampPool, scope.timestampQuery);
+			if (withStatistics)
+			{
+				vkCmdBeginQuery(cmd, frame.statisticsPool, scope.statisticsQuery, 0);
+			}
+
+			frame.scopes.emplace_back(std::move(scope));
+			return static_cast<uint32_t>(frame.scopes.size() - 1);
+		}
+
+		void endScope(VkCommandBuffer cmd, uint32_t scopeIndex)
 		{
-			auto& queryInfo = m_queries[m_frameIndex];
-			AGX_ASSERT_X(queryInfo.currentQuery + 2 <= MAX_QUERY_COUNT, "Exceeded maximum GPU query count");
-			queryInfo.names.emplace_back(name);
-			return { queryInfo.currentQuery++, queryInfo.currentQuery++ };
+			if (scopeIndex == INVALID_SCOPE)
+				return;
+
+			auto& frame = m_frames[m_frameIndex];
+			const auto& scope = frame.scopes[scopeIndex];
+			if (scope.statisticsQuery != INVALID_SCOPE)
+			{
+				vkCmdEndQuery(cmd, frame.statisticsPool, scope.statisticsQuery);
+			}
+			vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame.timestampPool, scope.timestampQuery + 1);
 		}
 
 		void resolveTimings(VkCommandBuffer cmd, uint32_t frameIndex)
 		{
 			m_frameIndex = frameIndex;
+			m_frameNumber++;
 
-			// Retrieve timestamps for previous frame N
-			auto queryCount = m_queries[m_frameIndex].currentQuery;
-			if (queryCount > 0)
+			// Retrieve queries of the previous frame N (its fence was already waited on)
+			auto& frame = m_frames[m_frameIndex];
+			if (!frame.scopes.empty())
 			{
-				std::vector<uint64_t> timestamps(queryCount);
-				vkGetQueryPoolResults(VulkanContext::device(), m_queryPools[m_frameIndex], 0, queryCount, 
-					sizeof(uint64_t) * timestamps.size(), timestamps.data(), sizeof(uint64_t), 
+				m_timestamps.resize(frame.timestampCount);
+				vkGetQueryPoolResults(VulkanContext::device(), frame.timestampPool, 0, frame.timestampCount,
+					sizeof(uint64_t) * m_timestamps.size(), m_timestamps.data(), sizeof(uint64_t),
 					VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
 
-				size_t queryCount = m_queries[m_frameIndex].names.size();
-				AGX_ASSERT_X(queryCount * 2 == timestamps.size(), "Mismatch between query names and timestamps");
+				m_statistics.resize(frame.statisticsCount);
+				if (frame.statisticsCount > 0)
+				{
+					vkGetQueryPoolResults(VulkanContext::device(), frame.statisticsPool, 0, frame.statisticsCount,
+						sizeof(GPUPipelineStatistics) * m_statistics.size(), m_statistics.data(), sizeof(GPUPipelineStatistics),
+						VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+				}
 
 				m_results.clear();
-				for (size_t i = 0; i < queryCount; ++i)
+				for (const auto& scope : frame.scopes)
 				{
-					uint64_t start = timestamps[i * 2];
-					uint64_t end = timestamps[i * 2 + 1];
+					uint64_t start = m_timestamps[scope.timestampQuery];
+					uint64_t end = m_timestamps[scope.timestampQuery + 1];
 					double timeNs = static_cast<double>(end - start) * m_timestampPeriod;
-					m_results.emplace_back(m_queries[m_frameIndex].names[i], timeNs / 1'000'000.0);
+
+					auto& result = m_results.emplace_back(scope.name, timeNs / 1'000'000.0);
+					if (scope.statisticsQuery != INVALID_SCOPE)
+					{
+						result.statistics = m_statistics[scope.statisticsQuery];
+					}
 				}
+				m_resultFrameNumber = frame.frameNumber;
+			}
+
+			// The pools of this frame are idle now, so they can be recreated if the last frame ran out of queries
+			if (frame.requiredTimestamps > frame.timestampCapacity)
+			{
+				vkDestroyQueryPool(VulkanContext::device(), frame.timestampPool, nullptr);
+				createTimestampPool(frame, std::bit_ceil(frame.requiredTimestamps));
+			}
+			if (frame.requiredStatistics > frame.statisticsCapacity)
+			{
+				vkDestroyQueryPool(VulkanContext::device(), frame.statisticsPool, nullptr);
+				createStatisticsPool(frame, std::bit_ceil(frame.requiredStatistics));
 			}
 
 			// Reset for recording this frame N
-			m_queries[m_frameIndex].currentQuery = 0;
-			vkCmdResetQueryPool(cmd, m_queryPools[m_frameIndex], 0, MAX_QUERY_COUNT);
-			m_queries[m_frameIndex].names.clear();
+			frame.frameNumber = m_frameNumber;
+			frame.timestampCount = 0;
+			frame.statisticsCount = 0;
+			frame.requiredTimestamps = 0;
+			frame.requiredStatistics = 0;
+			frame.scopes.clear();
+			vkCmdResetQueryPool(cmd, frame.timestampPool, 0, frame.timestampCapacity);
+			if (frame.statisticsPool != VK_NULL_HANDLE)
+			{
+				vkCmdResetQueryPool(cmd, frame.statisticsPool, 0, frame.statisticsCapacity);
+			}
 		}
 
 	private:
 		static inline GPUTimerManager* s_instance{ nullptr };
 
-		struct QueryInfo
+		struct Scope
+		{
+			std::string name;
+			uint32_t timestampQuery{ 0 };
+			uint32_t statisticsQuery{ INVALID_SCOPE };
+		};
+
+		struct FrameQueries
 		{
-			std::vector<std::string> names;
-			uint32_t currentQuery{ 0 };
+			VkQueryPool timestampPool{ VK_NULL_HANDLE };
+			VkQueryPool statisticsPool{ VK_NULL_HANDLE };
+			uint32_t timestampCapacity{ 0 };
+			uint32_t statisticsCapacity{ 0 };
+			uint32_t timestampCount{ 0 };
+			uint32_t statisticsCount{ 0 };
+			uint32_t requiredTimestamps{ 0 };
+			uint32_t requiredStatistics{ 0 };
+			uint64_t frameNumber{ 0 };
+			std::vector<Scope> scopes;
 		};
 
-		std::array<VkQueryPool, MAX_FRAMES_IN_FLIGHT> m_queryPools{};
-		std::array<QueryInfo, MAX_FRAMES_IN_FLIGHT> m_queries{};
+		static void createTimestampPool(FrameQueries& frame, uint32_t capacity)
+		{
+			VkQueryPoolCreateInfo queryPoolInfo{
+				.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+				.queryType = VK_QUERY_TYPE_TIMESTAMP,
+				.queryCount = capacity,
+			};
+			VK_CHECK(vkCreateQueryPool(VulkanContext::device(), &queryPoolInfo, nullptr, &frame.timestampPool));
+			frame.timestampCapacity = capacity;
+		}
+
+		static void createStatisticsPool(FrameQueries& frame, uint32_t capacity)
+		{
+			VkQueryPoolCreateInfo queryPoolInfo{
+				.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+				.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+				.queryCount = capacity,
+				.pipelineStatistics = PIPELINE_STATISTICS,
+			};
+			VK_CHECK(vkCreateQueryPool(VulkanContext::device(), &queryPoolInfo, nullptr, &frame.statisticsPool));
+			frame.statisticsCapacity = capacity;
+		}
+
+		std::array<FrameQueries, MAX_FRAMES_IN_FLIGHT> m_frames{};
 		double m_timestampPeriod{ 0.0f };
+		bool m_statisticsSupported{ false };
+		bool m_statisticsEnabled{ false };
 		uint32_t m_frameIndex{ 0 };
+		std::atomic<uint64_t> m_frameNumber{ 0 }; // Read by the main thread (see ProfileCapture)
+		uint64_t m_resultFrameNumber{ 0 };
 
+		std::vector<uint64_t> m_timestamps;
+		std::vector<GPUPipelineStatistics> m_statistics;
 		std::vector<GPUTimingResult> m_results{};
 	};
 
@@ -121,32 +268,28 @@ namespace Aegis::Graphics
 		{
 		}
 
-		void start(std::string_view name)
+		void start(std::string_view name, bool pipelineStatistics = false)
 		{
-			auto [start, end] = GPUTimerManager::instance().aquireQueryIndices(name);
-			m_queryStart = start;
-			m_queryEnd = end;
-			vkCmdWriteTimestamp(m_cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, GPUTimerManager::instance().queryPool(), m_queryStart);
+			m_scope = GPUTimerManager::instance().beginScope(m_cmd, name, pipelineStatistics);
 		}
 
 		void end()
 		{
-			vkCmdWriteTimestamp(m_cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, GPUTimerManager::instance().queryPool(), m_queryEnd);
+			GPUTimerManager::instance().endScope(m_cmd, m_scope);
 		}
 
 	private:
 		VkCommandBuffer m_cmd;
-		uint32_t m_queryStart{ 0 };
-		uint32_t m_queryEnd{ 0 };
+		uint32_t m_scope{ GPUTimerManager::INVALID_SCOPE };
 	};
 
 	class GPUScopeTimer
 	{
 	public:
-		GPUScopeTimer(VkCommandBuffer cmd, std::string_view name) :
+		GPUScopeTimer(VkCommandBuffer cmd, std::string_view name, bool pipelineStatistics = false) :
 			m_timer{ cmd }
 		{
-			m_timer.start(name);
+			m_timer.start(name, pipelineStatistics);
 		}
 
 		~GPUScopeTimer()
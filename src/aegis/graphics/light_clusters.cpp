@@ -0,0 +1,136 @@
+#include "pch.h"
+#include "light_clusters.h"
+
+#include "scene/components.h"
+
+#include <bit>
+
+namespace Aegis::Graphics
+{
+	// LightClusterBinner --------------------------------------------------------
+
+	auto LightClusterBinner::clusterIndex(uint32_t x, uint32_t y, uint32_t z) -> uint32_t
+	{
+		return x + y * SIZE_X + z * SIZE_X * SIZE_Y;
+	}
+
+	auto LightClusterBinner::sliceDepth(const ClusterView& view, uint32_t slice) -> float
+	{
+		return view.near * std::pow(view.far / view.near, static_cast<float>(slice) / static_cast<float>(SIZE_Z));
+	}
+
+	auto LightClusterBinner::clusterBounds(const ClusterView& view, uint32_t x, uint32_t y, uint32_t z) -> Bounds
+	{
+		glm::vec2 ndcMin = glm::vec2{ x, y } / glm::vec2{ SIZE_X, SIZE_Y } * 2.0f - 1.0f;
+		glm::vec2 ndcMax = glm::vec2{ x + 1, y + 1 } / glm::vec2{ SIZE_X, SIZE_Y } * 2.0f - 1.0f;
+		float nearDepth = sliceDepth(view, z);
+		float farDepth = sliceDepth(view, z + 1);
+
+		// Unproject the tile corners onto both slice planes (camera looks down -z)
+		Bounds bounds{ glm::vec3{ std::numeric_limits<float>::max() }, glm::vec3{ std::numeric_limits<float>::lowest() } };
+		for (float depth : { nearDepth, farDepth })
+		{
+			for (glm::vec2 ndc : { ndcMin, glm::vec2{ ndcMax.x, ndcMin.y }, glm::vec2{ ndcMin.x, ndcMax.y }, ndcMax })
+			{
+				glm::vec3 corner{ ndc * depth / view.projectionScale, -depth };
+				bounds.min = glm::min(bounds.min, corner);
+				bounds.max = glm::max(bounds.max, corner);
+			}
+		}
+		return bounds;
+	}
+
+	auto LightClusterBinner::intersects(const Bounds& bounds, const glm::vec3& center, float radius) -> bool
+	{
+		glm::vec3 closest = glm::clamp(center, bounds.min, bounds.max);
+		glm::vec3 delta = closest - center;
+		return glm::dot(delta, delta) <= radius * radius;
+	}
+
+	auto LightClusterBinner::bin(const ClusterView& view, const std::vector<GPUPointLight>& lights) -> Result
+	{
+		Result result;
+		result.lightCounts.resize(CLUSTER_COUNT, 0);
+		result.lightIndices.resize(CLUSTER_COUNT * MAX_LIGHTS_PER_CLUSTER, 0);
+
+		std::vector<glm::vec3> viewPositions;
+		viewPositions.reserve(lights.size());
+		for (const auto& light : lights)
+		{
+			viewPositions.emplace_back(view.view * glm::vec4{ glm::vec3{ light.positionRadius }, 1.0f });
+		}
+
+		for (uint32_t z = 0; z < SIZE_Z; z++)
+		{
+			for (uint32_t y = 0; y < SIZE_Y; y++)
+			{
+				for (uint32_t x = 0; x < SIZE_X; x++)
+				{
+					uint32_t cluster = clusterIndex(x, y, z);
+					auto bounds = clusterBounds(view, x, y, z);
+
+					uint32_t count = 0;
+					for (uint32_t i = 0; i < lights.size() && count < MAX_LIGHTS_PER_CLUSTER; i++)
+					{
+						if (intersects(bounds, viewPositions[i], lights[i].positionRadius.w))
+						{
+							result.lightIndices[cluster * MAX_LIGHTS_PER_CLUSTER + count] = i;
+							count++;
+						}
+					}
+					result.lightCounts[cluster] = count;
+				}
+			}
+		}
+		return result;
+	}
+
+
+	// LightClusters -------------------------------------------------------------
+
+	auto LightClusters::lightBuffer() const -> const BindlessFrameBuffer&
+	{
+		AGX_ASSERT_X(m_lightBuffer, "Light buffer is created on the first update");
+		return *m_lightBuffer;
+	}
+
+	auto LightClusters::lightRadius(const glm::vec3& color, float intensity) -> float
+	{
+		// Attenuation is inverse square: intensity / d^2 = cutoff
+		float peak = std::max(color.r, std::max(color.g, color.b)) * intensity;
+		return std::sqrt(std::max(peak, 0.0f) / LIGHT_CUTOFF);
+	}
+
+	void LightClusters::update(const RenderWorld& world, uint32_t frameIndex)
+	{
+		const auto& camera = world.camera;
+		m_view = ClusterView{
+			.view = camera.viewMatrix,
+			.projectionScale = glm::vec2{ camera.projectionMatrix[0][0], camera.projectionMatrix[1][1] },
+			.near = camera.near,
+			.far = camera.far,
+		};
+
+		m_lights.clear();
+		for (const auto& pointLight : world.pointLights)
+		{
+			m_lights.emplace_back(
+				glm::vec4{ pointLight.location, lightRadius(pointLight.light.color, pointLight.light.intensity) },
+				glm::vec4{ pointLight.light.color, pointLight.light.intensity });
+		}
+
+		// Both frame copies live in one buffer, the other frame rewrites its copy on its next update
+		if (lightCount() > m_capacity || !m_lightBuffer)
+		{
+			m_capacity = std::max(std::bit_ceil(lightCount()), INITIAL_CAPACITY);
+			auto bufferInfo = Buffer::storageBuffer(sizeof(GPUPointLight) * m_capacity, MAX_FRAMES_IN_FLIGHT);
+			bufferInfo.allocFlags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+			m_lightBuffer = std::make_unique<BindlessFrameBuffer>(bufferInfo);
+		}
+
+		if (!m_lights.empty())
+		{
+			m_lightBuffer->write(m_lights.data(), sizeof(GPUPointLight) * m_lights.size(), 0, frameIndex);
+		}
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "graphics/bindless/bindless_buffer.h"
+
+#include "graphics/render_world.h"
+
+namespace Aegis::Graphics
+{
+	/// @brief Point light as stored in the light list (world space)
+	struct GPUPointLight
+	{
+		glm::vec4 positionRadius{ 0.0f }; // xyz = position, w = radius of influence
+		glm::vec4 color{ 0.0f };		  // rgb = color, a = intensity
+	};
+
+	/// @brief Camera parameters the light clusters are built for
+	struct ClusterView
+	{
+		glm::mat4 view{ 1.0f };
+		glm::vec2 projectionScale{ 1.0f }; // Projection [0][0] and [1][1]
+		float near{ 0.1f };
+		float far{ 1000.0f };
+	};
+
+	/// @brief CPU reference of the light binning compute shader (light_culling.slang)
+	/// @note Clusters are view space froxels: screen tiles split into exponentially growing depth slices
+	class LightClusterBinner
+	{
+	public:
+		static constexpr uint32_t SIZE_X = 16;
+		static constexpr uint32_t SIZE_Y = 9;
+		static constexpr uint32_t SIZE_Z = 24;
+		static constexpr uint32_t CLUSTER_COUNT = SIZE_X * SIZE_Y * SIZE_Z;
+		static constexpr uint32_t MAX_LIGHTS_PER_CLUSTER = 256;
+
+		struct Bounds
+		{
+			glm::vec3 min;
+			glm::vec3 max;
+		};
+
+		struct Result
+		{
+			std::vector<uint32_t> lightCounts;  // One per cluster
+			std::vector<uint32_t> lightIndices; // MAX_LIGHTS_PER_CLUSTER slots per cluster
+		};
+
+		[[nodiscard]] static auto clusterIndex(uint32_t x, uint32_t y, uint32_t z) -> uint32_t;
+		[[nodiscard]] static auto sliceDepth(const ClusterView& view, uint32_t slice) -> float;
+		[[nodiscard]] static auto clusterBounds(const ClusterView& view, uint32_t x, uint32_t y, uint32_t z) -> Bounds;
+		[[nodiscard]] static auto intersects(const Bounds& bounds, const glm::vec3& center, float radius) -> bool;
+
+		/// @brief Assigns the lights to all clusters the same way the compute shader does
+		[[nodiscard]] static auto bin(const ClusterView& view, const std::vector<GPUPointLight>& lights) -> Result;
+	};
+
+	/// @brief Point light list of unbounded size shared by the light culling and lighting pass
+	class LightClusters
+	{
+	public:
+		static constexpr uint32_t INITIAL_CAPACITY = 256;
+		static constexpr float LIGHT_CUTOFF = 0.01f; // Radiance below this is ignored to give lights a finite radius
+
+		LightClusters() = default;
+		LightClusters(const LightClusters&) = delete;
+		LightClusters(LightClusters&&) = delete;
+		~LightClusters() = default;
+
+		auto operator=(const LightClusters&) -> LightClusters& = delete;
+		auto operator=(LightClusters&&) -> LightClusters& = delete;
+
+		[[nodiscard]] auto view() const -> const ClusterView& { return m_view; }
+		[[nodiscard]] auto lights() const -> const std::vector<GPUPointLight>& { return m_lights; }
+		[[nodiscard]] auto lightCount() const -> uint32_t { return static_cast<uint32_t>(m_lights.size()); }
+		[[nodiscard]] auto lightBuffer() const -> const BindlessFrameBuffer&;
+
+		/// @brief Returns the distance at which the light's radiance falls below LIGHT_CUTOFF
+		[[nodiscard]] static auto lightRadius(const glm::vec3& color, float intensity) -> float;
+
+		/// @brief Gathers the point lights of the scene and uploads them for the frame (grows the buffer if needed)
+		void update(const RenderWorld& world, uint32_t frameIndex);
+
+	private:
+		ClusterView m_view;
+		std::vector<GPUPointLight> m_lights;
+		std::unique_ptr<BindlessFrameBuffer> m_lightBuffer;
+		uint32_t m_capacity{ 0 };
+	};
+}
@@ -1,62 +1,73 @@
 #include "pch.h"
 #include "material_instance.h"
 
-#include "graphics/vulkan/vulkan_context.h"
-
 namespace Aegis::Graphics
 {
 	MaterialInstance::MaterialInstance(std::shared_ptr<MaterialTemplate> materialTemplate) : 
-		m_template(std::move(materialTemplate)), 
-		m_uniformBuffer{ Buffer::uniformBuffer(m_template->parameterSize(), MAX_FRAMES_IN_FLIGHT) } 
+		m_template(std::move(materialTemplate))
 	{
 		AGX_ASSERT_X(m_template, "Material template cannot be null");
 
-		m_dirtyFlags.fill(true);
-	}
+		auto& pool = m_template->parameterPool();
+		m_parameterIndex = pool.allocate();
 
-	auto MaterialInstance::queryParameter(const std::string& name) const -> MaterialParameter::Value
-	{
-		auto it = m_overrides.find(name);
-		if (it != m_overrides.end())
-			return it->second;
+		const auto& defaultBlob = m_template->defaultBlob();
+		pool.modify(m_parameterIndex, [&](uint8_t* blob) {
+			std::memcpy(blob, defaultBlob.data(), defaultBlob.size());
+			});
 
-		return m_template->queryDefaultParameter(name);
+		m_textures.resize(m_template->textureCount());
 	}
 
-	void MaterialInstance::setParameter(const std::string& name, const MaterialParameter::Value& value)
+	MaterialInstance::~MaterialInstance()
 	{
-		AGX_ASSERT_X(m_template->hasParameter(name), "Material parameter not found");
-		m_overrides[name] = value;
-		m_dirtyFlags.fill(true);
+		m_template->parameterPool().free(m_parameterIndex);
 	}
 
-	void MaterialInstance::updateParameters(int index)
+	auto MaterialInstance::queryParameter(const std::string& name) const -> MaterialParameter::Value
 	{
-		if (!m_dirtyFlags[index])
-			return;
-
-		// Update uniform buffer
-		for (const auto& [name, info] : m_template->parameters())
-		{
-			const MaterialParameter::Value* valuePtr = &info.defaultValue;
-			auto it = m_overrides.find(name);
-			if (it != m_overrides.end())
-			{
-				valuePtr = &it->second;
-			}
+		auto id = m_template->parameterID(name);
+		AGX_ASSERT_X(id != INVALID_MATERIAL_PARAMETER, "Material parameter not found");
+		return queryParameter(id);
+	}
 
-			if (auto texture = std::get_if<std::shared_ptr<Texture>>(valuePtr))
+	auto MaterialInstance::queryParameter(MaterialParameterID id) const -> MaterialParameter::Value
+	{
+		const auto& param = m_template->parameter(id);
+		return std::visit([&](auto&& defaultValue) -> MaterialParameter::Value {
+			using T = std::decay_t<decltype(defaultValue)>;
+			if constexpr (std::is_same_v<T, std::shared_ptr<Texture>>)
 			{
-				auto handle = (*texture)->sampledDescriptorHandle();
-				AGX_ASSERT_X(handle.isValid(), "Invalid texture descriptor handle in MaterialInstance!");
-				m_uniformBuffer.write(&handle, info.size, info.offset, index);
+				const auto& texture = m_textures[param.binding - 1];
+				return texture ? texture : defaultValue;
 			}
 			else
 			{
-				m_uniformBuffer.write(valuePtr, info.size, info.offset, index);
+				T value;
+				m_template->parameterPool().read(m_parameterIndex, param.offset, &value, param.size);
+				return value;
 			}
+		}, param.defaultValue);
+	}
+
+	void MaterialInstance::setParameter(const std::string& name, const MaterialParameter::Value& value)
+	{
+		auto id = m_template->parameterID(name);
+		AGX_ASSERT_X(id != INVALID_MATERIAL_PARAMETER, "Material parameter not found");
+		setParameter(id, value);
+	}
+
+	void MaterialInstance::setParameter(MaterialParameterID id, const MaterialParameter::Value& value)
+	{
+		const auto& param = m_template->parameter(id);
+		if (auto texture = std::get_if<std::shared_ptr<Texture>>(&value))
+		{
+			AGX_ASSERT_X(*texture && (*texture)->sampledDescriptorHandle().isValid(), "Invalid texture descriptor handle in MaterialInstance!");
+			m_textures[param.binding - 1] = *texture;
 		}
-		
-		m_dirtyFlags[index] = false;
+
+		m_template->parameterPool().modify(m_parameterIndex, [&](uint8_t* blob) {
+			MaterialTemplate::writeParameter(blob, param, value);
+			});
 	}
 }
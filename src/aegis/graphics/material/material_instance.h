@@ -3,7 +3,8 @@
 #include "core/asset.h"
 #include "graphics/descriptors.h"
 #include "graphics/material/material_template.h"
-#include "graphics/bindless/bindless_buffer.h"
+
+#include <cstring>
 
 namespace Aegis::Graphics
 {
@@ -18,7 +19,7 @@ namespace Aegis::Graphics
 		MaterialInstance(std::shared_ptr<MaterialTemplate> materialTemplate);
 		MaterialInstance(const MaterialInstance&) = delete;
 		MaterialInstance(MaterialInstance&&) = delete;
-		~MaterialInstance() = default;
+		~MaterialInstance();
 
 		auto operator=(const MaterialInstance&) -> MaterialInstance& = delete;
 		auto operator=(MaterialInstance&&) noexcept -> MaterialInstance& = delete;
@@ -31,15 +32,27 @@ namespace Aegis::Graphics
 
 		[[nodiscard]] auto materialTemplate() const -> std::shared_ptr<MaterialTemplate> { return m_template; }
 		[[nodiscard]] auto queryParameter(const std::string& name) const -> MaterialParameter::Value;
-		[[nodiscard]] auto buffer() const -> const BindlessFrameBuffer& { return m_uniformBuffer; }
+		[[nodiscard]] auto queryParameter(MaterialParameterID id) const -> MaterialParameter::Value;
+		[[nodiscard]] auto parameterIndex() const -> uint32_t { return m_parameterIndex; }
 
 		void setParameter(const std::string& name, const MaterialParameter::Value& value);
-		void updateParameters(int index);
+		void setParameter(MaterialParameterID id, const MaterialParameter::Value& value);
+
+		/// @brief Fast path for plain values, writes directly into the parameter pool
+		template<typename T>
+			requires (!std::is_same_v<T, std::shared_ptr<Texture>> && !std::is_same_v<T, MaterialParameter::Value>)
+		void setParameter(MaterialParameterID id, const T& value)
+		{
+			const auto& param = m_template->parameter(id);
+			AGX_ASSERT_X(std::holds_alternative<T>(param.defaultValue), "Material parameter type mismatch");
+			m_template->parameterPool().modify(m_parameterIndex, [&](uint8_t* blob) {
+				std::memcpy(blob + param.offset, &value, param.size);
+				});
+		}
 
 	private:
 		std::shared_ptr<MaterialTemplate> m_template;
-		std::unordered_map<std::string, MaterialParameter::Value> m_overrides;
-		BindlessFrameBuffer m_uniformBuffer;
-		std::array<bool, MAX_FRAMES_IN_FLIGHT> m_dirtyFlags;
+		std::vector<std::shared_ptr<Texture>> m_textures; // Keeps overridden textures alive (indexed by binding - 1)
+		uint32_t m_parameterIndex;
 	};
 }
@@ -0,0 +1,129 @@
+#include "pch.h"
+#include "material_parameter_pool.h"
+
+#include <cstring>
+
+namespace Aegis::Graphics
+{
+	MaterialParameterPool::MaterialParameterPool(size_t stride, uint32_t capacity) :
+		m_stride{ stride },
+		m_capacity{ capacity }
+	{
+		AGX_ASSERT_X(m_capacity > 0, "Material parameter pool requires a non-zero capacity");
+
+		m_data.resize(m_stride * m_capacity, 0);
+		m_freeSlots.reserve(m_capacity);
+		for (uint32_t slot = m_capacity; slot > 0; slot--)
+		{
+			m_freeSlots.emplace_back(slot - 1);
+		}
+	}
+
+	auto MaterialParameterPool::handle(uint32_t frameIndex) const -> DescriptorHandle
+	{
+		AGX_ASSERT_X(m_buffer, "Material parameter pool has not been uploaded yet");
+		return m_buffer->handle(frameIndex);
+	}
+
+	void MaterialParameterPool::setStride(size_t stride)
+	{
+		std::lock_guard lock{ m_mutex };
+		AGX_ASSERT_X(m_size == 0 && !m_buffer, "Cannot change the stride after slots were allocated");
+
+		m_stride = stride;
+		m_data.assign(m_stride * m_capacity, 0);
+	}
+
+	auto MaterialParameterPool::allocate() -> uint32_t
+	{
+		std::lock_guard lock{ m_mutex };
+		AGX_ASSERT_X(m_stride > 0, "Material parameter pool requires a non-zero stride");
+		if (m_freeSlots.empty())
+			grow();
+
+		uint32_t slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+		m_size++;
+		return slot;
+	}
+
+	void MaterialParameterPool::free(uint32_t slot)
+	{
+		std::lock_guard lock{ m_mutex };
+		AGX_ASSERT_X(slot < m_capacity, "Material parameter slot out of range");
+		AGX_ASSERT_X(m_size > 0, "Material parameter pool is already empty");
+
+		// The GPU copies of the slot are left untouched, they are only read again after the slot is reused
+		m_freeSlots.emplace_back(slot);
+		m_size--;
+	}
+
+	void MaterialParameterPool::read(uint32_t slot, size_t offset, void* data, size_t size) const
+	{
+		std::lock_guard lock{ m_mutex };
+		AGX_ASSERT_X(slot < m_capacity && offset + size <= m_stride, "Material parameter read out of range");
+		std::memcpy(data, m_data.data() + slot * m_stride + offset, size);
+	}
+
+	void MaterialParameterPool::markDirty(uint32_t slot)
+	{
+		for (auto& range : m_dirtyRanges)
+		{
+			range.first = std::min(range.first, slot);
+			range.last = std::max(range.last, slot + 1);
+		}
+	}
+
+	void MaterialParameterPool::upload(uint32_t frameIndex)
+	{
+		AGX_ASSERT_X(frameIndex < MAX_FRAMES_IN_FLIGHT, "Frame index out of range");
+
+		std::lock_guard lock{ m_mutex };
+
+		// No instance was created yet, the layout of the template may still change
+		if (m_size == 0 && !m_buffer)
+			return;
+
+		if (m_bufferOutdated)
+		{
+			createBuffer();
+			for (auto& range : m_dirtyRanges)
+			{
+				range = DirtyRange{ 0, m_capacity };
+			}
+		}
+
+		auto& range = m_dirtyRanges[frameIndex];
+		if (range.first >= range.last)
+			return;
+
+		VkDeviceSize offset = range.first * m_stride;
+		VkDeviceSize size = (range.last - range.first) * m_stride;
+		m_buffer->write(m_data.data() + offset, size, offset, frameIndex);
+		range = DirtyRange{};
+	}
+
+	void MaterialParameterPool::grow()
+	{
+		uint32_t oldCapacity = m_capacity;
+		m_capacity *= 2;
+		m_data.resize(m_stride * m_capacity, 0);
+		for (uint32_t slot = m_capacity; slot > oldCapacity; slot--)
+		{
+			m_freeSlots.emplace_back(slot - 1);
+		}
+
+		// Recreated on the next upload, the old buffer is destroyed deferred so frames in flight can still read it
+		m_bufferOutdated = true;
+	}
+
+	void MaterialParameterPool::createBuffer()
+	{
+		auto bufferInfo = Buffer::storageBuffer(m_stride * m_capacity, MAX_FRAMES_IN_FLIGHT);
+		bufferInfo.allocFlags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+		bufferInfo.category = MemoryCategory::Material;
+
+		m_buffer = std::make_unique<BindlessFrameBuffer>(bufferInfo);
+		m_bufferOutdated = false;
+	}
+}
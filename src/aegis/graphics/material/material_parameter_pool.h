@@ -0,0 +1,76 @@
+#pragma once
+
+#include "graphics/bindless/bindless_buffer.h"
+
+#include <mutex>
+
+namespace Aegis::Graphics
+{
+	/// @brief Packs the parameter blocks of all instances of a material template into one storage buffer
+	/// @note Slots are suballocated from a free-list, edits are tracked as dirty slot ranges and uploaded once per frame
+	/// @note The blocks are only accessed under the lock (see modify and read), the render thread uploads them while the
+	///       main thread edits parameters
+	class MaterialParameterPool
+	{
+	public:
+		static constexpr uint32_t INITIAL_CAPACITY = 64;
+
+		/// @brief The stride can be set later, as long as no slot was allocated (the template layout is still built)
+		explicit MaterialParameterPool(size_t stride = 0, uint32_t capacity = INITIAL_CAPACITY);
+		MaterialParameterPool(const MaterialParameterPool&) = delete;
+		MaterialParameterPool(MaterialParameterPool&&) = delete;
+		~MaterialParameterPool() = default;
+
+		auto operator=(const MaterialParameterPool&) -> MaterialParameterPool& = delete;
+		auto operator=(MaterialParameterPool&&) -> MaterialParameterPool& = delete;
+
+		[[nodiscard]] auto stride() const -> size_t { return m_stride; }
+		[[nodiscard]] auto capacity() const -> uint32_t { return m_capacity; }
+		[[nodiscard]] auto size() const -> uint32_t { return m_size; }
+		[[nodiscard]] auto handle(uint32_t frameIndex) const -> DescriptorHandle;
+
+		void setStride(size_t stride);
+
+		/// @brief Returns a free slot (grows the pool if needed)
+		[[nodiscard]] auto allocate() -> uint32_t;
+		void free(uint32_t slot);
+
+		/// @brief Calls 'modifier' with the block of the slot while locked and flags the slot for upload
+		template<typename F>
+		void modify(uint32_t slot, F&& modifier)
+		{
+			std::lock_guard lock{ m_mutex };
+			AGX_ASSERT_X(slot < m_capacity, "Material parameter slot out of range");
+			modifier(m_data.data() + slot * m_stride);
+			markDirty(slot);
+		}
+
+		/// @brief Copies 'size' bytes at 'offset' of the block of the slot into 'data'
+		void read(uint32_t slot, size_t offset, void* data, size_t size) const;
+
+		/// @brief Copies the dirty slot range of the frame to the GPU buffer
+		void upload(uint32_t frameIndex);
+
+	private:
+		struct DirtyRange
+		{
+			uint32_t first{ std::numeric_limits<uint32_t>::max() };
+			uint32_t last{ 0 };
+		};
+
+		/// @brief Flags the slot for upload in every frame in flight (requires the lock)
+		void markDirty(uint32_t slot);
+		void grow();
+		void createBuffer();
+
+		size_t m_stride;
+		uint32_t m_capacity;
+		uint32_t m_size{ 0 };
+		std::vector<uint8_t> m_data;
+		std::vector<uint32_t> m_freeSlots;
+		std::array<DirtyRange, MAX_FRAMES_IN_FLIGHT> m_dirtyRanges;
+		std::unique_ptr<BindlessFrameBuffer> m_buffer;
+		bool m_bufferOutdated{ true };
+		mutable std::mutex m_mutex;
+	};
+}
@@ -3,6 +3,8 @@
 
 #include "engine.h"
 
+#include <cstring>
+
 namespace Aegis::Graphics
 {
 	MaterialTemplate::MaterialTemplate(Pipeline pipeline)
@@ -10,6 +12,12 @@ namespace Aegis::Graphics
 	{
 	}
 
+	MaterialTemplate::MaterialTemplate(std::future<Pipeline> pipeline)
+		: m_pendingPipeline{ std::move(pipeline) }
+	{
+		AGX_ASSERT_X(m_pendingPipeline.valid(), "Material template requires a valid pipeline future");
+	}
+
 	auto MaterialTemplate::alignTo(size_t size, size_t alignment) -> size_t
 	{
 		return (size + alignment - 1) & ~(alignment - 1);
@@ -55,16 +63,37 @@ namespace Aegis::Graphics
 
 
 
+	auto MaterialTemplate::isReady() -> bool
+	{
+		if (!m_pendingPipeline.valid())
+			return true;
+
+		if (m_pendingPipeline.wait_for(std::chrono::seconds{ 0 }) != std::future_status::ready)
+			return false;
+
+		m_pipeline = m_pendingPipeline.get();
+		return true;
+	}
+
 	auto MaterialTemplate::hasParameter(const std::string& name) const -> bool
 	{
-		return m_parameters.contains(name);
+		return m_parameterIDs.contains(name);
+	}
+
+	auto MaterialTemplate::parameterID(const std::string& name) const -> MaterialParameterID
+	{
+		auto it = m_parameterIDs.find(name);
+		if (it != m_parameterIDs.end())
+			return it->second;
+
+		return INVALID_MATERIAL_PARAMETER;
 	}
 
 	auto MaterialTemplate::queryDefaultParameter(const std::string& name) const -> MaterialParameter::Value
 	{
-		auto it = m_parameters.find(name);
-		if (it != m_parameters.end())
-			return it->second.defaultValue;
+		auto it = m_parameterIDs.find(name);
+		if (it != m_parameterIDs.end())
+			return m_parameters[it->second].defaultValue;
 
 		AGX_ASSERT_X(false, "Material parameter not found");
 		return {};
@@ -72,9 +101,11 @@ namespace Aegis::Graphics
 
 	void MaterialTemplate::addParameter(const std::string& name, const MaterialParameter::Value& defaultValue)
 	{
-		AGX_ASSERT_X(!m_parameters.contains(name), "Material parameter already exists");
+		AGX_ASSERT_X(!m_parameterIDs.contains(name), "Material parameter already exists");
+		AGX_ASSERT_X(m_parameterPool->size() == 0, "Cannot add material parameters after instances were created");
 
 		MaterialParameter param{
+			.name = name,
 			.offset = alignTo(m_parameterSize, std430Alignment(defaultValue)),
 			.size = std430Size(defaultValue),
 			.defaultValue = defaultValue,
@@ -84,16 +115,44 @@ namespace Aegis::Graphics
 		{
 			m_textureCount++;
 			param.binding = m_textureCount;
-
-
 		}
 
 		m_parameterSize = param.offset + param.size;
-		m_parameters.emplace(name, std::move(param));
+		m_parameterAlignment = std::max(m_parameterAlignment, std430Alignment(defaultValue));
+		m_defaultBlob.resize(m_parameterSize, 0);
+		writeParameter(m_defaultBlob.data(), param, defaultValue);
+
+		m_parameterIDs.emplace(name, static_cast<MaterialParameterID>(m_parameters.size()));
+		m_parameters.emplace_back(std::move(param));
+		m_parameterPool->setStride(parameterStride());
+	}
+
+	void MaterialTemplate::updateParameters(uint32_t frameIndex)
+	{
+		m_parameterPool->upload(frameIndex);
+	}
+
+	void MaterialTemplate::writeParameter(uint8_t* blob, const MaterialParameter& param, const MaterialParameter::Value& value)
+	{
+		AGX_ASSERT_X(value.index() == param.defaultValue.index(), "Material parameter type mismatch");
+
+		std::visit([&](auto&& arg) {
+			using T = std::decay_t<decltype(arg)>;
+			if constexpr (std::is_same_v<T, std::shared_ptr<Texture>>)
+			{
+				DescriptorHandle handle = arg ? arg->sampledDescriptorHandle() : DescriptorHandle{};
+				std::memcpy(blob + param.offset, &handle, param.size);
+			}
+			else
+			{
+				std::memcpy(blob + param.offset, &arg, param.size);
+			}
+		}, value);
 	}
 
 	void MaterialTemplate::bind(VkCommandBuffer cmd)
 	{
+		AGX_ASSERT_X(!m_pendingPipeline.valid(), "Material template pipeline is still compiling");
 		m_pipeline.bind(cmd);
 	}
 
@@ -128,12 +187,13 @@ namespace Aegis::Graphics
 	void MaterialTemplate::printInfo() const
 	{
 		ALOG::info("Material Template Info:");
-		ALOG::info("  Parameter Size: {} bytes", m_parameterSize);
+		ALOG::info("  Parameter Size: {} bytes (stride {} bytes)", m_parameterSize, parameterStride());
 		ALOG::info("  Parameters:");
-		for (const auto& [name, param] : m_parameters)
+		for (MaterialParameterID id = 0; id < m_parameters.size(); id++)
 		{
-			ALOG::info("    Name: {}, Binding: {}, Offset: {}, Size: {}",
-				name, param.binding, param.offset, param.size);
+			const auto& param = m_parameters[id];
+			ALOG::info("    ID: {}, Name: {}, Binding: {}, Offset: {}, Size: {}",
+				id, param.name, param.binding, param.offset, param.size);
 		}
 	}
 }
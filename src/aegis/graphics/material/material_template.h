@@ -2,6 +2,7 @@
 
 #include "core/asset.h"
 #include "graphics/descriptors.h"
+#include "graphics/material/material_parameter_pool.h"
 #include "graphics/pipeline.h"
 #include "graphics/resources/static_mesh.h"
 #include "graphics/resources/texture.h"
@@ -11,12 +12,16 @@
 
 namespace Aegis::Graphics
 {
-	enum class MaterialType
+	enum class MaterialType : uint32_t
 	{
 		Opaque,
 		Transparent
 	};
 
+	/// @brief Index of a parameter in its template (resolve once via MaterialTemplate::parameterID)
+	using MaterialParameterID = uint32_t;
+	static constexpr MaterialParameterID INVALID_MATERIAL_PARAMETER = std::numeric_limits<MaterialParameterID>::max();
+
 	struct MaterialParameter
 	{
 		using Value = std::variant<
@@ -29,6 +34,7 @@ namespace Aegis::Graphics
 			std::shared_ptr<Texture>
 		>;
 
+		std::string name;
 		uint32_t binding = 0;
 		size_t offset = 0;
 		size_t size = 0;
@@ -40,21 +46,43 @@ namespace Aegis::Graphics
 	public:
 		MaterialTemplate(Pipeline pipeline);
 
+		/// @brief Creates the template while its pipeline is still compiled in the background (see Pipeline::GraphicsBuilder::buildAsync)
+		/// @note Check isReady before drawing with the template
+		MaterialTemplate(std::future<Pipeline> pipeline);
+
 		[[nodiscard]] static auto alignTo(size_t size, size_t alignment) -> size_t;
 		[[nodiscard]] static auto std430Alignment(const MaterialParameter::Value& val) -> size_t;
 		[[nodiscard]] static auto std430Size(const MaterialParameter::Value& val) -> size_t;
 
 		[[nodiscard]] auto pipeline() const -> const Pipeline& { return m_pipeline; }
 		[[nodiscard]] auto parameterSize() const -> size_t { return m_parameterSize; }
-		[[nodiscard]] auto parameters() const -> const std::unordered_map<std::string, MaterialParameter>& { return m_parameters; }
+		[[nodiscard]] auto parameterStride() const -> size_t { return alignTo(m_parameterSize, m_parameterAlignment); }
+		[[nodiscard]] auto parameters() const -> const std::vector<MaterialParameter>& { return m_parameters; }
+		[[nodiscard]] auto parameter(MaterialParameterID id) const -> const MaterialParameter& { return m_parameters[id]; }
+		[[nodiscard]] auto defaultBlob() const -> const std::vector<uint8_t>& { return m_defaultBlob; }
+		[[nodiscard]] auto textureCount() const -> uint32_t { return m_textureCount; }
 		[[nodiscard]] auto drawBatch() const -> uint32_t { return m_drawBatchId; }
 		[[nodiscard]] auto type() const -> MaterialType { return m_materialType; }
 
+		/// @brief Returns true once the pipeline finished compiling
+		[[nodiscard]] auto isReady() -> bool;
+
 		[[nodiscard]] auto hasParameter(const std::string& name) const -> bool;
+		[[nodiscard]] auto parameterID(const std::string& name) const -> MaterialParameterID;
 		[[nodiscard]] auto queryDefaultParameter(const std::string& name) const -> MaterialParameter::Value;
 		void addParameter(const std::string& name, const MaterialParameter::Value& defaultValue);
 
 		void setDrawBatchId(uint32_t id) { m_drawBatchId = id; }
+		void setType(MaterialType type) { m_materialType = type; }
+
+		/// @brief Returns the pool holding the parameter blocks of all instances (the layout is frozen once an instance exists)
+		[[nodiscard]] auto parameterPool() -> MaterialParameterPool& { return *m_parameterPool; }
+
+		/// @brief Uploads the parameter blocks modified since the frame was last updated
+		void updateParameters(uint32_t frameIndex);
+
+		/// @brief Writes the value into a parameter blob using the compiled std430 layout
+		static void writeParameter(uint8_t* blob, const MaterialParameter& param, const MaterialParameter::Value& value);
 
 		void bind(VkCommandBuffer cmd);
 		void bindBindlessSet(VkCommandBuffer cmd);
@@ -68,9 +96,14 @@ namespace Aegis::Graphics
 		// TODO: Store multiple pipelines for different render passes
 		// TODO: Create pipeline on demand based on render pass
 		Pipeline m_pipeline;
+		std::future<Pipeline> m_pendingPipeline;
 
-		std::unordered_map<std::string, MaterialParameter> m_parameters;
+		std::vector<MaterialParameter> m_parameters;
+		std::unordered_map<std::string, MaterialParameterID> m_parameterIDs;
+		std::vector<uint8_t> m_defaultBlob;
+		std::unique_ptr<MaterialParameterPool> m_parameterPool{ std::make_unique<MaterialParameterPool>() }; // Created eagerly, the render thread reads it
 		size_t m_parameterSize{ 0 };
+		size_t m_parameterAlignment{ 4 };
 		uint32_t m_textureCount{ 0 };
 		uint32_t m_drawBatchId{ 0 };
 		MaterialType m_materialType{ MaterialType::Opaque };
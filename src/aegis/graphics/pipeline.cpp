@@ -1,25 +1,20 @@
 #include "pch.h"
 #include "pipeline.h"
 
+#include "core/thread_pool.h"
 #include "graphics/resources/static_mesh.h"
 #include "graphics/vulkan/vulkan_context.h"
 #include "graphics/vulkan/vulkan_tools.h"
+#include "utils/timer.h"
 
 namespace Aegis::Graphics
 {
 	// Pipeline::GraphicsBuilder -------------------------------------------------
 
-	Pipeline::GraphicsBuilder::GraphicsBuilder()
+	Pipeline::GraphicsBuilder::GraphicsBuilder() :
+		m_graphicsConfig{ std::make_unique<GraphicsConfig>() }
 	{
-		Pipeline::defaultGraphicsPipelineConfig(m_graphicsConfig);
-	}
-
-	Pipeline::GraphicsBuilder::~GraphicsBuilder()
-	{
-		for (const auto& module : m_shaderModules)
-		{
-			vkDestroyShaderModule(VulkanContext::device(), module, nullptr);
-		}
+		Pipeline::defaultGraphicsPipelineConfig(*m_graphicsConfig);
 	}
 
 	auto Pipeline::GraphicsBuilder::addDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout) -> GraphicsBuilder&
@@ -40,16 +35,14 @@ namespace Aegis::Graphics
 
 	auto Pipeline::GraphicsBuilder::addShaderStage(VkShaderStageFlagBits stage, const std::filesystem::path& shaderPath) -> Pipeline::GraphicsBuilder&
 	{
-		VkShaderModule shaderModule = Tools::createShaderModule(VulkanContext::device(), shaderPath);
-		m_shaderModules.emplace_back(shaderModule);
+		VkShaderModule shaderModule = VulkanContext::pipelineCache().shaderModule(shaderPath);
 		addShaderStage(stage, shaderModule, "main");
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::addShaderStages(VkShaderStageFlags stages, const std::filesystem::path& shaderPath) -> GraphicsBuilder&
 	{
-		VkShaderModule shaderModule = Tools::createShaderModule(VulkanContext::device(), shaderPath);
-		m_shaderModules.emplace_back(shaderModule);
+		VkShaderModule shaderModule = VulkanContext::pipelineCache().shaderModule(shaderPath);
 
 		if (stages & VK_SHADER_STAGE_VERTEX_BIT)
 			addShaderStage(VK_SHADER_STAGE_VERTEX_BIT, shaderModule, "vertexMain");
@@ -72,9 +65,9 @@ namespace Aegis::Graphics
 
 	auto Pipeline::GraphicsBuilder::addColorAttachment(VkFormat colorFormat, bool alphaBlending) -> Pipeline::GraphicsBuilder&
 	{
-		m_graphicsConfig.colorAttachmentFormats.emplace_back(colorFormat);
-		m_graphicsConfig.renderingInfo.colorAttachmentCount = static_cast<uint32_t>(m_graphicsConfig.colorAttachmentFormats.size());
-		m_graphicsConfig.renderingInfo.pColorAttachmentFormats = m_graphicsConfig.colorAttachmentFormats.data();
+		m_graphicsConfig->colorAttachmentFormats.emplace_back(colorFormat);
+		m_graphicsConfig->renderingInfo.colorAttachmentCount = static_cast<uint32_t>(m_graphicsConfig->colorAttachmentFormats.size());
+		m_graphicsConfig->renderingInfo.pColorAttachmentFormats = m_graphicsConfig->colorAttachmentFormats.data();
 
 		VkPipelineColorBlendAttachmentState colorBlendAttachment{};
 		colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
@@ -93,10 +86,10 @@ namespace Aegis::Graphics
 			colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
 		}
 
-		m_graphicsConfig.colorBlendAttachments.emplace_back(colorBlendAttachment);
+		m_graphicsConfig->colorBlendAttachments.emplace_back(colorBlendAttachment);
 
-		m_graphicsConfig.colorBlendInfo.attachmentCount = m_graphicsConfig.renderingInfo.colorAttachmentCount;
-		m_graphicsConfig.colorBlendInfo.pAttachments = m_graphicsConfig.colorBlendAttachments.data();
+		m_graphicsConfig->colorBlendInfo.attachmentCount = m_graphicsConfig->renderingInfo.colorAttachmentCount;
+		m_graphicsConfig->colorBlendInfo.pAttachments = m_graphicsConfig->colorBlendAttachments.data();
 
 		return *this;
 	}
@@ -104,62 +97,73 @@ namespace Aegis::Graphics
 
 	auto Pipeline::GraphicsBuilder::setDepthAttachment(VkFormat depthFormat) -> Pipeline::GraphicsBuilder&
 	{
-		m_graphicsConfig.renderingInfo.depthAttachmentFormat = depthFormat;
+		m_graphicsConfig->renderingInfo.depthAttachmentFormat = depthFormat;
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::setStencilFormat(VkFormat stencilFormat) -> Pipeline::GraphicsBuilder&
 	{
-		m_graphicsConfig.renderingInfo.stencilAttachmentFormat = stencilFormat;
+		m_graphicsConfig->renderingInfo.stencilAttachmentFormat = stencilFormat;
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::setDepthTest(bool enableDepthTest, bool writeDepth, VkCompareOp compareOp) -> Pipeline::GraphicsBuilder&
 	{
-		m_graphicsConfig.depthStencilInfo.depthTestEnable = enableDepthTest;
-		m_graphicsConfig.depthStencilInfo.depthWriteEnable = writeDepth;
-		m_graphicsConfig.depthStencilInfo.depthCompareOp = compareOp;
+		m_graphicsConfig->depthStencilInfo.depthTestEnable = enableDepthTest;
+		m_graphicsConfig->depthStencilInfo.depthWriteEnable = writeDepth;
+		m_graphicsConfig->depthStencilInfo.depthCompareOp = compareOp;
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::setCullMode(VkCullModeFlags cullMode) -> Pipeline::GraphicsBuilder&
 	{
-		m_graphicsConfig.rasterizationInfo.cullMode = cullMode;
+		m_graphicsConfig->rasterizationInfo.cullMode = cullMode;
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::setVertexBindingDescriptions(const std::vector<VkVertexInputBindingDescription>& bindingDescriptions) -> Pipeline::GraphicsBuilder&
 	{
-		m_graphicsConfig.bindingDescriptions = bindingDescriptions;
+		m_graphicsConfig->bindingDescriptions = bindingDescriptions;
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::setVertexAttributeDescriptions(const std::vector<VkVertexInputAttributeDescription>& attributeDescriptions)
 		-> Pipeline::GraphicsBuilder&
 	{
-		m_graphicsConfig.attributeDescriptions = attributeDescriptions;
+		m_graphicsConfig->attributeDescriptions = attributeDescriptions;
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::addFlag(Flags flag) -> GraphicsBuilder&
 	{
-		m_graphicsConfig.flags = static_cast<Flags>(static_cast<uint32_t>(m_graphicsConfig.flags) | static_cast<uint32_t>(flag));
+		m_graphicsConfig->flags = static_cast<Flags>(static_cast<uint32_t>(m_graphicsConfig->flags) | static_cast<uint32_t>(flag));
 		return *this;
 	}
 
 	auto Pipeline::GraphicsBuilder::buildUnique() -> std::unique_ptr<Pipeline>
 	{
-		return std::make_unique<Pipeline>(m_layoutConfig, m_graphicsConfig);
+		AGX_ASSERT_X(m_graphicsConfig, "Pipeline builder was already consumed by buildAsync");
+		return std::make_unique<Pipeline>(m_layoutConfig, *m_graphicsConfig);
 	}
 
 	auto Pipeline::GraphicsBuilder::build() -> Pipeline
 	{
-		return Pipeline{ m_layoutConfig, m_graphicsConfig };
+		AGX_ASSERT_X(m_graphicsConfig, "Pipeline builder was already consumed by buildAsync");
+		return Pipeline{ m_layoutConfig, *m_graphicsConfig };
+	}
+
+	auto Pipeline::GraphicsBuilder::buildAsync() -> std::future<Pipeline>
+	{
+		AGX_ASSERT_X(m_graphicsConfig, "Pipeline builder was already consumed by buildAsync");
+		return Core::ThreadPool::instance().submit(
+			[layoutConfig = std::move(m_layoutConfig), graphicsConfig = std::move(m_graphicsConfig)]() {
+				return Pipeline{ layoutConfig, *graphicsConfig };
+			});
 	}
 
 	void Pipeline::GraphicsBuilder::addShaderStage(VkShaderStageFlagBits stage, VkShaderModule shaderModule, const char* entryPoint)
 	{
-		m_graphicsConfig.shaderStges.emplace_back(VkPipelineShaderStageCreateInfo{
+		m_graphicsConfig->shaderStges.emplace_back(VkPipelineShaderStageCreateInfo{
 			.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
 			.stage = stage,
 			.module = shaderModule,
@@ -170,14 +174,6 @@ namespace Aegis::Graphics
 
 	// ComputeBuilder ------------------------------------------------------------
 
-	Pipeline::ComputeBuilder::~ComputeBuilder()
-	{
-		if (m_computeConfig.shaderStage.module)
-		{
-			vkDestroyShaderModule(VulkanContext::device(), m_computeConfig.shaderStage.module, nullptr);
-		}
-	}
-
 	auto Pipeline::ComputeBuilder::addDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout) -> ComputeBuilder&
 	{
 		m_layoutConfig.descriptorSetLayouts.emplace_back(descriptorSetLayout);
@@ -198,7 +194,7 @@ namespace Aegis::Graphics
 
 	auto Pipeline::ComputeBuilder::setShaderStage(const std::filesystem::path& shaderPath, const char* entry) -> Pipeline::ComputeBuilder&
 	{
-		VkShaderModule shaderModule = Tools::createShaderModule(VulkanContext::device(), shaderPath);
+		VkShaderModule shaderModule = VulkanContext::pipelineCache().shaderModule(shaderPath);
 		m_computeConfig.shaderStage = Tools::createShaderStage(VK_SHADER_STAGE_COMPUTE_BIT, shaderModule, entry);
 		return *this;
 	}
@@ -213,6 +209,14 @@ namespace Aegis::Graphics
 		return Pipeline{ m_layoutConfig, m_computeConfig };
 	}
 
+	auto Pipeline::ComputeBuilder::buildAsync() -> std::future<Pipeline>
+	{
+		return Core::ThreadPool::instance().submit(
+			[layoutConfig = std::move(m_layoutConfig), computeConfig = m_computeConfig]() {
+				return Pipeline{ layoutConfig, computeConfig };
+			});
+	}
+
 	// Pipeline ------------------------------------------------------------------
 
 	Pipeline::Pipeline(const LayoutConfig& layoutConfig, const GraphicsConfig& graphicsConfig)
@@ -385,7 +389,10 @@ namespace Aegis::Graphics
 			.basePipelineIndex = -1,
 		};
 
-		VK_CHECK(vkCreateGraphicsPipelines(VulkanContext::device(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_pipeline));
+		Timer timer;
+		auto& cache = VulkanContext::pipelineCache();
+		VK_CHECK(vkCreateGraphicsPipelines(VulkanContext::device(), cache, 1, &pipelineInfo, nullptr, &m_pipeline));
+		cache.addPipelineTime(timer.elapsedMillis());
 	}
 
 	void Pipeline::createComputePipeline(const ComputeConfig& config)
@@ -400,7 +407,10 @@ namespace Aegis::Graphics
 			.basePipelineIndex = -1,
 		};
 
-		VK_CHECK(vkCreateComputePipelines(VulkanContext::device(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_pipeline));
+		Timer timer;
+		auto& cache = VulkanContext::pipelineCache();
+		VK_CHECK(vkCreateComputePipelines(VulkanContext::device(), cache, 1, &pipelineInfo, nullptr, &m_pipeline));
+		cache.addPipelineTime(timer.elapsedMillis());
 	}
 
 	void Pipeline::destroy()
@@ -2,6 +2,8 @@
 
 #include "graphics/vulkan/volk_include.h"
 
+#include <future>
+
 namespace Aegis::Graphics
 {
 	class Pipeline
@@ -47,7 +49,7 @@ namespace Aegis::Graphics
 		{
 		public:
 			GraphicsBuilder();
-			~GraphicsBuilder();
+			~GraphicsBuilder() = default;
 
 			auto addDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout) -> GraphicsBuilder&;
 			auto addPushConstantRange(VkShaderStageFlags stageFlags, uint32_t size, uint32_t offset = 0) -> GraphicsBuilder&;
@@ -66,12 +68,14 @@ namespace Aegis::Graphics
 			auto buildUnique() -> std::unique_ptr<Pipeline>;
 			auto build() -> Pipeline;
 
+			/// @brief Compiles the pipeline on the thread pool (the builder can't be used afterwards)
+			auto buildAsync() -> std::future<Pipeline>;
+
 		private:
 			void addShaderStage(VkShaderStageFlagBits stage, VkShaderModule shaderModule, const char* entryPoint);
 
 			LayoutConfig m_layoutConfig;
-			GraphicsConfig m_graphicsConfig;
-			std::vector<VkShaderModule> m_shaderModules;
+			std::unique_ptr<GraphicsConfig> m_graphicsConfig; // Heap allocated so the internal pointers survive moving it to a worker
 		};
 
 		struct ComputeConfig
@@ -83,7 +87,7 @@ namespace Aegis::Graphics
 		{
 		public:
 			ComputeBuilder() = default;
-			~ComputeBuilder();
+			~ComputeBuilder() = default;
 
 			auto addDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout) -> ComputeBuilder&;
 			auto addPushConstantRange(VkShaderStageFlags stageFlags, uint32_t size) -> ComputeBuilder&;
@@ -93,6 +97,9 @@ namespace Aegis::Graphics
 			auto buildUnique() -> std::unique_ptr<Pipeline>;
 			auto build() -> Pipeline;
 
+			/// @brief Compiles the pipeline on the thread pool (the builder can't be used afterwards)
+			auto buildAsync() -> std::future<Pipeline>;
+
 		private:
 			LayoutConfig m_layoutConfig;
 			ComputeConfig m_computeConfig;
@@ -0,0 +1,148 @@
+#include "pch.h"
+#include "profile_capture.h"
+
+#include "core/profiler.h"
+#include "utils/file.h"
+
+#include <format>
+
+namespace Aegis::Graphics
+{
+	namespace
+	{
+		auto writeText(const std::filesystem::path& path, const std::string& text) -> bool
+		{
+			std::error_code error;
+			std::filesystem::create_directories(path.parent_path(), error);
+			if (!File::writeBinary(path, std::vector<char>(text.begin(), text.end())))
+			{
+				ALOG::warn("Profile capture: Failed to write '{}'", path.string());
+				return false;
+			}
+			return true;
+		}
+
+		auto optionalValue(const std::optional<double>& value, std::string_view empty) -> std::string
+		{
+			return value ? std::format("{:.4f}", *value) : std::string{ empty };
+		}
+	}
+
+	void ProfileCapture::start(uint32_t frameCount)
+	{
+		AGX_ASSERT_X(frameCount > 0, "Profile capture needs at least one frame");
+
+		std::lock_guard lock{ m_mutex };
+
+		m_frames.clear();
+		m_firstFrame = GPUTimerManager::instance().frameNumber() + 1;
+		m_frameCount = frameCount;
+		m_completedFrames = 0;
+		m_capturing = true;
+	}
+
+	void ProfileCapture::recordCPU(uint64_t frameNumber)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (!m_capturing || frameNumber < m_firstFrame || frameNumber >= m_firstFrame + m_frameCount)
+			return;
+
+		auto& frame = m_frames[frameNumber];
+		for (const auto& [name, times] : Profiler::instance().times())
+		{
+			frame.samples[name].cpuMs = times.latest();
+		}
+	}
+
+	void ProfileCapture::recordGPU(uint64_t frameNumber, const std::vector<GPUTimingResult>& timings)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (!m_capturing)
+			return;
+
+		auto it = m_frames.find(frameNumber);
+		if (it == m_frames.end() || it->second.complete)
+			return;
+
+		auto& frame = it->second;
+		for (const auto& timing : timings)
+		{
+			auto& sample = frame.samples[timing.name];
+			sample.gpuMs = sample.gpuMs.value_or(0.0) + timing.timeMs;
+			if (timing.statistics)
+				sample.statistics = timing.statistics;
+		}
+		frame.complete = true;
+
+		if (++m_completedFrames == m_frameCount)
+		{
+			finish();
+		}
+	}
+
+	auto ProfileCapture::writeCSV(const std::filesystem::path& path) const -> bool
+	{
+		std::string csv = "frame,name,cpu_ms,gpu_ms,clipping_primitives,fragment_invocations,compute_invocations,task_invocations,mesh_invocations\n";
+		auto out = std::back_inserter(csv);
+		for (const auto& [frameNumber, frame] : m_frames)
+		{
+			for (const auto& [name, sample] : frame.samples)
+			{
+				std::format_to(out, "{},\"{}\",{},{}", frameNumber, name, optionalValue(sample.cpuMs, ""), optionalValue(sample.gpuMs, ""));
+				if (sample.statistics)
+				{
+					const auto& stats = *sample.statistics;
+					std::format_to(out, ",{},{},{},{},{}\n", stats.clippingPrimitives, stats.fragmentInvocations,
+						stats.computeInvocations, stats.taskInvocations, stats.meshInvocations);
+				}
+				else
+				{
+					std::format_to(out, ",,,,,\n");
+				}
+			}
+		}
+		return writeText(path, csv);
+	}
+
+	auto ProfileCapture::writeJSON(const std::filesystem::path& path) const -> bool
+	{
+		std::string json = "{\n\t\"frames\": [\n";
+		auto out = std::back_inserter(json);
+		for (auto frameIt = m_frames.begin(); frameIt != m_frames.end(); ++frameIt)
+		{
+			const auto& [frameNumber, frame] = *frameIt;
+			std::format_to(out, "\t\t{{ \"frame\": {}, \"samples\": [\n", frameNumber);
+			for (auto sampleIt = frame.samples.begin(); sampleIt != frame.samples.end(); ++sampleIt)
+			{
+				const auto& [name, sample] = *sampleIt;
+				std::format_to(out, "\t\t\t{{ \"name\": \"{}\", \"cpuMs\": {}, \"gpuMs\": {}",
+					name, optionalValue(sample.cpuMs, "null"), optionalValue(sample.gpuMs, "null"));
+				if (sample.statistics)
+				{
+					const auto& stats = *sample.statistics;
+					std::format_to(out, ", \"clippingPrimitives\": {}, \"fragmentInvocations\": {}, "
+						"\"computeInvocations\": {}, \"taskInvocations\": {}, \"meshInvocations\": {}",
+						stats.clippingPrimitives, stats.fragmentInvocations, stats.computeInvocations,
+						stats.taskInvocations, stats.meshInvocations);
+				}
+				std::format_to(out, " }}{}\n", std::next(sampleIt) != frame.samples.end() ? "," : "");
+			}
+			std::format_to(out, "\t\t] }}{}\n", std::next(frameIt) != m_frames.end() ? "," : "");
+		}
+		json += "\t]\n}\n";
+		return writeText(path, json);
+	}
+
+	void ProfileCapture::finish()
+	{
+		m_capturing = false;
+
+		// Frames that were recorded on the CPU but never resolved on the GPU are dropped
+		std::erase_if(m_frames, [](const auto& entry) { return !entry.second.complete; });
+
+		if (writeCSV() && writeJSON())
+		{
+			ALOG::info("Profile capture: Wrote {} frames to '{}' and '{}'", m_frames.size(), CSV_FILE, JSON_FILE);
+		}
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "core/globals.h"
+#include "graphics/gpu_timer.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Aegis::Graphics
+{
+	/// @brief Records CPU and GPU timings of consecutive frames and writes them to CSV and JSON files
+	/// @note GPU timings arrive MAX_FRAMES_IN_FLIGHT frames late, they are matched to the CPU timings by frame number
+	/// @note Both are recorded by the render thread, CPU timings once it finished recording the frame
+	class ProfileCapture
+	{
+	public:
+		static constexpr auto CSV_FILE = CACHE_DIR "profile_capture.csv";
+		static constexpr auto JSON_FILE = CACHE_DIR "profile_capture.json";
+
+		struct Sample
+		{
+			std::optional<double> cpuMs;
+			std::optional<double> gpuMs;
+			std::optional<GPUPipelineStatistics> statistics;
+		};
+
+		struct Frame
+		{
+			std::map<std::string, Sample> samples;
+			bool complete{ false };
+		};
+
+		ProfileCapture() = default;
+		ProfileCapture(const ProfileCapture&) = delete;
+		ProfileCapture(ProfileCapture&&) = delete;
+		~ProfileCapture() = default;
+
+		auto operator=(const ProfileCapture&) -> ProfileCapture& = delete;
+		auto operator=(ProfileCapture&&) -> ProfileCapture& = delete;
+
+		[[nodiscard]] auto isCapturing() const -> bool { return m_capturing; }
+		[[nodiscard]] auto capturedFrames() const -> uint32_t { return m_completedFrames; }
+		[[nodiscard]] auto frameCount() const -> uint32_t { return m_frameCount; }
+
+		/// @brief Captures the next 'frameCount' frames, the files are written once all of them are complete
+		void start(uint32_t frameCount);
+
+		/// @brief Adds the latest CPU timings of the profiler as timings of the given frame
+		/// @note Call once all scopes of the frame finished (before any scope of the next frame)
+		void recordCPU(uint64_t frameNumber);
+
+		/// @brief Adds the GPU timings resolved for the given frame
+		void recordGPU(uint64_t frameNumber, const std::vector<GPUTimingResult>& timings);
+
+		auto writeCSV(const std::filesystem::path& path = CSV_FILE) const -> bool;
+		auto writeJSON(const std::filesystem::path& path = JSON_FILE) const -> bool;
+
+	private:
+		void finish();
+
+		std::map<uint64_t, Frame> m_frames;
+		uint64_t m_firstFrame{ 0 };
+		uint32_t m_frameCount{ 0 };
+		uint32_t m_completedFrames{ 0 };
+		std::atomic<bool> m_capturing{ false };
+		std::mutex m_mutex;
+	};
+}
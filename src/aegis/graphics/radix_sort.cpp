@@ -0,0 +1,56 @@
+#include "pch.h"
+#include "radix_sort.h"
+
+#include <bit>
+
+namespace Aegis::Graphics
+{
+	auto RadixSort::transparentKey(uint32_t drawBatchID, float viewDepth) -> uint32_t
+	{
+		// Positive floats sort like their bit patterns, inverting them sorts far to near
+		uint32_t depthBits = std::bit_cast<uint32_t>(std::max(viewDepth, 1e-4f));
+		return (drawBatchID << 24) | (~depthBits >> 8);
+	}
+
+	auto RadixSort::groupCount(uint32_t elementCount) -> uint32_t
+	{
+		return (elementCount + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+	}
+
+	void RadixSort::sort(std::vector<uint32_t>& keys, std::vector<uint32_t>& values)
+	{
+		AGX_ASSERT_X(keys.size() == values.size(), "Radix sort needs exactly one value per key");
+
+		std::vector<uint32_t> keysOut(keys.size());
+		std::vector<uint32_t> valuesOut(values.size());
+		for (uint32_t pass = 0; pass < PASS_COUNT; pass++)
+		{
+			uint32_t shift = pass * RADIX_BITS;
+
+			// Histogram and exclusive scan of the digits
+			std::array<uint32_t, RADIX_SIZE> offsets{};
+			for (uint32_t key : keys)
+			{
+				offsets[(key >> shift) & (RADIX_SIZE - 1)]++;
+			}
+			uint32_t sum = 0;
+			for (auto& offset : offsets)
+			{
+				uint32_t count = offset;
+				offset = sum;
+				sum += count;
+			}
+
+			// Stable scatter
+			for (size_t i = 0; i < keys.size(); i++)
+			{
+				uint32_t destination = offsets[(keys[i] >> shift) & (RADIX_SIZE - 1)]++;
+				keysOut[destination] = keys[i];
+				valuesOut[destination] = values[i];
+			}
+
+			std::swap(keys, keysOut);
+			std::swap(values, valuesOut);
+		}
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "graphics/draw_batch_registry.h"
+
+namespace Aegis::Graphics
+{
+	/// @brief CPU reference of the GPU radix sort (radix_sort.slang)
+	/// @note Stable least significant digit sort of 32 bit keys with a value per key
+	class RadixSort
+	{
+	public:
+		static constexpr uint32_t RADIX_BITS = 4;
+		static constexpr uint32_t RADIX_SIZE = 1 << RADIX_BITS;
+		static constexpr uint32_t PASS_COUNT = 32 / RADIX_BITS;
+		static constexpr uint32_t WORKGROUP_SIZE = 256;
+		static constexpr uint32_t INVALID_KEY = std::numeric_limits<uint32_t>::max();
+
+		static_assert(DrawBatchRegistry::MAX_DRAW_BATCHES <= 256, "Transparent sort keys store the draw batch in 8 bits");
+
+		/// @brief Key ordering transparent instances by draw batch and then back to front (same as culling.slang)
+		[[nodiscard]] static auto transparentKey(uint32_t drawBatchID, float viewDepth) -> uint32_t;
+
+		/// @brief Number of workgroups (and histogram columns) the GPU sort uses for the element count
+		[[nodiscard]] static auto groupCount(uint32_t elementCount) -> uint32_t;
+
+		/// @brief Sorts keys ascending and reorders the values alongside with the same passes as the GPU sort
+		static void sort(std::vector<uint32_t>& keys, std::vector<uint32_t>& values);
+	};
+}
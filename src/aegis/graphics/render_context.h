@@ -1,19 +1,17 @@
 #pragma once
 
 #include "graphics/bindless/descriptor_handle.h"
+#include "graphics/render_world.h"
 #include "graphics/vulkan/volk_include.h"
-#include "scene/scene.h"
-#include "ui/ui.h"
 
 namespace Aegis::Graphics
 {
 	struct RenderContext
 	{
-		Scene::Scene& scene;
-		UI::UI& ui;
+		const RenderWorld& world;
 		uint32_t frameIndex{ 0 };
 		VkCommandBuffer cmd{ VK_NULL_HANDLE };
 		VkDescriptorSet globalSet{ VK_NULL_HANDLE };
 		DescriptorHandle globalHandle;
 	};
-}
\ No newline at end of file
+}
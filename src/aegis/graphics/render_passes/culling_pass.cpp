@@ -2,6 +2,7 @@
 #include "culling_pass.h"
 
 #include "engine.h"
+#include "graphics/radix_sort.h"
 #include "graphics/vulkan/vulkan_tools.h"
 
 namespace Aegis::Graphics
@@ -44,6 +45,27 @@ namespace Aegis::Graphics
 				.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT
 			});
 
+		// Visible transparent instances are appended unsorted (see TransparentSortPass)
+		m_transparentKeys = pool.addBuffer("TransparentSortKeys",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * std::max(m_drawBatcher.instanceCount(), 1u),
+				.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT
+			});
+
+		m_transparentInstances = pool.addBuffer("TransparentSortInstances",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * std::max(m_drawBatcher.instanceCount(), 1u),
+			});
+
+		m_transparentCount = pool.addBuffer("TransparentCount",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t),
+				.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT
+			});
+
 		m_cameraData = pool.addReference("CameraData",
 			FGResource::Usage::ComputeReadUniform);
 	}
@@ -53,7 +75,8 @@ namespace Aegis::Graphics
 		return FGNode::Info{
 			.name = "Culling",
 			.reads = { m_cameraData, m_staticInstances, m_dynamicInstances },
-			.writes = { m_visibleIndices, m_indirectDrawCommands, m_indirectDrawCounts },
+			.writes = { m_visibleIndices, m_indirectDrawCommands, m_indirectDrawCounts,
+				m_transparentKeys, m_transparentInstances, m_transparentCount },
 		};
 	}
 
@@ -62,6 +85,16 @@ namespace Aegis::Graphics
 		// Clear visible counts buffer
 		auto& indirectDrawCounts = pool.buffer(m_indirectDrawCounts);
 		vkCmdFillBuffer(frameInfo.cmd, indirectDrawCounts.buffer(), 0, indirectDrawCounts.buffer().bufferSize(), 0);
+
+		// Unused sort slots keep the invalid key so they end up behind all visible transparents
+		auto& transparentKeys = pool.buffer(m_transparentKeys);
+		auto& transparentCount = pool.buffer(m_transparentCount);
+		vkCmdFillBuffer(frameInfo.cmd, transparentKeys.buffer(), 0, transparentKeys.buffer().bufferSize(), RadixSort::INVALID_KEY);
+		vkCmdFillBuffer(frameInfo.cmd, transparentCount.buffer(), 0, transparentCount.buffer().bufferSize(), 0);
+
+		Tools::vk::cmdMemoryBarrier(frameInfo.cmd,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
 		
 		CullingPushConstants push{
 			.cameraData = pool.buffer(m_cameraData).handle(frameInfo.frameIndex),
@@ -71,6 +104,9 @@ namespace Aegis::Graphics
 			.visibilityInstances = pool.buffer(m_visibleIndices).handle(),
 			.indirectDrawCommands = pool.buffer(m_indirectDrawCommands).handle(),
 			.indirectDrawCounts = pool.buffer(m_indirectDrawCounts).handle(),
+			.transparentKeys = transparentKeys.handle(),
+			.transparentInstances = pool.buffer(m_transparentInstances).handle(),
+			.transparentCount = transparentCount.handle(),
 			.staticInstanceCount = m_drawBatcher.staticInstanceCount(),
 			.dynamicInstanceCount = m_drawBatcher.dynamicInstanceCount(),
 		};
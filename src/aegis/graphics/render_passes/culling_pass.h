@@ -21,6 +21,9 @@ namespace Aegis::Graphics
 			DescriptorHandle visibilityInstances;
 			DescriptorHandle indirectDrawCommands;
 			DescriptorHandle indirectDrawCounts;
+			DescriptorHandle transparentKeys;
+			DescriptorHandle transparentInstances;
+			DescriptorHandle transparentCount;
 			uint32_t staticInstanceCount;
 			uint32_t dynamicInstanceCount;
 		};
@@ -39,6 +42,9 @@ namespace Aegis::Graphics
 		FGResourceHandle m_visibleIndices;
 		FGResourceHandle m_indirectDrawCommands;
 		FGResourceHandle m_indirectDrawCounts;
+		FGResourceHandle m_transparentKeys;
+		FGResourceHandle m_transparentInstances;
+		FGResourceHandle m_transparentCount;
 		Pipeline m_pipeline;
 	};
 }
\ No newline at end of file
@@ -114,8 +114,7 @@ namespace Aegis::Graphics
 			Tools::vk::cmdScissor(cmd, extent);
 
 			RenderContext ctx{
-				.scene = frameInfo.scene,
-				.ui = frameInfo.ui,
+				.world = frameInfo.world,
 				.frameIndex = frameInfo.frameIndex,
 				.cmd = cmd,
 				.globalSet = m_globalSets[frameInfo.frameIndex],
@@ -140,14 +139,7 @@ namespace Aegis::Graphics
 
 	void GeometryPass::updateUBO(const FrameInfo& frameInfo)
 	{
-		Scene::Entity mainCamera = frameInfo.scene.mainCamera();
-		if (!mainCamera)
-			return;
-
-		// TODO: Don't update this here (move to renderer or similar)
-		auto& camera = mainCamera.get<Camera>();
-		camera.aspect = frameInfo.aspectRatio;
-
+		const auto& camera = frameInfo.world.camera;
 		GBufferUbo ubo{
 			.projection = glm::rowMajor4(camera.projectionMatrix),
 			.view = glm::rowMajor4(camera.viewMatrix),
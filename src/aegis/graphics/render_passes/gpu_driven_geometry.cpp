@@ -3,8 +3,10 @@
 
 #include "graphics/vulkan/vulkan_tools.h"
 #include "scene/components.h"
+#include "engine.h"
 
 #include <glm/gtx/matrix_major_storage.hpp>
+#include <imgui.h>
 
 namespace Aegis::Graphics
 {
@@ -72,6 +74,8 @@ namespace Aegis::Graphics
 
 		m_cameraData = pool.addReference("CameraData",
 			FGResource::Usage::ComputeReadUniform);
+
+		m_fallbackMaterial = Engine::assets().get<MaterialInstance>("default/PBR_instance");
 	}
 
 	auto GPUDrivenGeometry::info() -> FGNode::Info
@@ -120,22 +124,48 @@ namespace Aegis::Graphics
 			auto& visibleInstances = pool.buffer(m_visibleInstances);
 			auto& indirectDrawCommands = pool.buffer(m_indirectDrawCommands);
 			auto& indirectDrawCounts = pool.buffer(m_indirectDrawCounts);
+
+			// Pixels per unit of cluster error at a distance of one
+			const auto& camera = frameInfo.world.camera;
+			float lodErrorScale = 0.5f * static_cast<float>(frameInfo.swapChainExtent.height) * std::abs(camera.projectionMatrix[1][1]);
+
 			for (const auto& batch : frameInfo.drawBatcher.batches())
 			{
+				// Transparent batches are sorted and drawn after lighting (see GPUDrivenTransparent)
+				auto matTemplate = batch.materialTemplate.get();
+				if (matTemplate->type() == MaterialType::Transparent)
+					continue;
+
+				// Draw with the default material until the batch's pipeline finished compiling
+				uint32_t materialOverride = NO_MATERIAL_OVERRIDE;
+				if (!matTemplate->isReady())
+				{
+					matTemplate = m_fallbackMaterial->materialTemplate().get();
+					if (!matTemplate->isReady())
+						continue;
+
+					matTemplate->updateParameters(frameInfo.frameIndex);
+					materialOverride = m_fallbackMaterial->parameterIndex();
+				}
+
 				PushConstant pushConstants{
 					.cameraData = cameraData.handle(frameInfo.frameIndex),
 					.staticInstances = staticInstanceData.handle(),
 					.dynamicInstances = dynamicInstanceData.handle(frameInfo.frameIndex),
 					.visibility = visibleInstances.handle(),
+					.materials = matTemplate->parameterPool().handle(frameInfo.frameIndex),
 					.batchFirstID = batch.firstInstance,
 					.batchSize = batch.instanceCount,
 					.staticCount = frameInfo.drawBatcher.staticInstanceCount(),
-					.dynamicCount = frameInfo.drawBatcher.dynamicInstanceCount()
+					.dynamicCount = frameInfo.drawBatcher.dynamicInstanceCount(),
+					.lodErrorScale = lodErrorScale,
+					.lodErrorThreshold = m_lodErrorThreshold,
+					.materialOverride = materialOverride
 				};
 				AGX_ASSERT_X(pushConstants.cameraData.isValid(), "GPU Driven Geometry Pass: Invalid camera data handle in push constants");
-				batch.materialTemplate->bind(frameInfo.cmd);
-				batch.materialTemplate->bindBindlessSet(frameInfo.cmd);
-				batch.materialTemplate->pushConstants(frameInfo.cmd, &pushConstants, sizeof(PushConstant));
+				matTemplate->bind(frameInfo.cmd);
+				matTemplate->bindBindlessSet(frameInfo.cmd);
+				matTemplate->pushConstants(frameInfo.cmd, &pushConstants, sizeof(PushConstant));
 
 				vkCmdDrawMeshTasksIndirectCountEXT(frameInfo.cmd,
 					indirectDrawCommands.buffer(),
@@ -149,4 +179,9 @@ namespace Aegis::Graphics
 		}
 		vkCmdEndRendering(frameInfo.cmd);
 	}
+
+	void GPUDrivenGeometry::drawUI()
+	{
+		ImGui::SliderFloat("LOD Error Threshold", &m_lodErrorThreshold, 0.0f, 16.0f);
+	}
 }
\ No newline at end of file
@@ -1,28 +1,38 @@
 #pragma once
 
 #include "graphics/frame_graph/frame_graph_render_pass.h"
+#include "graphics/material/material_instance.h"
 
 namespace Aegis::Graphics
 {
 	class GPUDrivenGeometry : public FGRenderPass
 	{
 	public:
+		static constexpr uint32_t NO_MATERIAL_OVERRIDE = std::numeric_limits<uint32_t>::max();
+
 		struct PushConstant
 		{
 			DescriptorHandle cameraData;
 			DescriptorHandle staticInstances;
 			DescriptorHandle dynamicInstances;
 			DescriptorHandle visibility;
+			DescriptorHandle materials;
 			uint32_t batchFirstID;
 			uint32_t batchSize;
 			uint32_t staticCount;
 			uint32_t dynamicCount;
+			float lodErrorScale;
+			float lodErrorThreshold;
+			uint32_t materialOverride;
 		};
 
 		GPUDrivenGeometry(FGResourcePool& pool);
 
 		virtual auto info() -> FGNode::Info override;
 		virtual void execute(FGResourcePool& pool, const FrameInfo& frameInfo) override;
+		virtual void drawUI() override;
+
+		[[nodiscard]] auto lodErrorThreshold() const -> float { return m_lodErrorThreshold; }
 
 	private:
 		FGResourceHandle m_position;
@@ -38,5 +48,8 @@ namespace Aegis::Graphics
 		FGResourceHandle m_indirectDrawCommands;
 		FGResourceHandle m_indirectDrawCounts;
 		FGResourceHandle m_cameraData;
+
+		std::shared_ptr<MaterialInstance> m_fallbackMaterial; // Drawn while a batch's pipeline is still compiling
+		float m_lodErrorThreshold{ 1.0f }; // Max cluster LOD error in pixels
 	};
 }
\ No newline at end of file
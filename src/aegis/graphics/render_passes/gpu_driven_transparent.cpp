@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "gpu_driven_transparent.h"
+
+#include "graphics/render_passes/lighting_pass.h"
+#include "graphics/vulkan/vulkan_tools.h"
+#include "scene/components.h"
+
+namespace Aegis::Graphics
+{
+	GPUDrivenTransparent::GPUDrivenTransparent(FGResourcePool& pool, LightClusters& lightClusters, const GPUDrivenGeometry& geometry) :
+		m_lightClusters{ lightClusters },
+		m_geometry{ geometry },
+		m_lightingUbo{ Buffer::uniformBuffer(sizeof(LightingUniforms)) }
+	{
+		m_sceneColor = pool.addReference("SceneColor",
+			FGResource::Usage::ColorAttachment);
+
+		m_depth = pool.addReference("Depth",
+			FGResource::Usage::DepthStencilAttachment);
+
+		m_visibleInstances = pool.addReference("TransparentVisibleInstances",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_staticInstanceData = pool.addReference("StaticInstanceData",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_dynamicInstanceData = pool.addReference("DynamicInstanceData",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_indirectDrawCommands = pool.addReference("TransparentDrawCommands",
+			FGResource::Usage::IndirectBuffer);
+
+		m_indirectDrawCounts = pool.addReference("IndirectDrawCounts",
+			FGResource::Usage::IndirectBuffer);
+
+		m_cameraData = pool.addReference("CameraData",
+			FGResource::Usage::ComputeReadUniform);
+
+		m_clusterLightCounts = pool.addReference("ClusterLightCounts",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_clusterLightIndices = pool.addReference("ClusterLightIndices",
+			FGResource::Usage::ComputeReadStorage);
+	}
+
+	auto GPUDrivenTransparent::info() -> FGNode::Info
+	{
+		return FGNode::Info{
+			.name = "GPU Driven Transparent",
+			.reads = { m_depth, m_visibleInstances, m_staticInstanceData, m_dynamicInstanceData,
+				m_indirectDrawCommands, m_indirectDrawCounts, m_cameraData, m_clusterLightCounts, m_clusterLightIndices },
+			.writes = { m_sceneColor }
+		};
+	}
+
+	void GPUDrivenTransparent::execute(FGResourcePool& pool, const FrameInfo& frameInfo)
+	{
+		const auto& environment = frameInfo.world.environment;
+		AGX_ASSERT_X(environment.irradiance, "Environment irradiance map is not set");
+
+		LightingUniforms lighting = LightingUniforms::create(frameInfo.world, m_lightClusters);
+		m_lightingUbo.write(&lighting, sizeof(LightingUniforms), 0, frameInfo.frameIndex);
+
+		VkRect2D renderArea{
+			.offset = { 0, 0 },
+			.extent = frameInfo.swapChainExtent
+		};
+
+		auto colorAttachment = Tools::renderingAttachmentInfo(pool.texture(m_sceneColor), VK_ATTACHMENT_LOAD_OP_LOAD);
+		auto depthAttachment = Tools::renderingAttachmentInfo(pool.texture(m_depth), VK_ATTACHMENT_LOAD_OP_LOAD);
+
+		VkRenderingInfo renderInfo{
+			.sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+			.renderArea = renderArea,
+			.layerCount = 1,
+			.colorAttachmentCount = 1,
+			.pColorAttachments = &colorAttachment,
+			.pDepthAttachment = &depthAttachment,
+		};
+
+		vkCmdBeginRendering(frameInfo.cmd, &renderInfo);
+		{
+			Tools::vk::cmdViewport(frameInfo.cmd, renderArea.extent);
+			Tools::vk::cmdScissor(frameInfo.cmd, renderArea.extent);
+
+			auto& cameraData = pool.buffer(m_cameraData);
+			auto& staticInstanceData = pool.buffer(m_staticInstanceData);
+			auto& dynamicInstanceData = pool.buffer(m_dynamicInstanceData);
+			auto& visibleInstances = pool.buffer(m_visibleInstances);
+			auto& indirectDrawCommands = pool.buffer(m_indirectDrawCommands);
+			auto& indirectDrawCounts = pool.buffer(m_indirectDrawCounts);
+			auto& clusterLightCounts = pool.buffer(m_clusterLightCounts);
+			auto& clusterLightIndices = pool.buffer(m_clusterLightIndices);
+
+			const auto& camera = frameInfo.world.camera;
+			float lodErrorScale = 0.5f * static_cast<float>(frameInfo.swapChainExtent.height) * std::abs(camera.projectionMatrix[1][1]);
+
+			for (const auto& batch : frameInfo.drawBatcher.batches())
+			{
+				// Transparent pipelines have no fallback (the default material writes the GBuffer)
+				auto matTemplate = batch.materialTemplate.get();
+				if (matTemplate->type() != MaterialType::Transparent || !matTemplate->isReady())
+					continue;
+
+				PushConstant pushConstants{
+					.draw = {
+						.cameraData = cameraData.handle(frameInfo.frameIndex),
+						.staticInstances = staticInstanceData.handle(),
+						.dynamicInstances = dynamicInstanceData.handle(frameInfo.frameIndex),
+						.visibility = visibleInstances.handle(),
+						.materials = matTemplate->parameterPool().handle(frameInfo.frameIndex),
+						.batchFirstID = batch.firstInstance,
+						.batchSize = batch.instanceCount,
+						.staticCount = frameInfo.drawBatcher.staticInstanceCount(),
+						.dynamicCount = frameInfo.drawBatcher.dynamicInstanceCount(),
+						.lodErrorScale = lodErrorScale,
+						.lodErrorThreshold = m_geometry.lodErrorThreshold(),
+						.materialOverride = GPUDrivenGeometry::NO_MATERIAL_OVERRIDE
+					},
+					.screenSize = { renderArea.extent.width, renderArea.extent.height },
+					.lighting = m_lightingUbo.handle(frameInfo.frameIndex),
+					.pointLights = m_lightClusters.lightBuffer().handle(frameInfo.frameIndex),
+					.clusterLightCounts = clusterLightCounts.handle(),
+					.clusterLightIndices = clusterLightIndices.handle(),
+					.irradianceMap = environment.irradiance->sampledDescriptorHandle(),
+					.prefilteredMap = environment.prefiltered->sampledDescriptorHandle(),
+					.brdfLUT = environment.brdfLUT->sampledDescriptorHandle()
+				};
+				matTemplate->bind(frameInfo.cmd);
+				matTemplate->bindBindlessSet(frameInfo.cmd);
+				matTemplate->pushConstants(frameInfo.cmd, &pushConstants, sizeof(PushConstant));
+
+				// Draws execute in command order, which the sort pass wrote back to front
+				vkCmdDrawMeshTasksIndirectCountEXT(frameInfo.cmd,
+					indirectDrawCommands.buffer(),
+					sizeof(VkDrawMeshTasksIndirectCommandEXT) * batch.firstInstance,
+					indirectDrawCounts.buffer(),
+					sizeof(uint32_t) * batch.batchID,
+					batch.instanceCount,
+					sizeof(VkDrawMeshTasksIndirectCommandEXT)
+				);
+			}
+		}
+		vkCmdEndRendering(frameInfo.cmd);
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "graphics/bindless/bindless_buffer.h"
+#include "graphics/frame_graph/frame_graph_render_pass.h"
+#include "graphics/light_clusters.h"
+#include "graphics/render_passes/gpu_driven_geometry.h"
+
+namespace Aegis::Graphics
+{
+	/// @brief Draws the sorted transparent batches over the lit scene color (see TransparentSortPass)
+	/// @note Forward shaded with the lights, light clusters and environment maps of the lighting pass
+	class GPUDrivenTransparent : public FGRenderPass
+	{
+	public:
+		struct PushConstant
+		{
+			GPUDrivenGeometry::PushConstant draw; // Read by the task and mesh stages shared with the geometry pass
+			glm::uvec2 screenSize;
+			DescriptorHandle lighting;
+			DescriptorHandle pointLights;
+			DescriptorHandle clusterLightCounts;
+			DescriptorHandle clusterLightIndices;
+			DescriptorHandle irradianceMap;
+			DescriptorHandle prefilteredMap;
+			DescriptorHandle brdfLUT;
+		};
+		static_assert(sizeof(PushConstant) <= 128, "Push constants are limited to 128 bytes (see asset_manager.cpp)");
+
+		GPUDrivenTransparent(FGResourcePool& pool, LightClusters& lightClusters, const GPUDrivenGeometry& geometry);
+
+		virtual auto info() -> FGNode::Info override;
+		virtual void execute(FGResourcePool& pool, const FrameInfo& frameInfo) override;
+
+	private:
+		LightClusters& m_lightClusters;
+		const GPUDrivenGeometry& m_geometry; // Draws with the same LOD error threshold
+		BindlessFrameBuffer m_lightingUbo;
+
+		FGResourceHandle m_sceneColor;
+		FGResourceHandle m_depth;
+		FGResourceHandle m_visibleInstances;
+		FGResourceHandle m_staticInstanceData;
+		FGResourceHandle m_dynamicInstanceData;
+		FGResourceHandle m_indirectDrawCommands;
+		FGResourceHandle m_indirectDrawCounts;
+		FGResourceHandle m_cameraData;
+		FGResourceHandle m_clusterLightCounts;
+		FGResourceHandle m_clusterLightIndices;
+	};
+}
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "light_culling_pass.h"
+
+#include "engine.h"
+#include "graphics/vulkan/vulkan_tools.h"
+
+#include <glm/gtx/matrix_major_storage.hpp>
+#include <imgui.h>
+
+namespace Aegis::Graphics
+{
+	LightCullingPass::LightCullingPass(FGResourcePool& pool, LightClusters& lightClusters)
+		: m_lightClusters{ lightClusters }
+	{
+		m_pipeline = Pipeline::ComputeBuilder{}
+			.addDescriptorSetLayout(Engine::renderer().bindlessDescriptorSet().layout())
+			.addPushConstantRange(VK_SHADER_STAGE_COMPUTE_BIT, sizeof(LightCullingPushConstants))
+			.setShaderStage(SHADER_DIR "light_culling.slang.spv")
+			.build();
+
+		m_clusterLightCounts = pool.addBuffer("ClusterLightCounts",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * LightClusterBinner::CLUSTER_COUNT,
+			});
+
+		m_clusterLightIndices = pool.addBuffer("ClusterLightIndices",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * LightClusterBinner::CLUSTER_COUNT * LightClusterBinner::MAX_LIGHTS_PER_CLUSTER,
+			});
+	}
+
+	auto LightCullingPass::info() -> FGNode::Info
+	{
+		return FGNode::Info{
+			.name = "Light Culling",
+			.reads = {},
+			.writes = { m_clusterLightCounts, m_clusterLightIndices },
+		};
+	}
+
+	void LightCullingPass::execute(FGResourcePool& pool, const FrameInfo& frameInfo)
+	{
+		m_lightClusters.update(frameInfo.world, frameInfo.frameIndex);
+
+		const auto& view = m_lightClusters.view();
+		LightCullingPushConstants push{
+			.view = glm::rowMajor4(view.view),
+			.projectionScale = view.projectionScale,
+			.near = view.near,
+			.far = view.far,
+			.lights = m_lightClusters.lightBuffer().handle(frameInfo.frameIndex),
+			.clusterLightCounts = pool.buffer(m_clusterLightCounts).handle(),
+			.clusterLightIndices = pool.buffer(m_clusterLightIndices).handle(),
+			.lightCount = m_lightClusters.lightCount(),
+		};
+
+		m_pipeline.bind(frameInfo.cmd);
+		m_pipeline.bindDescriptorSet(frameInfo.cmd, 0, Engine::renderer().bindlessDescriptorSet());
+		m_pipeline.pushConstants(frameInfo.cmd, VK_SHADER_STAGE_COMPUTE_BIT, push);
+
+		Tools::vk::cmdDispatch(frameInfo.cmd, LightClusterBinner::CLUSTER_COUNT, WORKGROUP_SIZE);
+	}
+
+	void LightCullingPass::drawUI()
+	{
+		ImGui::Text("Point Lights: %u", m_lightClusters.lightCount());
+		ImGui::Text("Clusters: %u x %u x %u", LightClusterBinner::SIZE_X, LightClusterBinner::SIZE_Y, LightClusterBinner::SIZE_Z);
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "graphics/bindless/descriptor_handle.h"
+#include "graphics/frame_graph/frame_graph_render_pass.h"
+#include "graphics/light_clusters.h"
+#include "graphics/pipeline.h"
+
+namespace Aegis::Graphics
+{
+	/// @brief Bins the point lights of the scene into view space clusters for the lighting pass
+	class LightCullingPass : public FGRenderPass
+	{
+	public:
+		static constexpr uint32_t WORKGROUP_SIZE = 64;
+
+		struct LightCullingPushConstants
+		{
+			glm::mat4 view;
+			glm::vec2 projectionScale;
+			float near;
+			float far;
+			DescriptorHandle lights;
+			DescriptorHandle clusterLightCounts;
+			DescriptorHandle clusterLightIndices;
+			uint32_t lightCount;
+		};
+
+		LightCullingPass(FGResourcePool& pool, LightClusters& lightClusters);
+
+		virtual auto info() -> FGNode::Info override;
+		virtual void execute(FGResourcePool& pool, const FrameInfo& frameInfo) override;
+		virtual void drawUI() override;
+
+	private:
+		LightClusters& m_lightClusters;
+		FGResourceHandle m_clusterLightCounts;
+		FGResourceHandle m_clusterLightIndices;
+		Pipeline m_pipeline;
+	};
+}
@@ -6,11 +6,14 @@
 #include "graphics/vulkan/vulkan_tools.h"
 #include "scene/components.h"
 
+#include <glm/gtx/matrix_major_storage.hpp>
+
 #include <imgui.h>
 
 namespace Aegis::Graphics
 {
-	LightingPass::LightingPass(FGResourcePool& pool) :
+	LightingPass::LightingPass(FGResourcePool& pool, LightClusters& lightClusters) :
+		m_lightClusters{ lightClusters },
 		m_ubo{ Buffer::uniformBuffer(sizeof(LightingUniforms)) },
 		m_gbufferSetLayout{ createGBufferSetLayout() },
 		m_iblSetLayout{ createIBLSetLayout() }
@@ -47,6 +50,12 @@ namespace Aegis::Graphics
 		//m_ssao = pool.addReference("SSAO",
 		//	FGResource::Usage::ComputeReadStorage);
 
+		m_clusterLightCounts = pool.addReference("ClusterLightCounts",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_clusterLightIndices = pool.addReference("ClusterLightIndices",
+			FGResource::Usage::ComputeReadStorage);
+
 		m_sceneColor = pool.addImage("SceneColor",
 			FGResource::Usage::ComputeWriteStorage,
 			FGTextureInfo{
@@ -59,7 +68,8 @@ namespace Aegis::Graphics
 	{
 		return FGNode::Info{
 			.name = "Lighting",
-			.reads = { m_position, m_normal, m_albedo, m_arm, m_emissive/*, m_ssao*/ },
+			.reads = { m_position, m_normal, m_albedo, m_arm, m_emissive/*, m_ssao*/,
+				m_clusterLightCounts, m_clusterLightIndices },
 			.writes = { m_sceneColor }
 		};
 	}
@@ -69,7 +79,7 @@ namespace Aegis::Graphics
 		VkCommandBuffer cmd = frameInfo.cmd;
 
 		updateLightingUBO(frameInfo);
-		auto& environment = frameInfo.scene.environment().get<Environment>();
+		const auto& environment = frameInfo.world.environment;
 		AGX_ASSERT_X(environment.irradiance, "Environment irradiance map is not set");
 
 		DescriptorWriter{ m_gbufferSetLayout }
@@ -81,6 +91,9 @@ namespace Aegis::Graphics
 			.writeImage(5, pool.texture(m_emissive))
 			//.writeImage(6, pool.texture(m_ssao))
 			.writeBuffer(7, m_ubo, frameInfo.frameIndex)
+			.writeBuffer(8, m_lightClusters.lightBuffer().buffer(), frameInfo.frameIndex)
+			.writeBuffer(9, pool.buffer(m_clusterLightCounts).buffer())
+			.writeBuffer(10, pool.buffer(m_clusterLightIndices).buffer())
 			.update(m_gbufferSets[frameInfo.frameIndex]);
 
 		DescriptorWriter{ m_iblSetLayout }
@@ -120,6 +133,9 @@ namespace Aegis::Graphics
 			.addBinding(5, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT)
 			.addBinding(6, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_COMPUTE_BIT)
 			.addBinding(7, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+			.addBinding(8, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+			.addBinding(9, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+			.addBinding(10, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 			.build();
 	}
 
@@ -132,46 +148,26 @@ namespace Aegis::Graphics
 			.build();
 	}
 
-	void LightingPass::updateLightingUBO(const FrameInfo& frameInfo)
+	auto LightingUniforms::create(const RenderWorld& world, const LightClusters& lightClusters) -> LightingUniforms
 	{
 		LightingUniforms lighting;
+		lighting.cameraPosition = glm::vec4(world.cameraLocation, 1.0f);
+		lighting.ambient.color = glm::vec4(world.ambientLight.color, world.ambientLight.intensity);
+		lighting.directional.color = glm::vec4(world.directionalLight.color, world.directionalLight.intensity);
+		lighting.directional.direction = glm::vec4(world.directionalLightDirection, 0.0f);
+
+		// Point lights are gathered and binned by the light culling pass
+		const auto& clusterView = lightClusters.view();
+		lighting.view = glm::rowMajor4(clusterView.view);
+		lighting.clusterNear = clusterView.near;
+		lighting.clusterFar = clusterView.far;
+		lighting.pointLightCount = static_cast<int32_t>(lightClusters.lightCount());
+		return lighting;
+	}
 
-		Scene::Entity mainCamera = frameInfo.scene.mainCamera();
-		if (mainCamera && mainCamera.has<Transform>())
-		{
-			auto& cameraTransform = mainCamera.get<Transform>();
-			lighting.cameraPosition = glm::vec4(cameraTransform.location, 1.0f);
-		}
-
-		Scene::Entity ambientLight = frameInfo.scene.ambientLight();
-		if (ambientLight && ambientLight.has<AmbientLight>())
-		{
-			auto& ambient = ambientLight.get<AmbientLight>();
-			lighting.ambient.color = glm::vec4(ambient.color, ambient.intensity);
-		}
-
-		Scene::Entity directionalLight = frameInfo.scene.directionalLight();
-		if (directionalLight && directionalLight.has<DirectionalLight, Transform>())
-		{
-			auto& directional = directionalLight.get<DirectionalLight>();
-			auto& transform = directionalLight.get<Transform>();
-			lighting.directional.color = glm::vec4(directional.color, directional.intensity);
-			lighting.directional.direction = glm::vec4(glm::normalize(transform.forward()), 0.0f);
-		}
-
-		int32_t lighIndex = 0;
-		auto view = frameInfo.scene.registry().view<Transform, PointLight>();
-		for (auto&& [entity, transform, pointLight] : view.each())
-		{
-			AGX_ASSERT_X(lighIndex < MAX_POINT_LIGHTS, "Point lights exceed maximum number of point lights");
-			lighting.pointLights[lighIndex] = LightingUniforms::PointLight{
-				.position = glm::vec4(transform.location, 1.0f),
-				.color = glm::vec4(pointLight.color, pointLight.intensity)
-			};
-			lighIndex++;
-		}
-		lighting.pointLightCount = lighIndex;
-
+	void LightingPass::updateLightingUBO(const FrameInfo& frameInfo)
+	{
+		LightingUniforms lighting = LightingUniforms::create(frameInfo.world, m_lightClusters);
 		lighting.ambientOcclusionFactor = m_ambientOcclusionFactor;
 		lighting.viewMode = m_viewMode;
 
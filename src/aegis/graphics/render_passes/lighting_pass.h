@@ -3,6 +3,7 @@
 #include "graphics/frame_graph/frame_graph_render_pass.h"
 #include "graphics/pipeline.h"
 #include "graphics/descriptors.h"
+#include "graphics/light_clusters.h"
 
 namespace Aegis::Graphics
 {
@@ -29,25 +30,24 @@ namespace Aegis::Graphics
 			glm::vec4 color{ 0.0f };
 		};
 
-		struct PointLight
-		{
-			glm::vec4 position{ 0.0f };
-			glm::vec4 color{ 0.0f };
-		};
-
 		glm::vec4 cameraPosition{ 0.0f };
 		AmbientLight ambient{};
 		DirectionalLight directional{};
-		std::array<PointLight, MAX_POINT_LIGHTS> pointLights{};
+		glm::mat4 view{ 1.0f };
+		float clusterNear{ 0.1f };
+		float clusterFar{ 1000.0f };
 		int32_t pointLightCount{ 0 };
 		float ambientOcclusionFactor{ 0.5f };
 		LightingViewMode viewMode{ LightingViewMode::SceneColor };
+
+		/// @brief Fills in the lights of the frame, shared by the lighting pass and the forward shaded transparents
+		static auto create(const RenderWorld& world, const LightClusters& lightClusters) -> LightingUniforms;
 	};
 
 	class LightingPass : public FGRenderPass
 	{
 	public:
-		LightingPass(FGResourcePool& pool);
+		LightingPass(FGResourcePool& pool, LightClusters& lightClusters);
 
 		virtual auto info() -> FGNode::Info override;
 		virtual void execute(FGResourcePool& pool, const FrameInfo& frameInfo) override;
@@ -58,6 +58,7 @@ namespace Aegis::Graphics
 		auto createIBLSetLayout() -> DescriptorSetLayout;
 		void updateLightingUBO(const FrameInfo& frameInfo);
 
+		LightClusters& m_lightClusters;
 		FGResourceHandle m_sceneColor;
 		FGResourceHandle m_position;
 		FGResourceHandle m_normal;
@@ -65,6 +66,8 @@ namespace Aegis::Graphics
 		FGResourceHandle m_arm;
 		FGResourceHandle m_emissive;
 		FGResourceHandle m_ssao;
+		FGResourceHandle m_clusterLightCounts;
+		FGResourceHandle m_clusterLightIndices;
 
 		LightingViewMode m_viewMode{ LightingViewMode::SceneColor };
 		float m_ambientOcclusionFactor{ 1.0f };
@@ -83,15 +83,12 @@ namespace Aegis::Graphics
 			const auto& matInstance = material.instance;
 			const auto& matTemplate = matInstance->materialTemplate();
 
-			// Update instance data (if needed)
-			matInstance->updateParameters(0);
-
 			// Shader needs both in row major (better packing)
 			glm::mat4 modelMatrix = transform.matrix();
 			glm::mat3 normalMatrix = glm::inverse(modelMatrix);
 			staticInstances.emplace_back(glm::rowMajor4(modelMatrix),
 				normalMatrix[0], mesh.staticMesh->meshDataBuffer().handle(),
-				normalMatrix[1], matInstance->buffer().handle(0),  // TODO: Would normal use frame index but data is static so its fine i guess?
+				normalMatrix[1], matInstance->parameterIndex(),
 				normalMatrix[2], matTemplate->drawBatch());
 
 			instanceID++;
@@ -106,6 +103,7 @@ namespace Aegis::Graphics
 	{
 		updateDynamicInstances(pool, frameInfo);
 		updateDrawBatches(pool, frameInfo);
+		updateMaterials(frameInfo);
 		updateCameraData(pool, frameInfo);
 	}
 
@@ -117,8 +115,7 @@ namespace Aegis::Graphics
 		dynamicInstances.reserve(frameInfo.drawBatcher.instanceCount()); // TODO: Differentiate static/dynamic counts
 
 		uint32_t instanceID = 0;
-		auto view = frameInfo.scene.registry().view<GlobalTransform, Mesh, Material, DynamicTag>();
-		for (const auto& [entity, transform, mesh, material] : view.each())
+		for (const auto& instance : frameInfo.world.meshes)
 		{
 			if (instanceID >= MAX_DYNAMIC_INSTANCES)
 			{
@@ -126,22 +123,16 @@ namespace Aegis::Graphics
 				break;
 			}
 
-			if (!mesh.staticMesh || !material.instance || !material.instance->materialTemplate())
-				continue;
-
-			const auto& matInstance = material.instance;
+			const auto& matInstance = instance.material;
 			const auto& matTemplate = matInstance->materialTemplate();
 
-			// Update instance data (if needed)
-			matInstance->updateParameters(frameInfo.frameIndex);
-
 			// Shader needs both in row major (better packing)
-			glm::mat4 modelMatrix = transform.matrix();
+			const glm::mat4& modelMatrix = instance.transform;
 			glm::mat3 normalMatrix = glm::inverse(modelMatrix);
 
 			dynamicInstances.emplace_back(glm::rowMajor4(modelMatrix),
-				normalMatrix[0], mesh.staticMesh->meshDataBuffer().handle(),
-				normalMatrix[1], matInstance->buffer().handle(frameInfo.frameIndex),
+				normalMatrix[0], instance.mesh->meshDataBuffer().handle(),
+				normalMatrix[1], matInstance->parameterIndex(),
 				normalMatrix[2], matTemplate->drawBatch());
 
 			instanceID++;
@@ -158,22 +149,25 @@ namespace Aegis::Graphics
 		drawBatchData.reserve(frameInfo.drawBatcher.batchCount());
 		for (const auto& batch : frameInfo.drawBatcher.batches())
 		{
-			drawBatchData.emplace_back(batch.firstInstance, batch.instanceCount);
+			drawBatchData.emplace_back(batch.firstInstance, batch.instanceCount,
+				static_cast<uint32_t>(batch.materialTemplate->type()));
 		}
 		auto& drawBatchBuffer = pool.buffer(m_drawBatchBuffer);
 		drawBatchBuffer.buffer().copy(drawBatchData, frameInfo.frameIndex);
 	}
 
-	void SceneUpdatePass::updateCameraData(FGResourcePool& pool, const FrameInfo& frameInfo)
+	void SceneUpdatePass::updateMaterials(const FrameInfo& frameInfo)
 	{
-		auto mainCamera = frameInfo.scene.mainCamera();
-		AGX_ASSERT_X(mainCamera, "Scene Update Pass: No main camera set in scene");
-
-		// TODO: Don't update this here (move to renderer or similar)
-		auto& camera = mainCamera.get<Camera>();
-		camera.aspect = frameInfo.aspectRatio;
+		// Each batch has its own template, so every parameter pool is uploaded once
+		for (const auto& batch : frameInfo.drawBatcher.batches())
+		{
+			batch.materialTemplate->updateParameters(frameInfo.frameIndex);
+		}
+	}
 
-		auto& cameraTransform = mainCamera.get<GlobalTransform>();
+	void SceneUpdatePass::updateCameraData(FGResourcePool& pool, const FrameInfo& frameInfo)
+	{
+		const auto& camera = frameInfo.world.camera;
 		glm::mat4 viewProjection = camera.projectionMatrix * camera.viewMatrix;
 
 		auto& cameraBuffer = pool.buffer(m_cameraData);
@@ -182,6 +176,6 @@ namespace Aegis::Graphics
 		data->projection = glm::rowMajor4(camera.projectionMatrix);
 		data->viewProjection = glm::rowMajor4(viewProjection);
 		data->frustum = Frustum::extractFrom(viewProjection);
-		data->cameraPosition = cameraTransform.location;
+		data->cameraPosition = frameInfo.world.cameraLocation;
 	}
 }
@@ -13,7 +13,7 @@ namespace Aegis::Graphics
 		glm::vec3 normalRow0;
 		DescriptorHandle meshHandle;
 		glm::vec3 normalRow1;
-		DescriptorHandle materialHandle;
+		uint32_t materialIndex; // Slot in the parameter pool of the batch's material template
 		glm::vec3 normalRow2;
 		uint32_t drawBatchID;
 	};
@@ -22,6 +22,7 @@ namespace Aegis::Graphics
 	{
 		uint32_t instanceOffset;
 		uint32_t instanceCount;
+		uint32_t materialType;
 	};
 
 	struct CameraData
@@ -47,6 +48,7 @@ namespace Aegis::Graphics
 	private:
 		void updateDynamicInstances(FGResourcePool& pool, const FrameInfo& frameInfo);
 		void updateDrawBatches(FGResourcePool& pool, const FrameInfo& frameInfo);
+		void updateMaterials(const FrameInfo& frameInfo);
 		void updateCameraData(FGResourcePool& pool, const FrameInfo& frameInfo);
 
 		FGResourceHandle m_staticInstances;
@@ -80,11 +80,7 @@ namespace Aegis::Graphics
 
 	void SkyBoxPass::execute(FGResourcePool& pool, const FrameInfo& frameInfo)
 	{
-		auto skyBoxEntity = frameInfo.scene.environment();
-		if (!skyBoxEntity || !skyBoxEntity.has<Environment>())
-			return;
-
-		auto& environment = skyBoxEntity.get<Environment>();
+		const auto& environment = frameInfo.world.environment;
 		if (!environment.skybox)
 			return;
 
@@ -112,7 +108,7 @@ namespace Aegis::Graphics
 		Tools::vk::cmdViewport(cmd, frameInfo.swapChainExtent);
 		Tools::vk::cmdScissor(cmd, frameInfo.swapChainExtent);
 
-		auto& camera = frameInfo.scene.mainCamera().get<Camera>();
+		const auto& camera = frameInfo.world.camera;
 		glm::mat4 viewRotOnly = glm::mat4{ glm::mat3{ camera.viewMatrix } }; // Strip translation from view matrix
 		SkyBoxUniforms uniforms{
 			.viewProjection = glm::rowMajor4(camera.projectionMatrix * viewRotOnly),
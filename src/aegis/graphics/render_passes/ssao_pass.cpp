@@ -98,7 +98,7 @@ namespace Aegis::Graphics
 		VkCommandBuffer cmd = frameInfo.cmd;
 
 		// Update push constants
-		auto& camera = frameInfo.scene.mainCamera().get<Camera>();
+		const auto& camera = frameInfo.world.camera;
 		m_uniformData.view = camera.viewMatrix;
 		m_uniformData.projection = camera.projectionMatrix;
 		m_uniformData.noiseScale.x = m_uniformData.noiseScale.y * camera.aspect;
@@ -62,8 +62,7 @@ namespace Aegis::Graphics
 			Tools::vk::cmdScissor(cmd, extent);
 
 			RenderContext ctx{
-				.scene = frameInfo.scene,
-				.ui = frameInfo.ui,
+				.world = frameInfo.world,
 				.frameIndex = frameInfo.frameIndex,
 				.cmd = cmd,
 				.globalSet = m_globalSets[frameInfo.frameIndex]
@@ -86,12 +85,8 @@ namespace Aegis::Graphics
 
 	void TransparentPass::updateUBO(const FrameInfo& frameInfo)
 	{
-		Scene::Entity mainCamera = frameInfo.scene.mainCamera();
-		if (!mainCamera)
-			return;
-
 		// TODO: Check if these need to be transposed for shaders (row-major layout)
-		auto& camera = mainCamera.get<Camera>();
+		const auto& camera = frameInfo.world.camera;
 		TransparentUbo ubo{
 			.view = glm::rowMajor4(camera.viewMatrix),
 			.projection = glm::rowMajor4(camera.projectionMatrix)
@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "transparent_sort_pass.h"
+
+#include "engine.h"
+#include "graphics/radix_sort.h"
+#include "graphics/vulkan/vulkan_tools.h"
+
+namespace Aegis::Graphics
+{
+	TransparentSortPass::TransparentSortPass(FGResourcePool& pool, DrawBatchRegistry& batcher)
+		: m_drawBatcher{ batcher }, m_capacity{ std::max(batcher.instanceCount(), 1u) }
+	{
+		auto radixSortPipeline = [](const char* entry) {
+			return Pipeline::ComputeBuilder{}
+				.addDescriptorSetLayout(Engine::renderer().bindlessDescriptorSet().layout())
+				.addPushConstantRange(VK_SHADER_STAGE_COMPUTE_BIT, sizeof(RadixSortPushConstants))
+				.setShaderStage(SHADER_DIR "radix_sort.slang.spv", entry)
+				.build();
+		};
+		m_histogramPipeline = radixSortPipeline("histogramMain");
+		m_scanPipeline = radixSortPipeline("scanMain");
+		m_scatterPipeline = radixSortPipeline("scatterMain");
+
+		m_commandPipeline = Pipeline::ComputeBuilder{}
+			.addDescriptorSetLayout(Engine::renderer().bindlessDescriptorSet().layout())
+			.addPushConstantRange(VK_SHADER_STAGE_COMPUTE_BIT, sizeof(CommandPushConstants))
+			.setShaderStage(SHADER_DIR "transparent_commands.slang.spv")
+			.build();
+
+		m_staticInstances = pool.addReference("StaticInstanceData",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_dynamicInstances = pool.addReference("DynamicInstanceData",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_drawBatchBuffer = pool.addReference("DrawBatches",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_transparentKeys = pool.addReference("TransparentSortKeys",
+			FGResource::Usage::ComputeWriteStorage);
+
+		m_transparentInstances = pool.addReference("TransparentSortInstances",
+			FGResource::Usage::ComputeWriteStorage);
+
+		m_transparentCount = pool.addReference("TransparentCount",
+			FGResource::Usage::ComputeReadStorage);
+
+		m_scratchKeys = pool.addBuffer("TransparentSortScratchKeys",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * m_capacity,
+			});
+
+		m_scratchInstances = pool.addBuffer("TransparentSortScratchInstances",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * m_capacity,
+			});
+
+		m_histograms = pool.addBuffer("TransparentSortHistograms",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * RadixSort::RADIX_SIZE * RadixSort::groupCount(m_capacity),
+			});
+
+		m_visibleInstances = pool.addBuffer("TransparentVisibleInstances",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(uint32_t) * m_capacity,
+			});
+
+		m_indirectDrawCommands = pool.addBuffer("TransparentDrawCommands",
+			FGResource::Usage::ComputeWriteStorage,
+			FGBufferInfo{
+				.size = sizeof(VkDrawMeshTasksIndirectCommandEXT) * m_capacity,
+			});
+	}
+
+	auto TransparentSortPass::info() -> FGNode::Info
+	{
+		return FGNode::Info{
+			.name = "Transparent Sort",
+			.reads = { m_staticInstances, m_dynamicInstances, m_drawBatchBuffer, m_transparentCount },
+			.writes = { m_transparentKeys, m_transparentInstances, m_scratchKeys, m_scratchInstances, m_histograms,
+				m_visibleInstances, m_indirectDrawCommands },
+		};
+	}
+
+	void TransparentSortPass::execute(FGResourcePool& pool, const FrameInfo& frameInfo)
+	{
+		// Culling appended at most this many instances, the rest of the range holds invalid keys
+		uint32_t elementCount = std::min(m_drawBatcher.transparentInstanceCount(), m_capacity);
+		if (elementCount == 0)
+			return;
+
+		sort(pool, frameInfo.cmd, elementCount);
+
+		CommandPushConstants push{
+			.staticInstances = pool.buffer(m_staticInstances).handle(),
+			.dynamicInstances = pool.buffer(m_dynamicInstances).handle(frameInfo.frameIndex),
+			.drawBatches = pool.buffer(m_drawBatchBuffer).handle(frameInfo.frameIndex),
+			.sortedKeys = pool.buffer(m_transparentKeys).handle(),
+			.sortedInstances = pool.buffer(m_transparentInstances).handle(),
+			.transparentCount = pool.buffer(m_transparentCount).handle(),
+			.visibility = pool.buffer(m_visibleInstances).handle(),
+			.indirectDrawCommands = pool.buffer(m_indirectDrawCommands).handle(),
+			.staticInstanceCount = m_drawBatcher.staticInstanceCount(),
+		};
+
+		m_commandPipeline.bind(frameInfo.cmd);
+		m_commandPipeline.bindDescriptorSet(frameInfo.cmd, 0, Engine::renderer().bindlessDescriptorSet());
+		m_commandPipeline.pushConstants(frameInfo.cmd, VK_SHADER_STAGE_COMPUTE_BIT, push);
+
+		Tools::vk::cmdDispatch(frameInfo.cmd, elementCount, WORKGROUP_SIZE);
+	}
+
+	void TransparentSortPass::sort(FGResourcePool& pool, VkCommandBuffer cmd, uint32_t elementCount)
+	{
+		uint32_t groupCount = RadixSort::groupCount(elementCount);
+		auto& histograms = pool.buffer(m_histograms);
+		std::array keys{ pool.buffer(m_transparentKeys).handle(), pool.buffer(m_scratchKeys).handle() };
+		std::array values{ pool.buffer(m_transparentInstances).handle(), pool.buffer(m_scratchInstances).handle() };
+
+		auto& bindlessSet = Engine::renderer().bindlessDescriptorSet();
+
+		// Even pass count, so the sorted result ends up back in the input buffers
+		static_assert(RadixSort::PASS_COUNT % 2 == 0);
+		for (uint32_t pass = 0; pass < RadixSort::PASS_COUNT; pass++)
+		{
+			uint32_t in = pass % 2;
+			uint32_t out = 1 - in;
+			RadixSortPushConstants push{
+				.keysIn = keys[in],
+				.valuesIn = values[in],
+				.keysOut = keys[out],
+				.valuesOut = values[out],
+				.histograms = histograms.handle(),
+				.elementCount = elementCount,
+				.groupCount = groupCount,
+				.shift = pass * RadixSort::RADIX_BITS,
+			};
+
+			m_histogramPipeline.bind(cmd);
+			m_histogramPipeline.bindDescriptorSet(cmd, 0, bindlessSet);
+			m_histogramPipeline.pushConstants(cmd, VK_SHADER_STAGE_COMPUTE_BIT, push);
+			vkCmdDispatch(cmd, groupCount, 1, 1);
+			computeBarrier(cmd);
+
+			m_scanPipeline.bind(cmd);
+			m_scanPipeline.bindDescriptorSet(cmd, 0, bindlessSet);
+			m_scanPipeline.pushConstants(cmd, VK_SHADER_STAGE_COMPUTE_BIT, push);
+			vkCmdDispatch(cmd, 1, 1, 1);
+			computeBarrier(cmd);
+
+			m_scatterPipeline.bind(cmd);
+			m_scatterPipeline.bindDescriptorSet(cmd, 0, bindlessSet);
+			m_scatterPipeline.pushConstants(cmd, VK_SHADER_STAGE_COMPUTE_BIT, push);
+			vkCmdDispatch(cmd, groupCount, 1, 1);
+			computeBarrier(cmd);
+		}
+	}
+
+	void TransparentSortPass::computeBarrier(VkCommandBuffer cmd)
+	{
+		Tools::vk::cmdMemoryBarrier(cmd,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "graphics/bindless/descriptor_handle.h"
+#include "graphics/draw_batch_registry.h"
+#include "graphics/frame_graph/frame_graph_render_pass.h"
+#include "graphics/pipeline.h"
+
+namespace Aegis::Graphics
+{
+	/// @brief Sorts the visible transparent instances back to front and writes their indirect draws
+	/// @note Order is exact within a draw batch, batches are drawn one after another
+	class TransparentSortPass : public FGRenderPass
+	{
+	public:
+		static constexpr uint32_t WORKGROUP_SIZE = 64;
+
+		struct RadixSortPushConstants
+		{
+			DescriptorHandle keysIn;
+			DescriptorHandle valuesIn;
+			DescriptorHandle keysOut;
+			DescriptorHandle valuesOut;
+			DescriptorHandle histograms;
+			uint32_t elementCount;
+			uint32_t groupCount;
+			uint32_t shift;
+		};
+
+		struct CommandPushConstants
+		{
+			DescriptorHandle staticInstances;
+			DescriptorHandle dynamicInstances;
+			DescriptorHandle drawBatches;
+			DescriptorHandle sortedKeys;
+			DescriptorHandle sortedInstances;
+			DescriptorHandle transparentCount;
+			DescriptorHandle visibility;
+			DescriptorHandle indirectDrawCommands;
+			uint32_t staticInstanceCount;
+		};
+
+		TransparentSortPass(FGResourcePool& pool, DrawBatchRegistry& batcher);
+
+		virtual auto info() -> FGNode::Info override;
+		virtual void execute(FGResourcePool& pool, const FrameInfo& frameInfo) override;
+
+	private:
+		void sort(FGResourcePool& pool, VkCommandBuffer cmd, uint32_t elementCount);
+		void computeBarrier(VkCommandBuffer cmd);
+
+		DrawBatchRegistry& m_drawBatcher;
+		uint32_t m_capacity;
+
+		FGResourceHandle m_staticInstances;
+		FGResourceHandle m_dynamicInstances;
+		FGResourceHandle m_drawBatchBuffer;
+		FGResourceHandle m_transparentKeys;
+		FGResourceHandle m_transparentInstances;
+		FGResourceHandle m_transparentCount;
+		FGResourceHandle m_scratchKeys;
+		FGResourceHandle m_scratchInstances;
+		FGResourceHandle m_histograms;
+		FGResourceHandle m_visibleInstances;
+		FGResourceHandle m_indirectDrawCommands;
+
+		Pipeline m_histogramPipeline;
+		Pipeline m_scanPipeline;
+		Pipeline m_scatterPipeline;
+		Pipeline m_commandPipeline;
+	};
+}
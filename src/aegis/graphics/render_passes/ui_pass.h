@@ -2,6 +2,7 @@
 
 #include "graphics/frame_graph/frame_graph_render_pass.h"
 #include "graphics/vulkan/vulkan_tools.h"
+#include "ui/ui.h"
 
 namespace Aegis::Graphics
 {
@@ -41,7 +42,7 @@ namespace Aegis::Graphics
 
 			vkCmdBeginRendering(cmd, &renderingInfo);
 			{
-				frameInfo.ui.render(cmd);
+				UI::UI::render(cmd);
 			}
 			vkCmdEndRendering(cmd);
 		}
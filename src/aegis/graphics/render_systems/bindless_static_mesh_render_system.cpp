@@ -20,17 +20,15 @@ namespace Aegis::Graphics
 		// TODO: Maybe also for opaque materials but front to back (avoid overdraw)
 
 		MaterialTemplate* lastMatTemplate = nullptr;
-		MaterialInstance* lastMatInstance = nullptr;
 		uint32_t objectIndex = 0;
-		auto view = ctx.scene.registry().view<GlobalTransform, Mesh, Material>();
-		view.use<Material>();
-		for (const auto& [entity, transform, mesh, material] : view.each())
+		for (const auto& instance : ctx.world.meshes)
 		{
-			if (!mesh.staticMesh || !material.instance)
+			auto currentMatTemplate = instance.material->materialTemplate().get();
+			if (!currentMatTemplate || currentMatTemplate->type() != m_type)
 				continue;
 
-			auto currentMatTemplate = material.instance->materialTemplate().get();
-			if (!currentMatTemplate || currentMatTemplate->type() != m_type)
+			// Skip until the pipeline finished compiling in the background
+			if (!currentMatTemplate->isReady())
 				continue;
 
 			// Bind Pipeline
@@ -38,34 +36,29 @@ namespace Aegis::Graphics
 			{
 				currentMatTemplate->bind(ctx.cmd);
 				currentMatTemplate->bindBindlessSet(ctx.cmd);
+				currentMatTemplate->updateParameters(ctx.frameIndex);
 				lastMatTemplate = currentMatTemplate;
 			}
 
-			// Bind Descriptor Set
-			if (lastMatInstance != material.instance.get())
-			{
-				material.instance->updateParameters(ctx.frameIndex);
-				lastMatInstance = material.instance.get();
-			}
-
 			// Push Constants
-			auto globalTransform = transform.matrix();
+			const auto& globalTransform = instance.transform;
 			auto normalMatrix = glm::inverse(glm::mat3{ globalTransform }); // Transpose missing because of row-major storage
 			PushConstantData push{
 				.modelMatrix = glm::rowMajor4(globalTransform),
 				.normalRow0 = normalMatrix[0],
 				.globalBuffer = ctx.globalHandle,
 				.normalRow1 = normalMatrix[1],
-				.meshBuffer = mesh.staticMesh->meshDataBuffer().handle(),
+				.meshBuffer = instance.mesh->meshDataBuffer().handle(),
 				.normalRow2 = normalMatrix[2],
-				.materialBuffer = material.instance->buffer().handle(ctx.frameIndex)
+				.materialBuffer = currentMatTemplate->parameterPool().handle(ctx.frameIndex),
+				.materialIndex = instance.material->parameterIndex()
 			};
 			AGX_ASSERT_X(push.globalBuffer.isValid(), "Global buffer handle is invalid");
 			AGX_ASSERT_X(push.meshBuffer.isValid(), "Mesh buffer handle is invalid");
 			AGX_ASSERT_X(push.materialBuffer.isValid(), "Material buffer handle is invalid");
 
 			currentMatTemplate->pushConstants(ctx.cmd, &push, sizeof(push));
-			currentMatTemplate->draw(ctx.cmd, *mesh.staticMesh);
+			currentMatTemplate->draw(ctx.cmd, *instance.mesh);
 		}
 	}
 }
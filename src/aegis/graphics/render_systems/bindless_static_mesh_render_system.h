@@ -15,6 +15,7 @@ namespace Aegis::Graphics
 			glm::vec3 normalRow0; DescriptorHandle globalBuffer;
 			glm::vec3 normalRow1; DescriptorHandle meshBuffer;
 			glm::vec3 normalRow2; DescriptorHandle materialBuffer;
+			uint32_t materialIndex;
 		};
 
 		BindlessStaticMeshRenderSystem(MaterialType type = MaterialType::Opaque);
@@ -34,13 +34,12 @@ namespace Aegis::Graphics
 		m_pipeline->bind(ctx.cmd);
 		m_pipeline->bindDescriptorSet(ctx.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx.globalSet);
 
-		auto view = ctx.scene.registry().view<GlobalTransform, PointLight>();
-		for (auto&& [entity, transform, light] : view.each())
+		for (const auto& pointLight : ctx.world.pointLights)
 		{
 			PointLightPushConstants push{
-				.position = glm::vec4{ transform.location, 1.0 },
-				.color = glm::vec4{ light.color, 1.0 },
-				.radius = light.intensity * transform.scale.x * pointLightScale
+				.position = glm::vec4{ pointLight.location, 1.0 },
+				.color = glm::vec4{ pointLight.light.color, 1.0 },
+				.radius = pointLight.light.intensity * pointLight.scale * pointLightScale
 			};
 			m_pipeline->pushConstants(ctx.cmd, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, push);
 
@@ -17,17 +17,15 @@ namespace Aegis::Graphics
 		// TODO: Maybe also for opaque materials but front to back (avoid overdraw)
 
 		MaterialTemplate* lastMatTemplate = nullptr;
-		MaterialInstance* lastMatInstance = nullptr;
 
-		auto view = ctx.scene.registry().view<GlobalTransform, Mesh, Material>();
-		view.use<Material>();
-		for (const auto& [entity, transform, mesh, material] : view.each())
+		for (const auto& instance : ctx.world.meshes)
 		{
-			if (!mesh.staticMesh || !material.instance)
+			auto currentMatTemplate = instance.material->materialTemplate().get();
+			if (!currentMatTemplate || currentMatTemplate->type() != m_type)
 				continue;
 
-			auto currentMatTemplate = material.instance->materialTemplate().get();
-			if (!currentMatTemplate || currentMatTemplate->type() != m_type)
+			// Skip until the pipeline finished compiling in the background
+			if (!currentMatTemplate->isReady())
 				continue;
 
 			// Bind Pipeline
@@ -35,25 +33,19 @@ namespace Aegis::Graphics
 			{
 				currentMatTemplate->bind(ctx.cmd);
 				currentMatTemplate->bindBindlessSet(ctx.cmd);
+				currentMatTemplate->updateParameters(ctx.frameIndex);
 				lastMatTemplate = currentMatTemplate;
 			}
 
-			// Bind Descriptor Set
-			if (lastMatInstance != material.instance.get())
-			{
-				material.instance->updateParameters(ctx.frameIndex);
-				lastMatInstance = material.instance.get();
-			}
-
 			// Push Constants
 			PushConstantData push{
-				.modelMatrix = transform.matrix(),
-				.normalMatrix = Math::normalMatrix(transform.rotation, transform.scale)
+				.modelMatrix = instance.transform,
+				.normalMatrix = glm::transpose(glm::inverse(glm::mat3{ instance.transform }))
 			};
 			currentMatTemplate->pushConstants(ctx.cmd, &push, sizeof(push));
 
 			// Draw Mesh
-			currentMatTemplate->draw(ctx.cmd, *mesh.staticMesh);
+			currentMatTemplate->draw(ctx.cmd, *instance.mesh);
 		}
 	}
 }
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "render_world.h"
+
+#include "core/profiler.h"
+
+namespace Aegis::Graphics
+{
+	void RenderWorld::extract(Scene::Scene& scene, bool includeStaticMeshes)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		auto& registry = scene.registry();
+
+		auto mainCamera = scene.mainCamera();
+		AGX_ASSERT_X(mainCamera, "Render World: No main camera set in scene");
+		camera = mainCamera.get<Camera>();
+		cameraLocation = mainCamera.get<GlobalTransform>().location;
+
+		auto ambient = scene.ambientLight();
+		ambientLight = ambient && ambient.has<AmbientLight>() ? ambient.get<AmbientLight>() : AmbientLight{ .intensity = 0.0f };
+
+		// Lights are edited in the editor without a DynamicTag, so their local transform is used
+		auto directional = scene.directionalLight();
+		if (directional && directional.has<DirectionalLight, Transform>())
+		{
+			directionalLight = directional.get<DirectionalLight>();
+			directionalLightDirection = glm::normalize(directional.get<Transform>().forward());
+		}
+		else
+		{
+			directionalLight = DirectionalLight{ .intensity = 0.0f };
+			directionalLightDirection = glm::vec3{ 0.0f, 0.0f, 1.0f };
+		}
+
+		auto skybox = scene.environment();
+		environment = skybox && skybox.has<Environment>() ? skybox.get<Environment>() : Environment{};
+
+		meshes.clear();
+		auto addMesh = [this](const GlobalTransform& transform, const Mesh& mesh, const Material& material)
+			{
+				if (mesh.staticMesh && material.instance && material.instance->materialTemplate())
+					meshes.emplace_back(transform.matrix(), mesh.staticMesh, material.instance);
+			};
+
+		if (includeStaticMeshes)
+		{
+			// Sorted by material to reduce pipeline switches when drawing in order
+			auto view = registry.view<GlobalTransform, Mesh, Material>();
+			view.use<Material>();
+			for (const auto& [entity, transform, mesh, material] : view.each())
+			{
+				addMesh(transform, mesh, material);
+			}
+		}
+		else
+		{
+			auto view = registry.view<GlobalTransform, Mesh, Material, DynamicTag>();
+			for (const auto& [entity, transform, mesh, material] : view.each())
+			{
+				addMesh(transform, mesh, material);
+			}
+		}
+
+		pointLights.clear();
+		auto lightView = registry.view<Transform, PointLight>();
+		for (const auto& [entity, transform, light] : lightView.each())
+		{
+			pointLights.emplace_back(transform.location, transform.scale.x, light);
+		}
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "scene/components.h"
+#include "scene/scene.h"
+
+namespace Aegis::Graphics
+{
+	/// @brief Copy of the render relevant scene state of one frame (written by the extract phase)
+	/// @note The render thread only reads this and never the registry, so the next frame can be simulated meanwhile.
+	///       Draw batches are copied separately by the renderer at the sync point (see Renderer::renderFrame).
+	struct RenderWorld
+	{
+		struct MeshInstance
+		{
+			glm::mat4 transform;
+			std::shared_ptr<StaticMesh> mesh;
+			std::shared_ptr<MaterialInstance> material;
+		};
+
+		struct PointLightInstance
+		{
+			glm::vec3 location;
+			float scale;
+			PointLight light;
+		};
+
+		Camera camera;
+		glm::vec3 cameraLocation{ 0.0f };
+		AmbientLight ambientLight;
+		DirectionalLight directionalLight;
+		glm::vec3 directionalLightDirection{ 0.0f, 0.0f, 1.0f };
+		Environment environment;
+
+		/// @brief Dynamic instances (or all instances if static ones are included, see extract)
+		std::vector<MeshInstance> meshes;
+		std::vector<PointLightInstance> pointLights;
+
+		VkExtent2D windowExtent{};
+		bool swapChainOutdated{ false };
+		bool vsync{ false };
+
+		/// @brief Copies the state of the scene, containers keep their capacity between frames
+		void extract(Scene::Scene& scene, bool includeStaticMeshes);
+	};
+}
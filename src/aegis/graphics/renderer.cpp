@@ -6,6 +6,8 @@
 #include "graphics/render_passes/culling_pass.h"
 #include "graphics/render_passes/geometry_pass.h"
 #include "graphics/render_passes/gpu_driven_geometry.h"
+#include "graphics/render_passes/gpu_driven_transparent.h"
+#include "graphics/render_passes/light_culling_pass.h"
 #include "graphics/render_passes/lighting_pass.h"
 #include "graphics/render_passes/post_processing_pass.h"
 #include "graphics/render_passes/present_pass.h"
@@ -13,6 +15,7 @@
 #include "graphics/render_passes/sky_box_pass.h"
 #include "graphics/render_passes/ssao_pass.h"
 #include "graphics/render_passes/transparent_pass.h"
+#include "graphics/render_passes/transparent_sort_pass.h"
 #include "graphics/render_passes/ui_pass.h"
 #include "graphics/render_systems/bindless_static_mesh_render_system.h"
 #include "graphics/render_systems/point_light_render_system.h"
@@ -27,10 +30,21 @@ namespace Aegis::Graphics
 		m_swapChain{ window.extent() }
 	{
 		createFrameContext();
+
+		if constexpr (ENABLE_RENDER_THREAD)
+		{
+			m_renderThread = std::jthread{ [this](std::stop_token stopToken) { renderThreadLoop(stopToken); } };
+		}
 	}
 
 	Renderer::~Renderer()
 	{
+		if (m_renderThread.joinable())
+		{
+			m_renderThread.request_stop();
+			m_renderThread.join();
+		}
+
 		for (const auto& frame : m_frames)
 		{
 			vkFreeCommandBuffers(VulkanContext::device(), VulkanContext::device().commandPool(), 1, &frame.commandBuffer);
@@ -55,28 +69,136 @@ namespace Aegis::Graphics
 
 	void Renderer::sceneChanged(Scene::Scene& scene)
 	{
+		waitForRenderThread();
 		m_drawBatchRegistry.sceneChanged(scene);
 	}
 
 	void Renderer::sceneInitialized(Scene::Scene& scene)
 	{
+		waitForRenderThread();
+		m_renderDrawBatches = m_drawBatchRegistry;
 		createFrameGraph();
 		m_frameGraph.compile();
 		m_frameGraph.sceneInitialized(scene);
+
+		// All startup pipelines exist now, persist them in case the app doesn't shut down cleanly
+		auto& pipelineCache = VulkanContext::pipelineCache();
+		pipelineCache.logStats();
+		pipelineCache.save();
 	}
 
 	void Renderer::renderFrame(Scene::Scene& scene, UI::UI& ui)
 	{
 		AGX_PROFILE_FUNCTION();
 
+		VkExtent2D extent = m_window.extent();
+		while (extent.width == 0 || extent.height == 0) // minimized
+		{
+			glfwWaitEvents();
+			extent = m_window.extent();
+		}
+
+		auto mainCamera = scene.mainCamera();
+		AGX_ASSERT_X(mainCamera, "Renderer: No main camera set in scene");
+		mainCamera.get<Camera>().aspect = static_cast<float>(extent.width) / static_cast<float>(extent.height);
+
+		// Runs while the render thread still records the previous frame
+		RenderWorld& world = m_renderWorlds[m_extractIndex];
+		world.extract(scene, !ENABLE_GPU_DRIVEN_RENDERING);
+		world.windowExtent = extent;
+		world.swapChainOutdated = m_window.wasResized();
+		world.vsync = m_vsync;
+		m_window.resetResizedFlag();
+
+		waitForRenderThread();
+
+		// Entities may be created during the update, the render thread only reads a copy of the batches
+		m_renderDrawBatches = m_drawBatchRegistry;
+
+		// ImGui is not thread safe, the draw data is built while the render thread is idle
+		ui.build();
+
+		if constexpr (ENABLE_RENDER_THREAD)
+		{
+			{
+				std::lock_guard lock{ m_renderMutex };
+				m_pendingWorld = &world;
+			}
+			m_renderCondition.notify_all();
+		}
+		else
+		{
+			recordFrame(world);
+			m_profileCapture.recordCPU(m_gpuTimerManager.frameNumber());
+		}
+
+		m_extractIndex = (m_extractIndex + 1) % static_cast<uint32_t>(m_renderWorlds.size());
+	}
+
+	void Renderer::waitIdle()
+	{
+		waitForRenderThread();
+
+		std::lock_guard lock{ VulkanContext::device().queueMutex() };
+		vkDeviceWaitIdle(VulkanContext::device());
+	}
+
+	void Renderer::renderThreadLoop(std::stop_token stopToken)
+	{
+		while (true)
+		{
+			const RenderWorld* world = nullptr;
+			{
+				std::unique_lock lock{ m_renderMutex };
+				if (!m_renderCondition.wait(lock, stopToken, [this] { return m_pendingWorld != nullptr; }))
+					return;
+
+				world = m_pendingWorld;
+			}
+
+			recordFrame(*world);
+
+			// The simulation scopes of this frame finished before it was handed over
+			m_profileCapture.recordCPU(m_gpuTimerManager.frameNumber());
+
+			{
+				std::lock_guard lock{ m_renderMutex };
+				m_pendingWorld = nullptr;
+			}
+			m_renderCondition.notify_all();
+		}
+	}
+
+	void Renderer::waitForRenderThread()
+	{
+		if constexpr (ENABLE_RENDER_THREAD)
+		{
+			AGX_PROFILE_SCOPE("Wait for Render Thread");
+
+			std::unique_lock lock{ m_renderMutex };
+			m_renderCondition.wait(lock, [this] { return m_pendingWorld == nullptr; });
+		}
+	}
+
+	void Renderer::recordFrame(const RenderWorld& world)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		m_windowExtent = world.windowExtent;
+		m_swapChainOutdated |= world.swapChainOutdated;
+		if (m_swapChain.isVSync() != world.vsync)
+		{
+			m_swapChain.setVSync(world.vsync);
+			m_swapChainOutdated = true;
+		}
+
 		beginFrame();
 		{
 			AGX_ASSERT_X(m_isFrameStarted, "Frame not started");
 
 			FrameInfo frameInfo{
-				.scene = scene,
-				.ui = ui,
-				.drawBatcher = m_drawBatchRegistry,
+				.world = world,
+				.drawBatcher = m_renderDrawBatches,
 				.cmd = currentCommandBuffer(),
 				.frameIndex = m_currentFrameIndex,
 				.swapChainExtent = m_swapChain.extent(),
@@ -90,11 +212,6 @@ namespace Aegis::Graphics
 		endFrame();
 	}
 
-	void Renderer::waitIdle()
-	{
-		vkDeviceWaitIdle(VulkanContext::device());
-	}
-
 	void Renderer::createFrameContext()
 	{
 		VkFenceCreateInfo fenceInfo{
@@ -123,23 +240,25 @@ namespace Aegis::Graphics
 
 	void Renderer::recreateSwapChain()
 	{
-		VkExtent2D extent = m_window.extent();
-		while (extent.width == 0 || extent.height == 0) // minimized
+		// Called on the render thread, the window is only polled by the main thread (see renderFrame)
+		VkExtent2D extent = m_windowExtent;
+		if (extent.width == 0 || extent.height == 0)
+			return;
+
 		{
-			glfwWaitEvents();
-			extent = m_window.extent();
+			std::lock_guard lock{ VulkanContext::device().queueMutex() };
+			vkDeviceWaitIdle(VulkanContext::device());
 		}
-
-		waitIdle();
 		m_swapChain.resize(extent);
 		m_frameGraph.swapChainResized(extent.width, extent.height);
-		m_window.resetResizedFlag();
+		m_swapChainOutdated = false;
 	}
 
 	void Renderer::createFrameGraph()
 	{
 		// CPU and GPU Driven Geometry Passes are mutually exclusive 
 		// Note: They each need different shaders and pipelines (check asset_manager.cpp)
+		GPUDrivenGeometry* gpuDrivenGeometry = nullptr;
 		if constexpr (!ENABLE_GPU_DRIVEN_RENDERING)
 		{
 			// CPU Driven Rendering Passes
@@ -149,13 +268,15 @@ namespace Aegis::Graphics
 		else
 		{
 			// GPU Driven Rendering Passes 
-			m_frameGraph.add<CullingPass>(m_drawBatchRegistry);
+			m_frameGraph.add<CullingPass>(m_renderDrawBatches);
 			m_frameGraph.add<SceneUpdatePass>();
-			m_frameGraph.add<GPUDrivenGeometry>();
+			gpuDrivenGeometry = &m_frameGraph.add<GPUDrivenGeometry>();
+			m_frameGraph.add<TransparentSortPass>(m_renderDrawBatches);
 		}
 
 		m_frameGraph.add<SkyBoxPass>();
-		m_frameGraph.add<LightingPass>();
+		m_frameGraph.add<LightCullingPass>(m_lightClusters);
+		m_frameGraph.add<LightingPass>(m_lightClusters);
 		m_frameGraph.add<PresentPass>(m_swapChain);
 		m_frameGraph.add<UIPass>();
 		m_frameGraph.add<PostProcessingPass>();
@@ -163,9 +284,12 @@ namespace Aegis::Graphics
 
 		m_frameGraph.add<TransparentPass>()
 			.addRenderSystem<PointLightRenderSystem>();
-		// TODO: Rework transparent rendering with GPU driven approach (need to sort transparents first)
-		// TODO: Alternatively add transparent tag component to avoid iterating all static meshes
-		//transparentPass.addRenderSystem<BindlessStaticMeshRenderSystem>(MaterialType::Transparent);
+
+		// Transparent meshes are only supported by the GPU driven renderer (culled and sorted on the GPU)
+		if constexpr (ENABLE_GPU_DRIVEN_RENDERING)
+		{
+			m_frameGraph.add<GPUDrivenTransparent>(m_lightClusters, *gpuDrivenGeometry);
+		}
 
 		// Disabled for now (gpu performance heavy + noticable blotches when to close to geometry)
 		// TODO: Optimize or replace with better technique (like HBAO)
@@ -179,6 +303,8 @@ namespace Aegis::Graphics
 		FrameContext& frame = m_frames[m_currentFrameIndex];
 		vkWaitForFences(VulkanContext::device(), 1, &frame.inFlightFence, VK_TRUE, std::numeric_limits<uint64_t>::max());
 
+		VulkanContext::memoryTracker().update();
+
 		VkResult result = m_swapChain.acquireNextImage(frame.imageAvailable);
 		if (result == VK_ERROR_OUT_OF_DATE_KHR)
 		{
@@ -198,6 +324,7 @@ namespace Aegis::Graphics
 		m_isFrameStarted = true;
 
 		m_gpuTimerManager.resolveTimings(frame.commandBuffer, m_currentFrameIndex);
+		m_profileCapture.recordGPU(m_gpuTimerManager.resultFrameNumber(), m_gpuTimerManager.timings());
 	}
 
 	void Renderer::endFrame()
@@ -208,6 +335,9 @@ namespace Aegis::Graphics
 		FrameContext& frame = m_frames[m_currentFrameIndex];
 		VK_CHECK(vkEndCommandBuffer(frame.commandBuffer));
 
+		// Descriptors of resources created this frame have to be written before the submit
+		m_bindlessDescriptorSet.flushWrites();
+
 		{
 			AGX_PROFILE_SCOPE("GPU Sync");
 
@@ -228,11 +358,16 @@ namespace Aegis::Graphics
 			.pSignalSemaphores = signalSemaphores,
 		};
 
-		vkResetFences(VulkanContext::device(), 1, &frame.inFlightFence);
-		VK_CHECK(vkQueueSubmit(VulkanContext::device().graphicsQueue(), 1, &submitInfo, frame.inFlightFence));
+		VkResult result;
+		{
+			std::lock_guard lock{ VulkanContext::device().queueMutex() };
+
+			vkResetFences(VulkanContext::device(), 1, &frame.inFlightFence);
+			VK_CHECK(vkQueueSubmit(VulkanContext::device().graphicsQueue(), 1, &submitInfo, frame.inFlightFence));
 
-		auto result = m_swapChain.present();
-		if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_window.wasResized())
+			result = m_swapChain.present();
+		}
+		if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_swapChainOutdated)
 		{
 			recreateSwapChain();
 		}
@@ -6,10 +6,18 @@
 #include "graphics/frame_graph/frame_graph.h"
 #include "graphics/globals.h"
 #include "graphics/gpu_timer.h"
+#include "graphics/light_clusters.h"
+#include "graphics/profile_capture.h"
+#include "graphics/render_world.h"
 #include "graphics/swap_chain.h"
 #include "scene/scene.h"
+#include "ui/ui.h"
 #include "vulkan/vulkan_context.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace Aegis::Graphics
 {
 	class Renderer
@@ -23,6 +31,7 @@ namespace Aegis::Graphics
 		};
 
 		static constexpr bool ENABLE_GPU_DRIVEN_RENDERING{ true };
+		static constexpr bool ENABLE_RENDER_THREAD{ true };
 
 		Renderer(Core::Window& window);
 		Renderer(const Renderer&) = delete;
@@ -37,6 +46,7 @@ namespace Aegis::Graphics
 		[[nodiscard]] auto bindlessDescriptorSet() -> BindlessDescriptorSet& { return m_bindlessDescriptorSet; }
 		[[nodiscard]] auto drawBatchRegistry() -> DrawBatchRegistry& { return m_drawBatchRegistry; }
 		[[nodiscard]] auto frameGraph() -> FrameGraph& { return m_frameGraph; }
+		[[nodiscard]] auto profileCapture() -> ProfileCapture& { return m_profileCapture; }
 		[[nodiscard]] auto aspectRatio() const -> float { return m_swapChain.aspectRatio(); }
 		[[nodiscard]] auto isFrameStarted() const -> bool { return m_isFrameStarted; }
 		[[nodiscard]] auto currentCommandBuffer() const -> VkCommandBuffer;
@@ -48,17 +58,26 @@ namespace Aegis::Graphics
 		/// @brief Called when the scene has changed and AFTER it is initialized
 		void sceneInitialized(Scene::Scene& scene);
 
-		/// @brief Renders the given scene
+		/// @brief Extracts the scene into a render world and hands it to the render thread
+		/// @note Returns once the previous frame is recorded, so the next frame can be simulated while this one records
 		void renderFrame(Scene::Scene& scene, UI::UI& ui);
 
-		/// @brief Waits for the GPU to be idle
+		/// @brief Waits for the render thread and the GPU to be idle
 		void waitIdle();
 
+		/// @brief Switches the present mode to FIFO (vsync), the swap chain is recreated with the next frame
+		void setVSync(bool vsync) { m_vsync = vsync; }
+
 	private:
 		void createFrameContext();
 		void recreateSwapChain();
 		void createFrameGraph();
 
+		void renderThreadLoop(std::stop_token stopToken);
+		void waitForRenderThread();
+
+		/// @brief Records and submits the frame (on the render thread if enabled)
+		void recordFrame(const RenderWorld& world);
 		void beginFrame();
 		void endFrame();
 
@@ -69,11 +88,25 @@ namespace Aegis::Graphics
 		std::array<FrameContext, MAX_FRAMES_IN_FLIGHT> m_frames;
 		uint32_t m_currentFrameIndex{ 0 };
 		bool m_isFrameStarted{ false };
+		bool m_swapChainOutdated{ false };
+		bool m_vsync{ false };
+		VkExtent2D m_windowExtent{};
 
 		BindlessDescriptorSet m_bindlessDescriptorSet;
 		DrawBatchRegistry m_drawBatchRegistry;
+		DrawBatchRegistry m_renderDrawBatches; // Copied at the sync point, read by the render thread
+		LightClusters m_lightClusters;
 		FrameGraph m_frameGraph;
 
 		GPUTimerManager m_gpuTimerManager;
+		ProfileCapture m_profileCapture;
+
+		// Double buffered: the next frame is extracted while the render thread records the previous one
+		std::array<RenderWorld, 2> m_renderWorlds;
+		uint32_t m_extractIndex{ 0 };
+		const RenderWorld* m_pendingWorld{ nullptr };
+		std::mutex m_renderMutex;
+		std::condition_variable_any m_renderCondition;
+		std::jthread m_renderThread;
 	};
 }
@@ -62,6 +62,7 @@ namespace Aegis::Graphics
 			.instanceCount = instanceCount,
 			.usage = otherUsage | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
 			.allocFlags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+			.category = MemoryCategory::Staging,
 		};
 	}
 
@@ -78,6 +79,7 @@ namespace Aegis::Graphics
 		m_alignmentSize = computeAlignment(info.instanceSize, info.minOffsetAlignment);
 		m_bufferSize = m_alignmentSize * m_instanceCount;
 		VulkanContext::device().createBuffer(m_buffer, m_allocation, m_bufferSize, m_usage, info.allocFlags, VMA_MEMORY_USAGE_AUTO);
+		VulkanContext::memoryTracker().track(m_allocation, info.category);
 
 		VmaAllocationInfo allocInfo;
 		vmaGetAllocationInfo(VulkanContext::device().allocator(), m_allocation, &allocInfo);
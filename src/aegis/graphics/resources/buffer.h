@@ -2,6 +2,7 @@
 
 #include "graphics/bindless/descriptor_handle.h"
 #include "graphics/globals.h"
+#include "graphics/vulkan/memory_tracker.h"
 #include "graphics/vulkan/volk_include.h"
 
 #include <vk_mem_alloc.h>
@@ -19,6 +20,7 @@ namespace Aegis::Graphics
 			VkBufferUsageFlags usage{ 0 };
 			VmaAllocationCreateFlags allocFlags{ 0 };
 			VkDeviceSize minOffsetAlignment{ 0 };
+			MemoryCategory category{ MemoryCategory::Other };
 		};
 
 		/// @brief Factory methods for common buffer types
@@ -0,0 +1,453 @@
+#include "pch.h"
+#include "cluster_lod.h"
+
+#include <meshoptimizer.h>
+
+namespace Aegis::Graphics
+{
+	auto ClusterLOD::build(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices,
+		const Settings& settings) -> Hierarchy
+	{
+		AGX_ASSERT_X(!vertices.empty() && !indices.empty(), "Cannot build cluster LOD of an empty mesh");
+		AGX_ASSERT_X(settings.maxLevels >= 1, "Cluster LOD requires at least one level");
+
+		Hierarchy hierarchy{};
+		std::vector<uint32_t> pending = split(vertices, indices, settings, nullptr, 0.0f, 0, hierarchy.clusters);
+		std::vector<uint32_t> remap = positionRemap(vertices);
+
+		for (uint32_t level = 1; level < settings.maxLevels && pending.size() > 1; level++)
+		{
+			std::vector<uint32_t> nextPending;
+			bool simplified = false;
+
+			auto groups = partition(hierarchy.clusters, pending, remap, settings.groupSize);
+			for (const auto& group : groups)
+			{
+				// A single cluster has only locked border vertices left
+				if (group.size() == 1)
+				{
+					nextPending.emplace_back(group.front());
+					continue;
+				}
+
+				std::vector<uint32_t> groupIndices;
+				for (uint32_t clusterID : group)
+				{
+					auto clusterIndices = triangles(hierarchy.clusters[clusterID]);
+					groupIndices.insert(groupIndices.end(), clusterIndices.begin(), clusterIndices.end());
+				}
+
+				size_t targetIndexCount = static_cast<size_t>(groupIndices.size() / 3 * settings.simplifyRatio) * 3;
+				float simplifyError = 0.0f;
+				auto simplifiedIndices = simplify(vertices, groupIndices, targetIndexCount, simplifyError);
+				if (simplifiedIndices.empty() ||
+					simplifiedIndices.size() > static_cast<size_t>(groupIndices.size() * settings.minReduction))
+				{
+					nextPending.insert(nextPending.end(), group.begin(), group.end());
+					continue;
+				}
+
+				// Parent error and bounds must never be smaller than those of the children (monotonic cut selection)
+				std::vector<StaticMesh::BoundingSphere> childBounds;
+				childBounds.reserve(group.size());
+				float groupError = simplifyError;
+				for (uint32_t clusterID : group)
+				{
+					childBounds.emplace_back(hierarchy.clusters[clusterID].lodBounds);
+					groupError = std::max(groupError, hierarchy.clusters[clusterID].lodError);
+				}
+				auto groupBounds = mergeSpheres(childBounds);
+
+				for (uint32_t clusterID : group)
+				{
+					hierarchy.clusters[clusterID].parentBounds = groupBounds;
+					hierarchy.clusters[clusterID].parentError = groupError;
+				}
+
+				auto parents = split(vertices, simplifiedIndices, settings, &groupBounds, groupError, level, hierarchy.clusters);
+				nextPending.insert(nextPending.end(), parents.begin(), parents.end());
+
+				hierarchy.groups.emplace_back(Group{
+					.children = group,
+					.parents = std::move(parents),
+					.bounds = groupBounds,
+					.error = groupError
+					});
+
+				simplified = true;
+			}
+
+			if (!simplified)
+				break;
+
+			pending = std::move(nextPending);
+			hierarchy.levelCount = level + 1;
+		}
+
+		return hierarchy;
+	}
+
+	auto ClusterLOD::validateHierarchy(const Hierarchy& hierarchy) -> bool
+	{
+		for (const auto& cluster : hierarchy.clusters)
+		{
+			if (cluster.lodError > cluster.parentError)
+				return false;
+		}
+
+		for (const auto& group : hierarchy.groups)
+		{
+			for (uint32_t childID : group.children)
+			{
+				const auto& child = hierarchy.clusters[childID];
+				if (child.parentError != group.error || !containsSphere(group.bounds, child.lodBounds))
+					return false;
+			}
+
+			for (uint32_t parentID : group.parents)
+			{
+				const auto& parent = hierarchy.clusters[parentID];
+				if (parent.lodError != group.error || !containsSphere(parent.lodBounds, group.bounds))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	auto ClusterLOD::projectedError(const StaticMesh::BoundingSphere& bounds, float error, const View& view) -> float
+	{
+		float distance = std::max(glm::length(bounds.center - view.position) - bounds.radius, 1e-4f);
+		return error / distance * view.errorScale;
+	}
+
+	auto ClusterLOD::isSelected(const Cluster& cluster, const View& view) -> bool
+	{
+		return projectedError(cluster.lodBounds, cluster.lodError, view) <= view.errorThreshold &&
+			projectedError(cluster.parentBounds, cluster.parentError, view) > view.errorThreshold;
+	}
+
+	auto ClusterLOD::selectCut(const Hierarchy& hierarchy, const View& view) -> std::vector<uint32_t>
+	{
+		std::vector<uint32_t> cut;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(hierarchy.clusters.size()); i++)
+		{
+			if (isSelected(hierarchy.clusters[i], view))
+				cut.emplace_back(i);
+		}
+		return cut;
+	}
+
+	auto ClusterLOD::validateCut(const Hierarchy& hierarchy, const std::vector<uint32_t>& cut,
+		const std::vector<StaticMesh::Vertex>& vertices) -> bool
+	{
+		auto remap = positionRemap(vertices);
+		auto openEdges = [&remap](const std::vector<uint32_t>& indices) {
+			std::unordered_map<uint64_t, uint32_t> edgeCounts;
+			for (size_t i = 0; i < indices.size(); i += 3)
+			{
+				for (size_t e = 0; e < 3; e++)
+				{
+					uint32_t a = remap[indices[i + e]];
+					uint32_t b = remap[indices[i + (e + 1) % 3]];
+					if (a > b)
+						std::swap(a, b);
+					edgeCounts[(static_cast<uint64_t>(a) << 32) | b]++;
+				}
+			}
+
+			std::vector<uint64_t> edges;
+			for (const auto& [edge, count] : edgeCounts)
+			{
+				if (count == 1)
+					edges.emplace_back(edge);
+			}
+			std::sort(edges.begin(), edges.end());
+			return edges;
+		};
+
+		std::vector<uint32_t> sourceIndices;
+		std::vector<uint32_t> cutIndices;
+		for (const auto& cluster : hierarchy.clusters)
+		{
+			if (cluster.level != 0)
+				continue;
+
+			auto clusterIndices = triangles(cluster);
+			sourceIndices.insert(sourceIndices.end(), clusterIndices.begin(), clusterIndices.end());
+		}
+		for (uint32_t clusterID : cut)
+		{
+			auto clusterIndices = triangles(hierarchy.clusters[clusterID]);
+			cutIndices.insert(cutIndices.end(), clusterIndices.begin(), clusterIndices.end());
+		}
+
+		if (cutIndices.empty())
+			return false;
+
+		return openEdges(sourceIndices) == openEdges(cutIndices);
+	}
+
+	auto ClusterLOD::triangles(const Cluster& cluster) -> std::vector<uint32_t>
+	{
+		std::vector<uint32_t> indices(cluster.primitives.size());
+		for (size_t i = 0; i < cluster.primitives.size(); i++)
+		{
+			indices[i] = cluster.vertices[cluster.primitives[i]];
+		}
+		return indices;
+	}
+
+	auto ClusterLOD::split(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices,
+		const Settings& settings, const StaticMesh::BoundingSphere* lodBounds, float lodError, uint32_t level,
+		std::vector<Cluster>& clusters) -> std::vector<uint32_t>
+	{
+		// Compact vertices to keep meshoptimizer allocations proportional to the cluster group
+		std::unordered_map<uint32_t, uint32_t> globalToLocal;
+		std::vector<uint32_t> localToGlobal;
+		std::vector<uint32_t> localIndices(indices.size());
+		for (size_t i = 0; i < indices.size(); i++)
+		{
+			auto [it, inserted] = globalToLocal.try_emplace(indices[i], static_cast<uint32_t>(localToGlobal.size()));
+			if (inserted)
+				localToGlobal.emplace_back(indices[i]);
+
+			localIndices[i] = it->second;
+		}
+
+		std::vector<glm::vec3> positions(localToGlobal.size());
+		for (size_t i = 0; i < localToGlobal.size(); i++)
+		{
+			positions[i] = vertices[localToGlobal[i]].position;
+		}
+
+		size_t maxMeshlets = meshopt_buildMeshletsBound(localIndices.size(), settings.maxVertices, settings.maxTriangles);
+		std::vector<meshopt_Meshlet> meshlets(maxMeshlets);
+		std::vector<uint32_t> meshletVertices(maxMeshlets * settings.maxVertices);
+		std::vector<uint8_t> meshletPrimitives(maxMeshlets * settings.maxTriangles * 3);
+
+		size_t meshletCount = meshopt_buildMeshlets(
+			meshlets.data(),
+			meshletVertices.data(),
+			meshletPrimitives.data(),
+			localIndices.data(),
+			localIndices.size(),
+			&positions[0].x,
+			positions.size(),
+			sizeof(glm::vec3),
+			settings.maxVertices,
+			settings.maxTriangles,
+			settings.coneWeight);
+
+		std::vector<uint32_t> clusterIDs;
+		clusterIDs.reserve(meshletCount);
+		for (size_t i = 0; i < meshletCount; i++)
+		{
+			const auto& meshlet = meshlets[i];
+
+			Cluster cluster{};
+			cluster.level = level;
+			cluster.lodError = lodError;
+			cluster.vertices.resize(meshlet.vertex_count);
+			for (size_t v = 0; v < meshlet.vertex_count; v++)
+			{
+				cluster.vertices[v] = localToGlobal[meshletVertices[meshlet.vertex_offset + v]];
+			}
+			cluster.primitives.assign(
+				meshletPrimitives.begin() + meshlet.triangle_offset,
+				meshletPrimitives.begin() + meshlet.triangle_offset + meshlet.triangle_count * 3);
+
+			if (lodBounds)
+			{
+				cluster.lodBounds = *lodBounds;
+			}
+			else
+			{
+				meshopt_Bounds bounds = meshopt_computeMeshletBounds(
+					&meshletVertices[meshlet.vertex_offset],
+					&meshletPrimitives[meshlet.triangle_offset],
+					meshlet.triangle_count,
+					&positions[0].x,
+					positions.size(),
+					sizeof(glm::vec3));
+
+				cluster.lodBounds = { glm::vec3{ bounds.center[0], bounds.center[1], bounds.center[2] }, bounds.radius };
+			}
+			cluster.parentBounds = cluster.lodBounds;
+
+			clusterIDs.emplace_back(static_cast<uint32_t>(clusters.size()));
+			clusters.emplace_back(std::move(cluster));
+		}
+		return clusterIDs;
+	}
+
+	auto ClusterLOD::simplify(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices,
+		size_t targetIndexCount, float& error) -> std::vector<uint32_t>
+	{
+		std::unordered_map<uint32_t, uint32_t> globalToLocal;
+		std::vector<uint32_t> localToGlobal;
+		std::vector<uint32_t> localIndices(indices.size());
+		for (size_t i = 0; i < indices.size(); i++)
+		{
+			auto [it, inserted] = globalToLocal.try_emplace(indices[i], static_cast<uint32_t>(localToGlobal.size()));
+			if (inserted)
+				localToGlobal.emplace_back(indices[i]);
+
+			localIndices[i] = it->second;
+		}
+
+		std::vector<glm::vec3> positions(localToGlobal.size());
+		for (size_t i = 0; i < localToGlobal.size(); i++)
+		{
+			positions[i] = vertices[localToGlobal[i]].position;
+		}
+
+		// Locking the group border keeps the edges shared with neighbouring groups intact (no cracks)
+		std::vector<uint32_t> simplified(localIndices.size());
+		float relativeError = 0.0f;
+		size_t indexCount = meshopt_simplify(
+			simplified.data(),
+			localIndices.data(),
+			localIndices.size(),
+			&positions[0].x,
+			positions.size(),
+			sizeof(glm::vec3),
+			targetIndexCount,
+			std::numeric_limits<float>::max(),
+			meshopt_SimplifyLockBorder,
+			&relativeError);
+
+		error = relativeError * meshopt_simplifyScale(&positions[0].x, positions.size(), sizeof(glm::vec3));
+
+		simplified.resize(indexCount);
+		for (auto& index : simplified)
+		{
+			index = localToGlobal[index];
+		}
+		return simplified;
+	}
+
+	auto ClusterLOD::partition(const std::vector<Cluster>& clusters, const std::vector<uint32_t>& pending,
+		const std::vector<uint32_t>& positionRemap, size_t groupSize) -> std::vector<std::vector<uint32_t>>
+	{
+		// Adjacency between clusters weighted by the number of shared edges
+		std::vector<std::unordered_map<uint32_t, uint32_t>> adjacency(pending.size());
+		std::unordered_map<uint64_t, uint32_t> edgeOwners;
+		for (uint32_t slot = 0; slot < static_cast<uint32_t>(pending.size()); slot++)
+		{
+			auto indices = triangles(clusters[pending[slot]]);
+			for (size_t i = 0; i < indices.size(); i += 3)
+			{
+				for (size_t e = 0; e < 3; e++)
+				{
+					uint32_t a = positionRemap[indices[i + e]];
+					uint32_t b = positionRemap[indices[i + (e + 1) % 3]];
+					if (a > b)
+						std::swap(a, b);
+
+					auto [it, inserted] = edgeOwners.try_emplace((static_cast<uint64_t>(a) << 32) | b, slot);
+					if (!inserted && it->second != slot)
+					{
+						adjacency[slot][it->second]++;
+						adjacency[it->second][slot]++;
+					}
+				}
+			}
+		}
+
+		// Greedily grow groups along the strongest connections (pending clusters are spatially coherent)
+		std::vector<std::vector<uint32_t>> groups;
+		std::vector<bool> assigned(pending.size(), false);
+		for (uint32_t seed = 0; seed < static_cast<uint32_t>(pending.size()); seed++)
+		{
+			if (assigned[seed])
+				continue;
+
+			std::vector<uint32_t> group{ seed };
+			assigned[seed] = true;
+			while (group.size() < groupSize)
+			{
+				uint32_t best = std::numeric_limits<uint32_t>::max();
+				uint32_t bestWeight = 0;
+				for (uint32_t member : group)
+				{
+					for (const auto& [neighbour, weight] : adjacency[member])
+					{
+						if (!assigned[neighbour] && weight > bestWeight)
+						{
+							best = neighbour;
+							bestWeight = weight;
+						}
+					}
+				}
+
+				if (bestWeight == 0)
+					break;
+
+				group.emplace_back(best);
+				assigned[best] = true;
+			}
+
+			for (auto& slot : group)
+			{
+				slot = pending[slot];
+			}
+			groups.emplace_back(std::move(group));
+		}
+		return groups;
+	}
+
+	auto ClusterLOD::positionRemap(const std::vector<StaticMesh::Vertex>& vertices) -> std::vector<uint32_t>
+	{
+		// Maps every vertex to the first vertex with the same position (ignores attribute seams)
+		std::vector<uint32_t> identity(vertices.size());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(vertices.size()); i++)
+		{
+			identity[i] = i;
+		}
+
+		std::vector<uint32_t> remap(vertices.size());
+		meshopt_generateShadowIndexBuffer(
+			remap.data(),
+			identity.data(),
+			identity.size(),
+			vertices.data(),
+			vertices.size(),
+			sizeof(glm::vec3),
+			sizeof(StaticMesh::Vertex));
+		return remap;
+	}
+
+	auto ClusterLOD::mergeSpheres(const std::vector<StaticMesh::BoundingSphere>& spheres) -> StaticMesh::BoundingSphere
+	{
+		AGX_ASSERT_X(!spheres.empty(), "Cannot merge an empty list of spheres");
+
+		auto largest = std::max_element(spheres.begin(), spheres.end(),
+			[](const auto& a, const auto& b) { return a.radius < b.radius; });
+
+		StaticMesh::BoundingSphere merged = *largest;
+		for (const auto& sphere : spheres)
+		{
+			float distance = glm::length(sphere.center - merged.center);
+			if (distance + sphere.radius <= merged.radius)
+				continue;
+
+			if (distance + merged.radius <= sphere.radius)
+			{
+				merged = sphere;
+				continue;
+			}
+
+			float radius = (distance + merged.radius + sphere.radius) * 0.5f;
+			merged.center += (sphere.center - merged.center) * ((radius - merged.radius) / distance);
+			merged.radius = radius;
+		}
+		return merged;
+	}
+
+	auto ClusterLOD::containsSphere(const StaticMesh::BoundingSphere& outer, const StaticMesh::BoundingSphere& inner) -> bool
+	{
+		// Tolerance for the rounding of the incremental sphere merge
+		float tolerance = std::max(outer.radius, 1.0f) * 1e-4f;
+		return glm::length(inner.center - outer.center) + inner.radius <= outer.radius + tolerance;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "graphics/resources/static_mesh.h"
+
+#include <glm/glm.hpp>
+
+namespace Aegis::Graphics
+{
+	/// @brief Builds a continuous level of detail hierarchy (DAG) out of meshlets
+	/// @note Neighbouring clusters are grouped, simplified with locked group borders and split again into parent
+	///       clusters. Selecting every cluster whose own error is acceptable but whose parent error is not results
+	///       in a watertight cut through the DAG, because all clusters of a group share the same parent error.
+	class ClusterLOD
+	{
+	public:
+		static constexpr uint32_t MAX_LEVELS = 16;
+
+		struct Settings
+		{
+			size_t maxVertices = 64;
+			size_t maxTriangles = 126;
+			float coneWeight = 0.0f;
+			size_t groupSize = 4;
+			float simplifyRatio = 0.5f;
+			float minReduction = 0.85f; // Groups reducing less than this are retried on the next level
+			uint32_t maxLevels = MAX_LEVELS;
+		};
+
+		struct Cluster
+		{
+			std::vector<uint32_t> vertices;  // Indices into the mesh vertex buffer
+			std::vector<uint8_t> primitives; // Cluster local triangle indices
+			StaticMesh::BoundingSphere lodBounds;
+			float lodError = 0.0f;
+			StaticMesh::BoundingSphere parentBounds;
+			float parentError = std::numeric_limits<float>::max();
+			uint32_t level = 0;
+		};
+
+		struct Group
+		{
+			std::vector<uint32_t> children;
+			std::vector<uint32_t> parents;
+			StaticMesh::BoundingSphere bounds;
+			float error;
+		};
+
+		struct Hierarchy
+		{
+			std::vector<Cluster> clusters;
+			std::vector<Group> groups;
+			uint32_t levelCount = 1;
+		};
+
+		/// @brief Viewpoint used to select a cut through the hierarchy (mirrors the task shader)
+		struct View
+		{
+			glm::vec3 position;
+			float errorScale;     // Pixels per unit of error at a distance of one
+			float errorThreshold; // Max allowed error in pixels
+		};
+
+		static auto build(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices,
+			const Settings& settings) -> Hierarchy;
+
+		/// @brief Returns true if error and bounds never shrink from a cluster to its parents
+		/// @note The per cluster test only yields a single watertight cut if the projected error grows monotonically
+		///       along the DAG, which requires every parent sphere to contain the child spheres with at least their error
+		static auto validateHierarchy(const Hierarchy& hierarchy) -> bool;
+
+		/// @brief Returns the error of a cluster projected to the screen
+		static auto projectedError(const StaticMesh::BoundingSphere& bounds, float error, const View& view) -> float;
+
+		/// @brief Returns true if the cluster is part of the cut for the given view
+		static auto isSelected(const Cluster& cluster, const View& view) -> bool;
+
+		/// @brief Returns the indices of all clusters that are part of the cut for the given view
+		static auto selectCut(const Hierarchy& hierarchy, const View& view) -> std::vector<uint32_t>;
+
+		/// @brief Returns true if the cut is crack free (the open edges of the cut match those of the source mesh)
+		static auto validateCut(const Hierarchy& hierarchy, const std::vector<uint32_t>& cut,
+			const std::vector<StaticMesh::Vertex>& vertices) -> bool;
+
+		/// @brief Expands the cluster into a triangle list indexing the mesh vertex buffer
+		static auto triangles(const Cluster& cluster) -> std::vector<uint32_t>;
+
+	private:
+		static auto split(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices,
+			const Settings& settings, const StaticMesh::BoundingSphere* lodBounds, float lodError, uint32_t level,
+			std::vector<Cluster>& clusters) -> std::vector<uint32_t>;
+
+		static auto simplify(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices,
+			size_t targetIndexCount, float& error) -> std::vector<uint32_t>;
+
+		static auto partition(const std::vector<Cluster>& clusters, const std::vector<uint32_t>& pending,
+			const std::vector<uint32_t>& positionRemap, size_t groupSize) -> std::vector<std::vector<uint32_t>>;
+
+		static auto positionRemap(const std::vector<StaticMesh::Vertex>& vertices) -> std::vector<uint32_t>;
+		static auto mergeSpheres(const std::vector<StaticMesh::BoundingSphere>& spheres) -> StaticMesh::BoundingSphere;
+		static auto containsSphere(const StaticMesh::BoundingSphere& outer, const StaticMesh::BoundingSphere& inner) -> bool;
+	};
+}
@@ -10,7 +10,8 @@ namespace Aegis::Graphics
 		m_extent{ info.extent },
 		m_format{ info.format },
 		m_mipLevels{ info.mipLevels },
-		m_layerCount{ info.layerCount }
+		m_layerCount{ info.layerCount },
+		m_category{ info.category }
 	{
 		create(info);
 	}
@@ -24,6 +25,7 @@ namespace Aegis::Graphics
 		m_mipLevels = other.m_mipLevels;
 		m_layerCount = other.m_layerCount;
 		m_layout = other.m_layout;
+		m_category = other.m_category;
 
 		other.m_image = VK_NULL_HANDLE;
 		other.m_allocation = VK_NULL_HANDLE;
@@ -47,6 +49,7 @@ namespace Aegis::Graphics
 			m_mipLevels = other.m_mipLevels;
 			m_layerCount = other.m_layerCount;
 			m_layout = other.m_layout;
+			m_category = other.m_category;
 			other.m_image = VK_NULL_HANDLE;
 			other.m_allocation = VK_NULL_HANDLE;
 		}
@@ -104,6 +107,7 @@ namespace Aegis::Graphics
 		};
 
 		VulkanContext::device().createImage(m_image, m_allocation, imageInfo, allocInfo);
+		VulkanContext::memoryTracker().track(m_allocation, config.category);
 	}
 
 	void Image::copyFrom(VkCommandBuffer cmd, const Buffer& src)
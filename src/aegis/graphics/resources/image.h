@@ -20,6 +20,7 @@ namespace Aegis::Graphics
 			VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 			VkImageType imageType = VK_IMAGE_TYPE_2D;
 			VkImageCreateFlags flags = 0;
+			MemoryCategory category = MemoryCategory::Texture;
 		};
 
 		Image() = default;
@@ -42,6 +43,7 @@ namespace Aegis::Graphics
 		[[nodiscard]] auto mipLevels() const -> uint32_t { return m_mipLevels; }
 		[[nodiscard]] auto layerCount() const -> uint32_t { return m_layerCount; }
 		[[nodiscard]] auto layout() const -> VkImageLayout { return m_layout; }
+		[[nodiscard]] auto category() const -> MemoryCategory { return m_category; }
 
 		void upload(const Buffer& buffer);
 		void upload(const void* data, VkDeviceSize size);
@@ -75,5 +77,6 @@ namespace Aegis::Graphics
 		uint32_t m_mipLevels = 1;
 		uint32_t m_layerCount = 1;
 		VkImageLayout m_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+		MemoryCategory m_category = MemoryCategory::Texture;
 	};
 }
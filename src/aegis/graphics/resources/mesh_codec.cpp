@@ -0,0 +1,395 @@
+#include "pch.h"
+#include "mesh_codec.h"
+
+#include "core/globals.h"
+#include "core/profiler.h"
+#include "core/thread_pool.h"
+#include "utils/file.h"
+
+#include <cstring>
+#include <format>
+
+#include <meshoptimizer.h>
+
+namespace Aegis::Graphics
+{
+	namespace
+	{
+		// The vertex codec requires element sizes that are a multiple of 4
+		constexpr size_t PRIMITIVE_STRIDE = 4;
+
+		auto alignedPrimitiveCount(size_t count) -> size_t
+		{
+			return (count + PRIMITIVE_STRIDE - 1) / PRIMITIVE_STRIDE * PRIMITIVE_STRIDE;
+		}
+
+		auto encodeVertexStream(const void* data, size_t count, size_t stride) -> std::vector<char>
+		{
+			std::vector<char> encoded(meshopt_encodeVertexBufferBound(count, stride));
+			encoded.resize(meshopt_encodeVertexBuffer(reinterpret_cast<unsigned char*>(encoded.data()),
+				encoded.size(), data, count, stride));
+			return encoded;
+		}
+	}
+
+	auto MeshCodec::encode(const StaticMesh::CreateInfo& info) -> std::vector<char>
+	{
+		AGX_ASSERT_X(!info.indices.empty() && !info.meshlets.empty(), "Cannot encode an empty mesh");
+
+		Header header{
+			.vertexFormat = info.quantizedVertices.empty() ? StaticMesh::VertexFormat::Full : StaticMesh::VertexFormat::Quantized,
+			.vertexCount = static_cast<uint32_t>(info.quantizedVertices.empty() ? info.vertices.size() : info.quantizedVertices.size()),
+			.indexCount = static_cast<uint32_t>(info.indices.size()),
+			.meshletCount = static_cast<uint32_t>(info.meshlets.size()),
+			.baseMeshletCount = info.baseMeshletCount,
+			.vertexIndexCount = static_cast<uint32_t>(info.vertexIndices.size()),
+			.primitiveIndexCount = static_cast<uint32_t>(info.primitiveIndices.size()),
+			.bounds = info.bounds,
+			.positionOffset = info.positionOffset,
+			.positionScale = info.positionScale,
+		};
+
+		std::array<std::vector<char>, Stream::Count> streams;
+
+		const void* vertexData = header.vertexFormat == StaticMesh::VertexFormat::Quantized
+			? static_cast<const void*>(info.quantizedVertices.data())
+			: static_cast<const void*>(info.vertices.data());
+		streams[Stream::Vertices] = encodeVertexStream(vertexData, header.vertexCount, vertexSize(header.vertexFormat));
+
+		streams[Stream::Indices].resize(meshopt_encodeIndexBufferBound(info.indices.size(), header.vertexCount));
+		streams[Stream::Indices].resize(meshopt_encodeIndexBuffer(
+			reinterpret_cast<unsigned char*>(streams[Stream::Indices].data()), streams[Stream::Indices].size(),
+			info.indices.data(), info.indices.size()));
+
+		streams[Stream::Meshlets] = encodeVertexStream(info.meshlets.data(), info.meshlets.size(), sizeof(StaticMesh::Meshlet));
+
+		streams[Stream::VertexIndices].resize(meshopt_encodeIndexSequenceBound(info.vertexIndices.size(), header.vertexCount));
+		streams[Stream::VertexIndices].resize(meshopt_encodeIndexSequence(
+			reinterpret_cast<unsigned char*>(streams[Stream::VertexIndices].data()), streams[Stream::VertexIndices].size(),
+			info.vertexIndices.data(), info.vertexIndices.size()));
+
+		std::vector<uint8_t> primitives = info.primitiveIndices;
+		primitives.resize(alignedPrimitiveCount(primitives.size()), 0);
+		streams[Stream::PrimitiveIndices] = encodeVertexStream(primitives.data(), primitives.size() / PRIMITIVE_STRIDE, PRIMITIVE_STRIDE);
+
+		size_t totalSize = sizeof(Header);
+		for (uint32_t i = 0; i < Stream::Count; i++)
+		{
+			header.streamSizes[i] = streams[i].size();
+			totalSize += streams[i].size();
+		}
+
+		std::vector<char> data;
+		data.reserve(totalSize);
+		data.insert(data.end(), reinterpret_cast<const char*>(&header), reinterpret_cast<const char*>(&header) + sizeof(Header));
+		for (const auto& stream : streams)
+		{
+			data.insert(data.end(), stream.begin(), stream.end());
+		}
+		return data;
+	}
+
+	auto MeshCodec::decode(const std::vector<char>& data) -> std::optional<StaticMesh::CreateInfo>
+	{
+		auto header = readHeader(data);
+		if (!header)
+			return std::nullopt;
+
+		auto views = streamViews(data, *header);
+		if (!views)
+			return std::nullopt;
+
+		StaticMesh::CreateInfo info{
+			.positionOffset = header->positionOffset,
+			.positionScale = header->positionScale,
+			.bounds = header->bounds
+		};
+		if (header->vertexFormat == StaticMesh::VertexFormat::Quantized)
+		{
+			info.quantizedVertices.resize(header->vertexCount);
+		}
+		else
+		{
+			info.vertices.resize(header->vertexCount);
+		}
+		info.indices.resize(header->indexCount);
+		info.meshlets.resize(header->meshletCount);
+		info.baseMeshletCount = header->baseMeshletCount;
+		info.vertexIndices.resize(header->vertexIndexCount);
+		info.primitiveIndices.resize(decodedSize(*header, Stream::PrimitiveIndices));
+
+		std::array<void*, Stream::Count> targets{
+			header->vertexFormat == StaticMesh::VertexFormat::Quantized
+				? static_cast<void*>(info.quantizedVertices.data())
+				: static_cast<void*>(info.vertices.data()),
+			info.indices.data(),
+			info.meshlets.data(),
+			info.vertexIndices.data(),
+			info.primitiveIndices.data()
+		};
+
+		if (!decodeStreams(*header, *views, targets) || !validMeshlets(*header, info.meshlets.data()))
+			return std::nullopt;
+
+		info.primitiveIndices.resize(header->primitiveIndexCount);
+		return info;
+	}
+
+	auto MeshCodec::decodeToStaging(const std::vector<char>& data) -> std::optional<StaticMesh::StagingInfo>
+	{
+		auto header = readHeader(data);
+		if (!header)
+			return std::nullopt;
+
+		auto views = streamViews(data, *header);
+		if (!views)
+			return std::nullopt;
+
+		StaticMesh::StagingInfo info{
+			.vertices = Buffer{ Buffer::stagingBuffer(decodedSize(*header, Stream::Vertices)) },
+			.indices = Buffer{ Buffer::stagingBuffer(decodedSize(*header, Stream::Indices)) },
+			.meshlets = Buffer{ Buffer::stagingBuffer(decodedSize(*header, Stream::Meshlets)) },
+			.vertexIndices = Buffer{ Buffer::stagingBuffer(decodedSize(*header, Stream::VertexIndices)) },
+			.primitiveIndices = Buffer{ Buffer::stagingBuffer(decodedSize(*header, Stream::PrimitiveIndices)) },
+			.vertexFormat = header->vertexFormat,
+			.positionOffset = header->positionOffset,
+			.positionScale = header->positionScale,
+			.vertexCount = header->vertexCount,
+			.indexCount = header->indexCount,
+			.meshletCount = header->meshletCount,
+			.baseMeshletCount = header->baseMeshletCount,
+			.vertexIndexCount = header->vertexIndexCount,
+			.primitiveIndexCount = header->primitiveIndexCount,
+			.bounds = header->bounds
+		};
+
+		// Staging buffers are persistently mapped, so workers decode directly into them
+		std::array<Buffer*, Stream::Count> buffers{
+			&info.vertices, &info.indices, &info.meshlets, &info.vertexIndices, &info.primitiveIndices
+		};
+		std::array<void*, Stream::Count> targets;
+		for (uint32_t i = 0; i < Stream::Count; i++)
+		{
+			targets[i] = buffers[i]->data<uint8_t>();
+		}
+
+		if (!decodeStreams(*header, *views, targets) || !validMeshlets(*header, info.meshlets.data<StaticMesh::Meshlet>()))
+			return std::nullopt;
+
+		for (auto buffer : buffers)
+		{
+			buffer->flush();
+		}
+		return info;
+	}
+
+	auto MeshCodec::save(const std::filesystem::path& path, const StaticMesh::CreateInfo& info) -> bool
+	{
+		return File::writeBinary(path, encode(info));
+	}
+
+	auto MeshCodec::load(const std::filesystem::path& path) -> std::shared_ptr<StaticMesh>
+	{
+		auto data = File::readBinary(path);
+		if (data.empty())
+		{
+			ALOG::warn("Failed to read cooked mesh '{}'", path.string());
+			return nullptr;
+		}
+
+		auto stagingInfo = decodeToStaging(data);
+		if (!stagingInfo)
+		{
+			ALOG::warn("Cooked mesh '{}' is outdated or corrupt", path.string());
+			return nullptr;
+		}
+		return std::make_shared<StaticMesh>(*stagingInfo);
+	}
+
+	auto MeshCodec::loadOrImport(const std::filesystem::path& source, const std::string& meshName,
+		const MeshPreprocessor::Options& options, const std::function<StaticMesh::CreateInfo()>& import) -> std::shared_ptr<StaticMesh>
+	{
+		AGX_PROFILE_FUNCTION();
+
+		auto path = cookedPath(source, meshName, options);
+
+		std::error_code error;
+		auto cookedTime = std::filesystem::last_write_time(path, error);
+		if (!error && cookedTime >= std::filesystem::last_write_time(source, error) && !error)
+		{
+			if (auto mesh = load(path))
+				return mesh;
+		}
+
+		auto info = import();
+
+		std::filesystem::create_directories(path.parent_path(), error);
+		if (!save(path, info))
+		{
+			ALOG::warn("Failed to write cooked mesh '{}'", path.string());
+		}
+		return std::make_shared<StaticMesh>(info);
+	}
+
+	auto MeshCodec::cookedPath(const std::filesystem::path& source, const std::string& meshName,
+		const MeshPreprocessor::Options& options) -> std::filesystem::path
+	{
+		auto key = std::format("{}|{}|{}{}", std::filesystem::absolute(source).lexically_normal().string(), meshName,
+			options.generateClusterLOD, options.quantizeVertices);
+		auto fileName = std::format("{}_{:016x}.agxm", source.stem().string(), std::hash<std::string>{}(key));
+		return std::filesystem::path{ CACHE_DIR "meshes" } / fileName;
+	}
+
+	auto MeshCodec::readHeader(const std::vector<char>& data) -> std::optional<Header>
+	{
+		// Cooked files come from disk, so these are checked in release builds as well
+		if (data.size() < sizeof(Header))
+		{
+			ALOG::warn("Encoded mesh data is too small");
+			return std::nullopt;
+		}
+
+		Header header;
+		std::memcpy(&header, data.data(), sizeof(Header));
+		if (header.magic != MAGIC || header.version != VERSION)
+		{
+			ALOG::warn("Encoded mesh data has an invalid magic number or an unsupported version ({})", header.version);
+			return std::nullopt;
+		}
+
+		bool validFormat = header.vertexFormat == StaticMesh::VertexFormat::Full ||
+			header.vertexFormat == StaticMesh::VertexFormat::Quantized;
+		bool validCounts = header.indexCount % 3 == 0 && header.primitiveIndexCount % 3 == 0 &&
+			header.baseMeshletCount <= header.meshletCount;
+		if (!validFormat || !validCounts)
+		{
+			ALOG::warn("Encoded mesh data has an invalid header");
+			return std::nullopt;
+		}
+		return header;
+	}
+
+	auto MeshCodec::streamViews(const std::vector<char>& data, const Header& header) -> std::optional<std::array<StreamView, Stream::Count>>
+	{
+		std::array<StreamView, Stream::Count> views;
+		size_t offset = sizeof(Header);
+		for (uint32_t i = 0; i < Stream::Count; i++)
+		{
+			if (header.streamSizes[i] > data.size() - offset)
+			{
+				ALOG::warn("Encoded mesh streams exceed data size");
+				return std::nullopt;
+			}
+
+			views[i] = StreamView{ data.data() + offset, static_cast<size_t>(header.streamSizes[i]) };
+			offset += header.streamSizes[i];
+		}
+		return views;
+	}
+
+	auto MeshCodec::decodedSize(const Header& header, Stream stream) -> size_t
+	{
+		switch (stream)
+		{
+		case Stream::Vertices:
+			return header.vertexCount * vertexSize(header.vertexFormat);
+		case Stream::Indices:
+			return header.indexCount * sizeof(uint32_t);
+		case Stream::Meshlets:
+			return header.meshletCount * sizeof(StaticMesh::Meshlet);
+		case Stream::VertexIndices:
+			return header.vertexIndexCount * sizeof(uint32_t);
+		case Stream::PrimitiveIndices:
+			return alignedPrimitiveCount(header.primitiveIndexCount) * sizeof(uint8_t);
+		default:
+			AGX_UNREACHABLE("Unknown mesh stream");
+			return 0;
+		}
+	}
+
+	auto MeshCodec::vertexSize(StaticMesh::VertexFormat format) -> size_t
+	{
+		return format == StaticMesh::VertexFormat::Quantized ? sizeof(StaticMesh::QuantizedVertex) : sizeof(StaticMesh::Vertex);
+	}
+
+	auto MeshCodec::decodeStreams(const Header& header, const std::array<StreamView, Stream::Count>& views,
+		const std::array<void*, Stream::Count>& targets) -> bool
+	{
+		if (Core::ThreadPool::isWorkerThread())
+		{
+			bool success = true;
+			for (uint32_t i = 0; i < Stream::Count; i++)
+			{
+				success &= decodeStream(header, static_cast<Stream>(i), views[i], targets[i]);
+			}
+			return success;
+		}
+
+		std::array<std::future<bool>, Stream::Count> tasks;
+		for (uint32_t i = 0; i < Stream::Count; i++)
+		{
+			tasks[i] = Core::ThreadPool::instance().submit([&, i]() {
+				return decodeStream(header, static_cast<Stream>(i), views[i], targets[i]);
+				});
+		}
+
+		bool success = true;
+		for (auto& task : tasks)
+		{
+			success &= task.get();
+		}
+		return success;
+	}
+
+	auto MeshCodec::decodeStream(const Header& header, Stream stream, const StreamView& src, void* dst) -> bool
+	{
+		auto srcData = reinterpret_cast<const unsigned char*>(src.data);
+
+		int result = 0;
+		switch (stream)
+		{
+		case Stream::Vertices:
+			result = meshopt_decodeVertexBuffer(dst, header.vertexCount, vertexSize(header.vertexFormat), srcData, src.size);
+			break;
+		case Stream::Indices:
+			result = meshopt_decodeIndexBuffer(dst, header.indexCount, sizeof(uint32_t), srcData, src.size);
+			break;
+		case Stream::Meshlets:
+			result = meshopt_decodeVertexBuffer(dst, header.meshletCount, sizeof(StaticMesh::Meshlet), srcData, src.size);
+			break;
+		case Stream::VertexIndices:
+			result = meshopt_decodeIndexSequence(dst, header.vertexIndexCount, sizeof(uint32_t), srcData, src.size);
+			break;
+		case Stream::PrimitiveIndices:
+			result = meshopt_decodeVertexBuffer(dst, alignedPrimitiveCount(header.primitiveIndexCount) / PRIMITIVE_STRIDE,
+				PRIMITIVE_STRIDE, srcData, src.size);
+			break;
+		default:
+			AGX_UNREACHABLE("Unknown mesh stream");
+		}
+
+		if (result != 0)
+		{
+			ALOG::warn("Failed to decode mesh stream {} (error {})", static_cast<uint32_t>(stream), result);
+			return false;
+		}
+		return true;
+	}
+
+	auto MeshCodec::validMeshlets(const Header& header, const StaticMesh::Meshlet* meshlets) -> bool
+	{
+		// Meshlet ranges index the other streams in the mesh shader
+		for (uint32_t i = 0; i < header.meshletCount; i++)
+		{
+			const auto& meshlet = meshlets[i];
+			bool validVertices = static_cast<uint64_t>(meshlet.vertexOffset) + meshlet.vertexCount <= header.vertexIndexCount;
+			bool validPrimitives = static_cast<uint64_t>(meshlet.primitiveOffset) + meshlet.primitiveCount * 3u <= header.primitiveIndexCount;
+			if (!validVertices || !validPrimitives)
+			{
+				ALOG::warn("Encoded mesh meshlet {} is out of range", i);
+				return false;
+			}
+		}
+		return true;
+	}
+}
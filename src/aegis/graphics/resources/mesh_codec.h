@@ -0,0 +1,86 @@
+#pragma once
+
+#include "graphics/resources/mesh_preprocessor.h"
+#include "graphics/resources/static_mesh.h"
+
+namespace Aegis::Graphics
+{
+	/// @brief Compresses cooked mesh data with the meshoptimizer vertex and index codecs
+	/// @note Streams are decoded in parallel on the thread pool, either into CPU memory or straight into staging buffers.
+	///       Called from a pool worker (e.g. async asset loading) the streams are decoded inline instead, since waiting
+	///       on the pool from one of its workers can deadlock.
+	class MeshCodec
+	{
+	public:
+		static constexpr uint32_t MAGIC = 0x4D584741; // 'AGXM'
+		static constexpr uint32_t VERSION = 2;
+
+		enum Stream : uint32_t
+		{
+			Vertices,
+			Indices,
+			Meshlets,
+			VertexIndices,
+			PrimitiveIndices,
+			Count
+		};
+
+		struct Header
+		{
+			uint32_t magic{ MAGIC };
+			uint32_t version{ VERSION };
+			StaticMesh::VertexFormat vertexFormat{ StaticMesh::VertexFormat::Full };
+			uint32_t vertexCount{ 0 };
+			uint32_t indexCount{ 0 };
+			uint32_t meshletCount{ 0 };
+			uint32_t baseMeshletCount{ 0 };
+			uint32_t vertexIndexCount{ 0 };
+			uint32_t primitiveIndexCount{ 0 };
+			StaticMesh::BoundingSphere bounds;
+			glm::vec3 positionOffset{ 0.0f };
+			glm::vec3 positionScale{ 1.0f };
+			uint64_t streamSizes[Stream::Count]{};
+		};
+
+		static auto encode(const StaticMesh::CreateInfo& info) -> std::vector<char>;
+
+		/// @brief Decodes the data into CPU memory, returns nothing if the data is truncated or corrupt
+		static auto decode(const std::vector<char>& data) -> std::optional<StaticMesh::CreateInfo>;
+
+		/// @brief Decodes the data into staging buffers, returns nothing if the data is truncated or corrupt
+		static auto decodeToStaging(const std::vector<char>& data) -> std::optional<StaticMesh::StagingInfo>;
+
+		static auto save(const std::filesystem::path& path, const StaticMesh::CreateInfo& info) -> bool;
+
+		/// @brief Loads a cooked mesh, returns nullptr if the file is missing, outdated or corrupt
+		/// @note Callers fall back to importing the source asset in that case
+		static auto load(const std::filesystem::path& path) -> std::shared_ptr<StaticMesh>;
+
+		/// @brief Loads the cooked mesh of a source asset, or imports it and cooks it for the next load
+		/// @param source Path of the source asset, it is imported again if it is newer than the cooked file
+		/// @param meshName Identifies the mesh within the source asset (e.g. glTF mesh and primitive index)
+		/// @param import Reads and preprocesses the mesh from the source asset
+		static auto loadOrImport(const std::filesystem::path& source, const std::string& meshName,
+			const MeshPreprocessor::Options& options, const std::function<StaticMesh::CreateInfo()>& import) -> std::shared_ptr<StaticMesh>;
+
+		/// @brief Returns the path of the cooked file in the cache directory, unique per source, mesh and options
+		static auto cookedPath(const std::filesystem::path& source, const std::string& meshName,
+			const MeshPreprocessor::Options& options) -> std::filesystem::path;
+
+	private:
+		struct StreamView
+		{
+			const char* data;
+			size_t size;
+		};
+
+		static auto readHeader(const std::vector<char>& data) -> std::optional<Header>;
+		static auto streamViews(const std::vector<char>& data, const Header& header) -> std::optional<std::array<StreamView, Stream::Count>>;
+		static auto decodedSize(const Header& header, Stream stream) -> size_t;
+		static auto vertexSize(StaticMesh::VertexFormat format) -> size_t;
+		static auto decodeStreams(const Header& header, const std::array<StreamView, Stream::Count>& views,
+			const std::array<void*, Stream::Count>& targets) -> bool;
+		static auto decodeStream(const Header& header, Stream stream, const StreamView& src, void* dst) -> bool;
+		static auto validMeshlets(const Header& header, const StaticMesh::Meshlet* meshlets) -> bool;
+	};
+}
@@ -77,49 +77,54 @@ namespace Aegis::Graphics
 			.radius = bounds.radius,
 		};
 
-		// Meshlet generation
+		// Meshlet generation (level 0 of the cluster hierarchy holds the full detail meshlets)
 
-		size_t maxMeshlets = meshopt_buildMeshletsBound(
-			indices.size(),
-			input.maxVerticesPerMeshlet,
-			input.maxTrianglesPerMeshlet);
-
-		std::vector<meshopt_Meshlet> meshoptMeshlets(maxMeshlets);
-		std::vector<uint32_t> meshletVertices(indexCount);
-		std::vector<uint8_t> meshletPrimitives(indexCount);
+		ClusterLOD::Settings lodSettings{
+			.maxVertices = input.maxVerticesPerMeshlet,
+			.maxTriangles = input.maxTrianglesPerMeshlet,
+			.coneWeight = input.coneWeight,
+			.maxLevels = input.options.generateClusterLOD ? ClusterLOD::MAX_LEVELS : 1,
+		};
+		auto hierarchy = ClusterLOD::build(vertices, indices, lodSettings);
+		if (input.options.generateClusterLOD && !ClusterLOD::validateHierarchy(hierarchy))
+		{
+			ALOG::warn("Cluster LOD: Errors are not monotonic, the mesh falls back to full detail meshlets");
+			lodSettings.maxLevels = 1;
+			hierarchy = ClusterLOD::build(vertices, indices, lodSettings);
+		}
 
-		size_t meshletCount = meshopt_buildMeshlets(
-			meshoptMeshlets.data(),
-			meshletVertices.data(),
-			meshletPrimitives.data(),
-			indices.data(),
-			indices.size(),
-			&vertices[0].position.x,
-			vertices.size(),
-			sizeof(StaticMesh::Vertex),
-			input.maxVerticesPerMeshlet,
-			input.maxTrianglesPerMeshlet,
-			input.coneWeight);
+		// Level 0 is split first, so the full detail meshlets are at the front
+		auto baseMeshletCount = static_cast<uint32_t>(std::ranges::count_if(hierarchy.clusters,
+			[](const ClusterLOD::Cluster& cluster) { return cluster.level == 0; }));
 
-		const auto& lastMeshlet = meshoptMeshlets[meshletCount - 1];
-		meshoptMeshlets.resize(meshletCount);
-		meshletVertices.resize(lastMeshlet.vertex_offset + lastMeshlet.vertex_count);
-		meshletPrimitives.resize(lastMeshlet.triangle_offset + lastMeshlet.triangle_count * 3);
+#ifndef NDEBUG
+		if (input.options.generateClusterLOD)
+			validateClusterLOD(hierarchy, vertices, meshBounds);
+#endif // !NDEBUG
 
 		std::vector<StaticMesh::Meshlet> meshlets;
-		meshlets.reserve(meshletCount);
-		for (auto& meshlet : meshoptMeshlets)
+		std::vector<uint32_t> meshletVertices;
+		std::vector<uint8_t> meshletPrimitives;
+		meshlets.reserve(hierarchy.clusters.size());
+		for (const auto& cluster : hierarchy.clusters)
 		{
+			uint32_t vertexOffset = static_cast<uint32_t>(meshletVertices.size());
+			uint32_t primitiveOffset = static_cast<uint32_t>(meshletPrimitives.size());
+			size_t vertexCount = cluster.vertices.size();
+			size_t triangleCount = cluster.primitives.size() / 3;
+			meshletVertices.insert(meshletVertices.end(), cluster.vertices.begin(), cluster.vertices.end());
+			meshletPrimitives.insert(meshletPrimitives.end(), cluster.primitives.begin(), cluster.primitives.end());
+
 			meshopt_optimizeMeshlet(
-				&meshletVertices[meshlet.vertex_offset],
-				&meshletPrimitives[meshlet.triangle_offset],
-				meshlet.triangle_count,
-				meshlet.vertex_count);
+				&meshletVertices[vertexOffset],
+				&meshletPrimitives[primitiveOffset],
+				triangleCount,
+				vertexCount);
 
 			meshopt_Bounds bounds = meshopt_computeMeshletBounds(
-				&meshletVertices[meshlet.vertex_offset],
-				&meshletPrimitives[meshlet.triangle_offset],
-				meshlet.triangle_count,
+				&meshletVertices[vertexOffset],
+				&meshletPrimitives[primitiveOffset],
+				triangleCount,
 				&vertices[0].position.x,
 				vertices.size(),
 				sizeof(StaticMesh::Vertex));
@@ -128,19 +133,40 @@ namespace Aegis::Graphics
 				.bounds = { glm::vec3{ bounds.center[0], bounds.center[1], bounds.center[2] }, bounds.radius },
 				.coneAxis = { bounds.cone_axis_s8[0], bounds.cone_axis_s8[1], bounds.cone_axis_s8[2] },
 				.coneCutoff = bounds.cone_cutoff_s8,
-				.vertexOffset = meshlet.vertex_offset,
-				.primitiveOffset = meshlet.triangle_offset,
-				.vertexCount = static_cast<uint8_t>(meshlet.vertex_count),
-				.primitiveCount = static_cast<uint8_t>(meshlet.triangle_count),
+				.vertexOffset = vertexOffset,
+				.primitiveOffset = primitiveOffset,
+				.vertexCount = static_cast<uint8_t>(vertexCount),
+				.primitiveCount = static_cast<uint8_t>(triangleCount),
+				.lodBounds = cluster.lodBounds,
+				.lodError = cluster.lodError,
+				.parentBounds = cluster.parentBounds,
+				.parentError = cluster.parentError,
 				});
 		}
 
 		// Fill CreateInfo
 
+		if (input.options.quantizeVertices)
+		{
+			auto [positionOffset, positionScale] = positionBounds(vertices);
+			return StaticMesh::CreateInfo{
+				.quantizedVertices = quantize(vertices, positionOffset, positionScale),
+				.positionOffset = positionOffset,
+				.positionScale = positionScale,
+				.indices = std::move(indices),
+				.meshlets = std::move(meshlets),
+				.baseMeshletCount = baseMeshletCount,
+				.vertexIndices = std::move(meshletVertices),
+				.primitiveIndices = std::move(meshletPrimitives),
+				.bounds = meshBounds
+			};
+		}
+
 		return StaticMesh::CreateInfo{
 			.vertices = std::move(vertices),
 			.indices = std::move(indices),
 			.meshlets = std::move(meshlets),
+			.baseMeshletCount = baseMeshletCount,
 			.vertexIndices = std::move(meshletVertices),
 			.primitiveIndices = std::move(meshletPrimitives),
 			.bounds = meshBounds
@@ -161,4 +187,82 @@ namespace Aegis::Graphics
 		}
 		return vertices;
 	}
+
+	auto MeshPreprocessor::positionBounds(const std::vector<StaticMesh::Vertex>& vertices) -> std::pair<glm::vec3, glm::vec3>
+	{
+		glm::vec3 min{ std::numeric_limits<float>::max() };
+		glm::vec3 max{ std::numeric_limits<float>::lowest() };
+		for (const auto& vertex : vertices)
+		{
+			min = glm::min(min, vertex.position);
+			max = glm::max(max, vertex.position);
+		}
+		return { min, glm::max(max - min, glm::vec3{ std::numeric_limits<float>::epsilon() }) };
+	}
+
+	auto MeshPreprocessor::quantize(const std::vector<StaticMesh::Vertex>& vertices, const glm::vec3& positionOffset,
+		const glm::vec3& positionScale) -> std::vector<StaticMesh::QuantizedVertex>
+	{
+		std::vector<StaticMesh::QuantizedVertex> quantized(vertices.size());
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			const auto& vertex = vertices[i];
+			glm::vec3 position = (vertex.position - positionOffset) / positionScale;
+			glm::vec2 normal = octahedralEncode(vertex.normal);
+
+			quantized[i] = StaticMesh::QuantizedVertex{
+				.position = {
+					static_cast<uint16_t>(meshopt_quantizeUnorm(position.x, 16)),
+					static_cast<uint16_t>(meshopt_quantizeUnorm(position.y, 16)),
+					static_cast<uint16_t>(meshopt_quantizeUnorm(position.z, 16)),
+					0 },
+				.normal = {
+					static_cast<int16_t>(meshopt_quantizeSnorm(normal.x, 16)),
+					static_cast<int16_t>(meshopt_quantizeSnorm(normal.y, 16)) },
+				.uv = {
+					meshopt_quantizeHalf(vertex.uv.x),
+					meshopt_quantizeHalf(vertex.uv.y) },
+				.color = {
+					static_cast<uint8_t>(meshopt_quantizeUnorm(vertex.color.r, 8)),
+					static_cast<uint8_t>(meshopt_quantizeUnorm(vertex.color.g, 8)),
+					static_cast<uint8_t>(meshopt_quantizeUnorm(vertex.color.b, 8)),
+					255 },
+			};
+		}
+		return quantized;
+	}
+
+	auto MeshPreprocessor::octahedralEncode(const glm::vec3& normal) -> glm::vec2
+	{
+		glm::vec3 n = normal / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+		if (n.z < 0.0f)
+		{
+			glm::vec2 signs{ n.x >= 0.0f ? 1.0f : -1.0f, n.y >= 0.0f ? 1.0f : -1.0f };
+			return (1.0f - glm::abs(glm::vec2{ n.y, n.x })) * signs;
+		}
+		return { n.x, n.y };
+	}
+
+	void MeshPreprocessor::validateClusterLOD(const ClusterLOD::Hierarchy& hierarchy,
+		const std::vector<StaticMesh::Vertex>& vertices, const StaticMesh::BoundingSphere& bounds)
+	{
+		// Approximately 1080p with a vertical fov of 60 degrees
+		constexpr float errorScale = 0.5f * 1080.0f / 0.577f;
+		constexpr float distances[] = { 1.5f, 4.0f, 16.0f, 64.0f };
+
+		for (float distance : distances)
+		{
+			ClusterLOD::View view{
+				.position = bounds.center + glm::vec3{ 0.0f, 0.0f, bounds.radius * distance },
+				.errorScale = errorScale,
+				.errorThreshold = 1.0f
+			};
+
+			auto cut = ClusterLOD::selectCut(hierarchy, view);
+			if (!ClusterLOD::validateCut(hierarchy, cut, vertices))
+			{
+				ALOG::warn("Cluster LOD: Cut at distance {} is not watertight ({} clusters selected)", distance, cut.size());
+			}
+		}
+	}
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "graphics/resources/cluster_lod.h"
 #include "graphics/resources/static_mesh.h"
 
 namespace Aegis::Graphics
@@ -7,6 +8,13 @@ namespace Aegis::Graphics
 	class MeshPreprocessor
 	{
 	public:
+		/// @brief Optional processing steps, chosen per import (see Scene::load)
+		struct Options
+		{
+			bool generateClusterLOD = false; // Builds the meshlet hierarchy for continuous LOD
+			bool quantizeVertices = false;   // Stores vertices as StaticMesh::QuantizedVertex
+		};
+
 		struct Input
 		{
 			std::vector<glm::vec3> positions; // Required
@@ -20,11 +28,19 @@ namespace Aegis::Graphics
 			size_t maxVerticesPerMeshlet = 64;
 			size_t maxTrianglesPerMeshlet = 126;
 			float coneWeight = 0; 
+
+			Options options;
 		};
 
 		static auto process(Input& input) -> StaticMesh::CreateInfo;
 
 	private:
 		static auto interleave(const Input& input) -> std::vector<StaticMesh::Vertex>;
+		static auto positionBounds(const std::vector<StaticMesh::Vertex>& vertices) -> std::pair<glm::vec3, glm::vec3>;
+		static auto quantize(const std::vector<StaticMesh::Vertex>& vertices, const glm::vec3& positionOffset,
+			const glm::vec3& positionScale) -> std::vector<StaticMesh::QuantizedVertex>;
+		static auto octahedralEncode(const glm::vec3& normal) -> glm::vec2;
+		static void validateClusterLOD(const ClusterLOD::Hierarchy& hierarchy,
+			const std::vector<StaticMesh::Vertex>& vertices, const StaticMesh::BoundingSphere& bounds);
 	};
 }
\ No newline at end of file
@@ -6,6 +6,15 @@
 
 namespace Aegis::Graphics
 {
+	namespace
+	{
+		auto meshBuffer(Buffer::CreateInfo info) -> Buffer::CreateInfo
+		{
+			info.category = MemoryCategory::Mesh;
+			return info;
+		}
+	}
+
 	auto StaticMesh::bindingDescription() -> VkVertexInputBindingDescription
 	{
 		static VkVertexInputBindingDescription bindingDescription{
@@ -48,24 +57,83 @@ namespace Aegis::Graphics
 	}
 
 	StaticMesh::StaticMesh(const CreateInfo& info) :
-		m_vertexBuffer{ Buffer::vertexBuffer(sizeof(Vertex) * info.vertices.size(), 1, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) },
-		m_indexBuffer{ Buffer::indexBuffer(sizeof(uint32_t) * info.indices.size(), 1, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) },
-		m_meshletBuffer{ Buffer::storageBuffer(sizeof(Meshlet) * info.meshlets.size()) },
-		m_meshletVertexBuffer{ Buffer::storageBuffer(sizeof(uint32_t) * info.vertexIndices.size()) },
-		m_meshletPrimitiveBuffer{ Buffer::storageBuffer(sizeof(uint8_t) * info.primitiveIndices.size()) },
-		m_meshDataBuffer{ Buffer::uniformBuffer(sizeof(MeshData)) },
-		m_vertexCount{ static_cast<uint32_t>(info.vertices.size()) },
+		m_vertexBuffer{ meshBuffer(Buffer::vertexBuffer(info.quantizedVertices.empty()
+			? sizeof(Vertex) * info.vertices.size()
+			: sizeof(QuantizedVertex) * info.quantizedVertices.size(), 1, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)) },
+		m_indexBuffer{ meshBuffer(Buffer::indexBuffer(sizeof(uint32_t) * info.indices.size(), 1, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)) },
+		m_meshletBuffer{ meshBuffer(Buffer::storageBuffer(sizeof(Meshlet) * info.meshlets.size())) },
+		m_meshletVertexBuffer{ meshBuffer(Buffer::storageBuffer(sizeof(uint32_t) * info.vertexIndices.size())) },
+		m_meshletPrimitiveBuffer{ meshBuffer(Buffer::storageBuffer(sizeof(uint8_t) * info.primitiveIndices.size())) },
+		m_meshDataBuffer{ meshBuffer(Buffer::uniformBuffer(sizeof(MeshData))) },
+		m_vertexCount{ static_cast<uint32_t>(info.quantizedVertices.empty() ? info.vertices.size() : info.quantizedVertices.size()) },
 		m_indexCount{ static_cast<uint32_t>(info.indices.size()) },
 		m_meshletCount{ static_cast<uint32_t>(info.meshlets.size()) },
+		m_baseMeshletCount{ info.baseMeshletCount > 0 ? info.baseMeshletCount : static_cast<uint32_t>(info.meshlets.size()) },
 		m_meshletIndexCount{ static_cast<uint32_t>(info.vertexIndices.size()) },
-		m_meshletPrimitiveCount{ static_cast<uint32_t>(info.primitiveIndices.size()) }
+		m_meshletPrimitiveCount{ static_cast<uint32_t>(info.primitiveIndices.size()) },
+		m_vertexFormat{ info.quantizedVertices.empty() ? VertexFormat::Full : VertexFormat::Quantized }
 	{
-		m_vertexBuffer.buffer().upload(info.vertices);
+		if (m_vertexFormat == VertexFormat::Quantized)
+		{
+			m_vertexBuffer.buffer().upload(info.quantizedVertices);
+		}
+		else
+		{
+			m_vertexBuffer.buffer().upload(info.vertices);
+		}
 		m_indexBuffer.buffer().upload(info.indices);
 		m_meshletBuffer.buffer().upload(info.meshlets);
 		m_meshletVertexBuffer.buffer().upload(info.vertexIndices);
 		m_meshletPrimitiveBuffer.buffer().upload(info.primitiveIndices);
 
+		writeMeshData(info.bounds, info.positionOffset, info.positionScale);
+	}
+
+	StaticMesh::StaticMesh(StagingInfo& info) :
+		m_vertexBuffer{ meshBuffer(Buffer::vertexBuffer(info.vertices.bufferSize(), 1, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)) },
+		m_indexBuffer{ meshBuffer(Buffer::indexBuffer(info.indices.bufferSize(), 1, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)) },
+		m_meshletBuffer{ meshBuffer(Buffer::storageBuffer(info.meshlets.bufferSize())) },
+		m_meshletVertexBuffer{ meshBuffer(Buffer::storageBuffer(info.vertexIndices.bufferSize())) },
+		m_meshletPrimitiveBuffer{ meshBuffer(Buffer::storageBuffer(info.primitiveIndices.bufferSize())) },
+		m_meshDataBuffer{ meshBuffer(Buffer::uniformBuffer(sizeof(MeshData))) },
+		m_vertexCount{ info.vertexCount },
+		m_indexCount{ info.indexCount },
+		m_meshletCount{ info.meshletCount },
+		m_baseMeshletCount{ info.baseMeshletCount > 0 ? info.baseMeshletCount : info.meshletCount },
+		m_meshletIndexCount{ info.vertexIndexCount },
+		m_meshletPrimitiveCount{ info.primitiveIndexCount },
+		m_vertexFormat{ info.vertexFormat }
+	{
+		info.vertices.copyTo(m_vertexBuffer.buffer(), info.vertices.bufferSize());
+		info.indices.copyTo(m_indexBuffer.buffer(), info.indices.bufferSize());
+		info.meshlets.copyTo(m_meshletBuffer.buffer(), info.meshlets.bufferSize());
+		info.vertexIndices.copyTo(m_meshletVertexBuffer.buffer(), info.vertexIndices.bufferSize());
+		info.primitiveIndices.copyTo(m_meshletPrimitiveBuffer.buffer(), info.primitiveIndices.bufferSize());
+
+		writeMeshData(info.bounds, info.positionOffset, info.positionScale);
+	}
+
+	void StaticMesh::draw(VkCommandBuffer cmd) const
+	{
+		AGX_ASSERT_X(m_vertexFormat == VertexFormat::Full, "Quantized meshes can only be drawn with mesh shaders");
+
+		VkBuffer vertexBuffers[] = { m_vertexBuffer.buffer() };
+		VkDeviceSize offsets[] = { 0 };
+		vkCmdBindVertexBuffers(cmd, 0, 1, vertexBuffers, offsets);
+		vkCmdBindIndexBuffer(cmd, m_indexBuffer.buffer(), 0, VK_INDEX_TYPE_UINT32);
+		vkCmdDrawIndexed(cmd, m_indexCount, 1, 0, 0, 0);
+	}
+
+	void StaticMesh::drawMeshlets(VkCommandBuffer cmd) const
+	{
+		// The coarser levels of a cluster hierarchy would overlap the full detail meshlets
+		vkCmdDrawMeshTasksEXT(cmd, m_baseMeshletCount, 1, 1);
+	}
+
+	void StaticMesh::writeMeshData(const BoundingSphere& bounds, const glm::vec3& positionOffset, const glm::vec3& positionScale)
+	{
+		m_bounds = bounds;
+
 		MeshData meshData{
 			.vertexBuffer = m_vertexBuffer.handle(),
 			.indexBuffer = m_indexBuffer.handle(),
@@ -75,7 +143,10 @@ namespace Aegis::Graphics
 			.vertexCount = m_vertexCount,
 			.indexCount = m_indexCount,
 			.meshletCount = m_meshletCount,
-			.bounds = info.bounds
+			.bounds = bounds,
+			.positionOffset = positionOffset,
+			.vertexFormat = m_vertexFormat,
+			.positionScale = positionScale
 		};
 		AGX_ASSERT_X(meshData.vertexBuffer.isValid(), "Invalid vertex buffer handle in StaticMesh!");
 		AGX_ASSERT_X(meshData.meshletBuffer.isValid(), "Invalid meshlet buffer handle in StaticMesh!");
@@ -90,18 +161,4 @@ namespace Aegis::Graphics
 		Tools::vk::setDebugUtilsObjectName(m_meshletPrimitiveBuffer.buffer(), "StaticMesh Meshlet Primitives");
 		Tools::vk::setDebugUtilsObjectName(m_meshDataBuffer.buffer(), "StaticMesh Mesh Data");
 	}
-
-	void StaticMesh::draw(VkCommandBuffer cmd) const
-	{
-		VkBuffer vertexBuffers[] = { m_vertexBuffer.buffer() };
-		VkDeviceSize offsets[] = { 0 };
-		vkCmdBindVertexBuffers(cmd, 0, 1, vertexBuffers, offsets);
-		vkCmdBindIndexBuffer(cmd, m_indexBuffer.buffer(), 0, VK_INDEX_TYPE_UINT32);
-		vkCmdDrawIndexed(cmd, m_indexCount, 1, 0, 0, 0);
-	}
-
-	void StaticMesh::drawMeshlets(VkCommandBuffer cmd) const
-	{
-		vkCmdDrawMeshTasksEXT(cmd, m_meshletCount, 1, 1);
-	}
 }
\ No newline at end of file
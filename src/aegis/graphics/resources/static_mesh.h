@@ -11,6 +11,12 @@ namespace Aegis::Graphics
 	class StaticMesh
 	{
 	public:
+		enum class VertexFormat : uint32_t
+		{
+			Full,
+			Quantized
+		};
+
 		struct Vertex
 		{
 			glm::vec3 position;
@@ -19,6 +25,15 @@ namespace Aegis::Graphics
 			glm::vec3 color;
 		};
 
+		/// @brief Compact vertex layout (20 instead of 44 bytes), decoded in the mesh shaders
+		struct QuantizedVertex
+		{
+			uint16_t position[4]; // Unorm relative to the mesh position offset and scale (w unused)
+			int16_t normal[2];    // Octahedral encoded snorm
+			uint16_t uv[2];       // Half float
+			uint8_t color[4];     // Unorm (a unused)
+		};
+
 		struct BoundingSphere
 		{
 			glm::vec3 center;
@@ -34,9 +49,13 @@ namespace Aegis::Graphics
 			uint32_t primitiveOffset;
 			uint8_t vertexCount;
 			uint8_t primitiveCount;
+			BoundingSphere lodBounds;
+			float lodError;
+			BoundingSphere parentBounds;
+			float parentError;
 		};
 
-		struct MeshData
+		struct alignas(16) MeshData
 		{
 			DescriptorHandle vertexBuffer;
 			DescriptorHandle indexBuffer;
@@ -47,22 +66,50 @@ namespace Aegis::Graphics
 			uint32_t indexCount;
 			uint32_t meshletCount;
 			BoundingSphere bounds;
+			glm::vec3 positionOffset;
+			VertexFormat vertexFormat;
+			glm::vec3 positionScale;
 		};
 
 		struct CreateInfo
 		{
 			std::vector<Vertex> vertices;
+			std::vector<QuantizedVertex> quantizedVertices; // Used instead of vertices if not empty
+			glm::vec3 positionOffset{ 0.0f };
+			glm::vec3 positionScale{ 1.0f };
 			std::vector<uint32_t> indices;
 			std::vector<Meshlet> meshlets;
+			uint32_t baseMeshletCount{ 0 }; // Full detail meshlets (LOD level 0) at the front, 0 if all are
 			std::vector<uint32_t> vertexIndices;
 			std::vector<uint8_t> primitiveIndices;
 			BoundingSphere bounds;
 		};
 
+		/// @brief Mesh data already written to staging buffers (e.g. decoded by MeshCodec)
+		struct StagingInfo
+		{
+			Buffer vertices;
+			Buffer indices;
+			Buffer meshlets;
+			Buffer vertexIndices;
+			Buffer primitiveIndices;
+			VertexFormat vertexFormat{ VertexFormat::Full };
+			glm::vec3 positionOffset{ 0.0f };
+			glm::vec3 positionScale{ 1.0f };
+			uint32_t vertexCount{ 0 };
+			uint32_t indexCount{ 0 };
+			uint32_t meshletCount{ 0 };
+			uint32_t baseMeshletCount{ 0 };
+			uint32_t vertexIndexCount{ 0 };
+			uint32_t primitiveIndexCount{ 0 };
+			BoundingSphere bounds;
+		};
+
 		static auto bindingDescription() -> VkVertexInputBindingDescription;
 		static auto attributeDescriptions() -> std::vector<VkVertexInputAttributeDescription>;
 
 		StaticMesh(const CreateInfo& info);
+		StaticMesh(StagingInfo& info);
 		StaticMesh(const StaticMesh&) = delete;
 		StaticMesh(StaticMesh&&) = default;
 		~StaticMesh() = default;
@@ -73,12 +120,18 @@ namespace Aegis::Graphics
 		[[nodiscard]] auto vertexCount() const -> uint32_t { return m_vertexCount; }
 		[[nodiscard]] auto indexCount() const -> uint32_t { return m_indexCount; }
 		[[nodiscard]] auto meshletCount() const -> uint32_t { return m_meshletCount; }
+		[[nodiscard]] auto baseMeshletCount() const -> uint32_t { return m_baseMeshletCount; }
+		[[nodiscard]] auto vertexFormat() const -> VertexFormat { return m_vertexFormat; }
+		[[nodiscard]] auto bounds() const -> const BoundingSphere& { return m_bounds; }
 		[[nodiscard]] auto meshDataBuffer() const -> const BindlessBuffer& { return m_meshDataBuffer; }
 
 		void draw(VkCommandBuffer cmd) const;
+		/// @brief Draws the full detail meshlets without a task shader (LOD cuts are only selected in the task shader)
 		void drawMeshlets(VkCommandBuffer cmd) const;
 
 	private:
+		void writeMeshData(const BoundingSphere& bounds, const glm::vec3& positionOffset, const glm::vec3& positionScale);
+
 		BindlessBuffer m_meshDataBuffer;
 		BindlessBuffer m_vertexBuffer;
 		BindlessBuffer m_indexBuffer;
@@ -89,7 +142,10 @@ namespace Aegis::Graphics
 		uint32_t m_vertexCount;
 		uint32_t m_indexCount;
 		uint32_t m_meshletCount;
+		uint32_t m_baseMeshletCount;
 		uint32_t m_meshletIndexCount;
 		uint32_t m_meshletPrimitiveCount;
+		VertexFormat m_vertexFormat;
+		BoundingSphere m_bounds{};
 	};
 }
\ No newline at end of file
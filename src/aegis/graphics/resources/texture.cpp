@@ -449,6 +449,7 @@ namespace Aegis::Graphics
 			.layerCount = m_image.layerCount(),
 			.usage = usage,
 			.imageType = VK_IMAGE_TYPE_2D,
+			.category = m_image.category(),
 		};
 		m_image = Image{ imageInfo };
 
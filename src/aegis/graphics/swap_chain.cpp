@@ -193,6 +193,10 @@ namespace Aegis::Graphics
 
 	auto SwapChain::chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) const -> VkPresentModeKHR
 	{
+		// FIFO is always supported and blocks in present until vblank
+		if (m_vsync)
+			return VK_PRESENT_MODE_FIFO_KHR;
+
 		for (const auto& availablePresentMode : availablePresentModes)
 		{
 			if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR)
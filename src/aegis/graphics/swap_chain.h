@@ -27,6 +27,7 @@ namespace Aegis::Graphics
 		[[nodiscard]] auto currentImage() const -> VkImage { return m_images[m_imageIndex]; }
 		[[nodiscard]] auto findDepthFormat() -> VkFormat;
 		[[nodiscard]] auto presentReadySemaphore() const -> VkSemaphore { return m_imageSync[m_imageIndex].presentReady; }
+		[[nodiscard]] auto isVSync() const -> bool { return m_vsync; }
 
 		auto acquireNextImage(VkSemaphore imageAvailable) -> VkResult;
 		void waitForImageInFlight(VkFence frameFence);
@@ -36,6 +37,9 @@ namespace Aegis::Graphics
 
 		void resize(VkExtent2D extent);
 
+		/// @brief Presents with FIFO if enabled (otherwise MAILBOX if available), takes effect on the next resize
+		void setVSync(bool vsync) { m_vsync = vsync; }
+
 	private:
 		void createSwapChain();
 		void createImageViews();
@@ -55,5 +59,6 @@ namespace Aegis::Graphics
 		std::vector<VkImageView> m_imageViews;
 		std::vector<ImageSync> m_imageSync;
 		uint32_t m_imageIndex{ 0 };
+		bool m_vsync{ false };
 	};
 }
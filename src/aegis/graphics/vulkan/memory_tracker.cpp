@@ -0,0 +1,177 @@
+#include "pch.h"
+#include "memory_tracker.h"
+
+#include "utils/file.h"
+
+#include <format>
+
+namespace Aegis::Graphics
+{
+	auto MemoryTracker::HeapStats::fragmentation() const -> float
+	{
+		VkDeviceSize freeBytes = blockBytes - allocationBytes;
+		if (freeBytes == 0)
+			return 0.0f;
+
+		return 1.0f - static_cast<float>(largestFreeRange) / static_cast<float>(freeBytes);
+	}
+
+	auto MemoryTracker::categoryName(MemoryCategory category) -> const char*
+	{
+		switch (category)
+		{
+		case MemoryCategory::Other:
+			return "Other";
+		case MemoryCategory::FrameGraph:
+			return "Frame Graph";
+		case MemoryCategory::Mesh:
+			return "Mesh";
+		case MemoryCategory::Texture:
+			return "Texture";
+		case MemoryCategory::Material:
+			return "Material";
+		case MemoryCategory::Staging:
+			return "Staging";
+		default:
+			return "Unknown";
+		}
+	}
+
+	auto MemoryTracker::categoryStats(MemoryCategory category) const -> CategoryStats
+	{
+		const auto& counter = m_counters[static_cast<uint32_t>(category)];
+		return CategoryStats{
+			.bytes = counter.bytes.load(std::memory_order_relaxed),
+			.allocationCount = counter.allocationCount.load(std::memory_order_relaxed),
+		};
+	}
+
+	auto MemoryTracker::heapStats() const -> std::vector<HeapStats>
+	{
+		VmaTotalStatistics statistics;
+		vmaCalculateStatistics(m_allocator, &statistics);
+
+		std::vector<HeapStats> heaps(m_memoryProperties.memoryHeapCount);
+		for (uint32_t i = 0; i < m_memoryProperties.memoryHeapCount; i++)
+		{
+			const auto& heapStatistics = statistics.memoryHeap[i];
+			heaps[i] = HeapStats{
+				.size = m_memoryProperties.memoryHeaps[i].size,
+				.budget = m_budgets[i].budget,
+				.usage = m_budgets[i].usage,
+				.blockBytes = heapStatistics.statistics.blockBytes,
+				.allocationBytes = heapStatistics.statistics.allocationBytes,
+				.largestFreeRange = heapStatistics.unusedRangeCount > 0 ? heapStatistics.unusedRangeSizeMax : 0,
+				.blockCount = heapStatistics.statistics.blockCount,
+				.allocationCount = heapStatistics.statistics.allocationCount,
+				.freeRangeCount = heapStatistics.unusedRangeCount,
+				.deviceLocal = (m_memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0,
+			};
+		}
+		return heaps;
+	}
+
+	void MemoryTracker::initialize(VmaAllocator allocator)
+	{
+		m_allocator = allocator;
+
+		const VkPhysicalDeviceMemoryProperties* memoryProperties;
+		vmaGetMemoryProperties(m_allocator, &memoryProperties);
+		m_memoryProperties = *memoryProperties;
+
+		m_budgets.resize(m_memoryProperties.memoryHeapCount);
+		m_overBudget.resize(m_memoryProperties.memoryHeapCount, false);
+		vmaGetHeapBudgets(m_allocator, m_budgets.data());
+	}
+
+	void MemoryTracker::track(VmaAllocation allocation, MemoryCategory category)
+	{
+		AGX_ASSERT_X(category < MemoryCategory::Count, "Invalid memory category");
+		vmaSetAllocationUserData(m_allocator, allocation, reinterpret_cast<void*>(static_cast<uintptr_t>(category)));
+
+		VmaAllocationInfo info;
+		vmaGetAllocationInfo(m_allocator, allocation, &info);
+
+		auto& counter = m_counters[static_cast<uint32_t>(category)];
+		counter.bytes.fetch_add(info.size, std::memory_order_relaxed);
+		counter.allocationCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void MemoryTracker::untrack(VmaAllocation allocation)
+	{
+		VmaAllocationInfo info;
+		vmaGetAllocationInfo(m_allocator, allocation, &info);
+
+		auto category = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(info.pUserData));
+		AGX_ASSERT_X(category < CATEGORY_COUNT, "Allocation was not created with a memory category");
+
+		auto& counter = m_counters[category];
+		counter.bytes.fetch_sub(info.size, std::memory_order_relaxed);
+		counter.allocationCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void MemoryTracker::update()
+	{
+		vmaSetCurrentFrameIndex(m_allocator, ++m_frameIndex);
+		vmaGetHeapBudgets(m_allocator, m_budgets.data());
+
+		// Report once when a heap crosses the threshold, so the state right before running out is on disk
+		for (uint32_t i = 0; i < m_budgets.size(); i++)
+		{
+			const auto& budget = m_budgets[i];
+			bool overBudget = static_cast<float>(budget.usage) > static_cast<float>(budget.budget) * BUDGET_WARNING_THRESHOLD;
+			if (overBudget && !m_overBudget[i])
+			{
+				ALOG::warn("Memory: Heap {} uses {} MB of its {} MB budget", i, budget.usage >> 20, budget.budget >> 20);
+				writeReport();
+			}
+			m_overBudget[i] = overBudget;
+		}
+	}
+
+	auto MemoryTracker::report() const -> std::string
+	{
+		std::string json;
+		auto out = std::back_inserter(json);
+
+		std::format_to(out, "{{\n\t\"frame\": {},\n\t\"categories\": [\n", m_frameIndex);
+		for (uint32_t i = 0; i < CATEGORY_COUNT; i++)
+		{
+			auto category = static_cast<MemoryCategory>(i);
+			auto stats = categoryStats(category);
+			std::format_to(out, "\t\t{{ \"name\": \"{}\", \"bytes\": {}, \"allocations\": {} }}{}\n",
+				categoryName(category), stats.bytes, stats.allocationCount, i + 1 < CATEGORY_COUNT ? "," : "");
+		}
+
+		std::format_to(out, "\t],\n\t\"heaps\": [\n");
+		auto heaps = heapStats();
+		for (uint32_t i = 0; i < heaps.size(); i++)
+		{
+			const auto& heap = heaps[i];
+			std::format_to(out, "\t\t{{ \"index\": {}, \"deviceLocal\": {}, \"size\": {}, \"budget\": {}, \"usage\": {}, "
+				"\"blockCount\": {}, \"blockBytes\": {}, \"allocationCount\": {}, \"allocationBytes\": {}, "
+				"\"freeRangeCount\": {}, \"largestFreeRange\": {}, \"fragmentation\": {:.4f} }}{}\n",
+				i, heap.deviceLocal, heap.size, heap.budget, heap.usage,
+				heap.blockCount, heap.blockBytes, heap.allocationCount, heap.allocationBytes,
+				heap.freeRangeCount, heap.largestFreeRange, heap.fragmentation(), i + 1 < heaps.size() ? "," : "");
+		}
+		std::format_to(out, "\t]\n}}\n");
+		return json;
+	}
+
+	auto MemoryTracker::writeReport(const std::filesystem::path& path) const -> bool
+	{
+		auto json = report();
+
+		std::error_code error;
+		std::filesystem::create_directories(path.parent_path(), error);
+		if (!File::writeBinary(path, std::vector<char>(json.begin(), json.end())))
+		{
+			ALOG::warn("Memory: Failed to write report '{}'", path.string());
+			return false;
+		}
+
+		ALOG::info("Memory: Wrote report '{}'", path.string());
+		return true;
+	}
+}
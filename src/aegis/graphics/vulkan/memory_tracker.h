@@ -0,0 +1,99 @@
+#pragma once
+
+#include "core/globals.h"
+#include "graphics/vulkan/volk_include.h"
+
+#include <vk_mem_alloc.h>
+
+#include <atomic>
+
+namespace Aegis::Graphics
+{
+	/// @brief Subsystem a GPU allocation is accounted to
+	enum class MemoryCategory : uint8_t
+	{
+		Other = 0,
+		FrameGraph = 1,
+		Mesh = 2,
+		Texture = 3,
+		Material = 4,
+		Staging = 5,
+		Count
+	};
+
+	/// @brief Accounts VMA allocations per category and tracks the heap budgets reported by the driver
+	/// @note The category is stored in the allocation's user data, tracking is thread safe
+	class MemoryTracker
+	{
+	public:
+		static constexpr uint32_t CATEGORY_COUNT = static_cast<uint32_t>(MemoryCategory::Count);
+		static constexpr float BUDGET_WARNING_THRESHOLD = 0.9f;
+		static constexpr auto REPORT_FILE = CACHE_DIR "memory_report.json";
+
+		struct CategoryStats
+		{
+			VkDeviceSize bytes{ 0 };
+			uint32_t allocationCount{ 0 };
+		};
+
+		struct HeapStats
+		{
+			VkDeviceSize size{ 0 };
+			VkDeviceSize budget{ 0 };
+			VkDeviceSize usage{ 0 };
+			VkDeviceSize blockBytes{ 0 };
+			VkDeviceSize allocationBytes{ 0 };
+			VkDeviceSize largestFreeRange{ 0 };
+			uint32_t blockCount{ 0 };
+			uint32_t allocationCount{ 0 };
+			uint32_t freeRangeCount{ 0 };
+			bool deviceLocal{ false };
+
+			/// @brief Share of the free block memory outside the largest free range (0 = not fragmented)
+			[[nodiscard]] auto fragmentation() const -> float;
+		};
+
+		MemoryTracker() = default;
+		MemoryTracker(const MemoryTracker&) = delete;
+		MemoryTracker(MemoryTracker&&) = delete;
+		~MemoryTracker() = default;
+
+		auto operator=(const MemoryTracker&) -> MemoryTracker& = delete;
+		auto operator=(MemoryTracker&&) -> MemoryTracker& = delete;
+
+		[[nodiscard]] static auto categoryName(MemoryCategory category) -> const char*;
+
+		[[nodiscard]] auto categoryStats(MemoryCategory category) const -> CategoryStats;
+		[[nodiscard]] auto heapBudgets() const -> const std::vector<VmaBudget>& { return m_budgets; }
+
+		/// @brief Gathers block statistics of all heaps
+		/// @note Walks all VMA blocks, only call this for reports and debug UI
+		[[nodiscard]] auto heapStats() const -> std::vector<HeapStats>;
+
+		void initialize(VmaAllocator allocator);
+
+		void track(VmaAllocation allocation, MemoryCategory category);
+		void untrack(VmaAllocation allocation);
+
+		/// @brief Queries the heap budgets and writes a report once a heap gets close to its budget
+		void update();
+
+		/// @brief Returns a JSON report with the usage per category and per heap (including fragmentation)
+		[[nodiscard]] auto report() const -> std::string;
+		auto writeReport(const std::filesystem::path& path = REPORT_FILE) const -> bool;
+
+	private:
+		struct CategoryCounter
+		{
+			std::atomic<VkDeviceSize> bytes{ 0 };
+			std::atomic<uint32_t> allocationCount{ 0 };
+		};
+
+		VmaAllocator m_allocator{ VK_NULL_HANDLE };
+		VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+		std::array<CategoryCounter, CATEGORY_COUNT> m_counters;
+		std::vector<VmaBudget> m_budgets;
+		std::vector<bool> m_overBudget;
+		uint32_t m_frameIndex{ 0 };
+	};
+}
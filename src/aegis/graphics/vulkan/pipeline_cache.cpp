@@ -0,0 +1,206 @@
+#include "pch.h"
+#include "pipeline_cache.h"
+
+#include "graphics/device.h"
+#include "graphics/vulkan/vulkan_tools.h"
+#include "utils/file.h"
+#include "utils/timer.h"
+
+#include <cstring>
+
+namespace Aegis::Graphics
+{
+	PipelineCache::~PipelineCache()
+	{
+		destroy();
+	}
+
+	auto PipelineCache::stats() const -> Stats
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_stats;
+	}
+
+	void PipelineCache::create(const VulkanDevice& device, const std::filesystem::path& path)
+	{
+		AGX_ASSERT_X(m_cache == VK_NULL_HANDLE, "Pipeline cache already created");
+
+		m_device = device.device();
+		m_properties = device.properties();
+		m_path = path;
+
+		auto data = loadCacheData();
+		VkPipelineCacheCreateInfo cacheInfo{
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+			.initialDataSize = data.size(),
+			.pInitialData = data.empty() ? nullptr : data.data(),
+		};
+		VK_CHECK(vkCreatePipelineCache(m_device, &cacheInfo, nullptr, &m_cache));
+
+		ALOG::info("Pipeline cache: Loaded {} bytes from '{}'", data.size(), m_path.string());
+	}
+
+	void PipelineCache::save()
+	{
+		if (m_cache == VK_NULL_HANDLE)
+			return;
+
+		size_t dataSize = 0;
+		VK_CHECK(vkGetPipelineCacheData(m_device, m_cache, &dataSize, nullptr));
+
+		auto header = deviceHeader();
+		std::vector<char> file(sizeof(Header) + dataSize);
+		VK_CHECK(vkGetPipelineCacheData(m_device, m_cache, &dataSize, file.data() + sizeof(Header)));
+		header.dataSize = dataSize;
+		file.resize(sizeof(Header) + dataSize);
+		std::memcpy(file.data(), &header, sizeof(Header));
+
+		std::error_code error;
+		std::filesystem::create_directories(m_path.parent_path(), error);
+		if (!File::writeBinary(m_path, file))
+		{
+			ALOG::warn("Pipeline cache: Failed to write '{}'", m_path.string());
+		}
+	}
+
+	void PipelineCache::destroy()
+	{
+		if (m_device == VK_NULL_HANDLE)
+			return;
+
+		save();
+
+		for (const auto& [path, shader] : m_shaderModules)
+		{
+			vkDestroyShaderModule(m_device, shader.module, nullptr);
+		}
+		for (auto module : m_retiredModules)
+		{
+			vkDestroyShaderModule(m_device, module, nullptr);
+		}
+		m_shaderModules.clear();
+		m_retiredModules.clear();
+
+		vkDestroyPipelineCache(m_device, m_cache, nullptr);
+		m_cache = VK_NULL_HANDLE;
+		m_device = VK_NULL_HANDLE;
+	}
+
+	auto PipelineCache::shaderModule(const std::filesystem::path& path) -> VkShaderModule
+	{
+		std::lock_guard lock{ m_mutex };
+		Timer timer;
+
+		std::error_code error;
+		auto writeTime = std::filesystem::last_write_time(path, error);
+
+		auto it = m_shaderModules.find(path.generic_string());
+		if (it != m_shaderModules.end() && !error && it->second.writeTime == writeTime)
+		{
+			m_stats.shaderModuleHits++;
+			return it->second.module;
+		}
+
+		auto code = File::readBinary(path);
+		if (code.empty())
+			ALOG::fatal("Failed to read shader file: {}", path.string());
+		AGX_ASSERT_X(!code.empty(), "Shader code is empty");
+
+		// Touched but unchanged files keep their module
+		uint64_t codeHash = hash(code);
+		if (it != m_shaderModules.end() && it->second.hash == codeHash)
+		{
+			it->second.writeTime = writeTime;
+			m_stats.shaderModuleHits++;
+			return it->second.module;
+		}
+
+		// Pipelines built from the old module may still be in flight, so it is only destroyed with the cache
+		if (it != m_shaderModules.end())
+		{
+			m_retiredModules.emplace_back(it->second.module);
+		}
+
+		ShaderModule shader{
+			.module = Tools::createShaderModule(m_device, code),
+			.hash = codeHash,
+			.writeTime = writeTime,
+		};
+		m_shaderModules.insert_or_assign(path.generic_string(), shader);
+
+		m_stats.shaderModuleCount++;
+		m_stats.shaderModuleMillis += timer.elapsedMillis();
+		return shader.module;
+	}
+
+	void PipelineCache::addPipelineTime(double millis)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_stats.pipelineCount++;
+		m_stats.pipelineMillis += millis;
+	}
+
+	void PipelineCache::logStats() const
+	{
+		auto current = stats();
+		ALOG::info("Pipeline cache: {} pipelines created in {:.2f} ms", current.pipelineCount, current.pipelineMillis);
+		ALOG::info("Pipeline cache: {} shader modules loaded in {:.2f} ms ({} cache hits)",
+			current.shaderModuleCount, current.shaderModuleMillis, current.shaderModuleHits);
+	}
+
+	auto PipelineCache::hash(const std::vector<char>& data) -> uint64_t
+	{
+		// FNV-1a
+		uint64_t result = 14695981039346656037ull;
+		for (char c : data)
+		{
+			result ^= static_cast<uint8_t>(c);
+			result *= 1099511628211ull;
+		}
+		return result;
+	}
+
+	auto PipelineCache::deviceHeader() const -> Header
+	{
+		Header header{
+			.vendorID = m_properties.vendorID,
+			.deviceID = m_properties.deviceID,
+			.driverVersion = m_properties.driverVersion,
+		};
+		std::memcpy(header.pipelineCacheUUID, m_properties.pipelineCacheUUID, VK_UUID_SIZE);
+		return header;
+	}
+
+	auto PipelineCache::loadCacheData() const -> std::vector<char>
+	{
+		if (!std::filesystem::exists(m_path))
+			return {};
+
+		auto file = File::readBinary(m_path);
+		if (file.size() < sizeof(Header))
+		{
+			ALOG::warn("Pipeline cache: Ignoring '{}' (file too small)", m_path.string());
+			return {};
+		}
+
+		Header header;
+		std::memcpy(&header, file.data(), sizeof(Header));
+
+		auto expected = deviceHeader();
+		bool compatible = header.magic == expected.magic &&
+			header.version == expected.version &&
+			header.vendorID == expected.vendorID &&
+			header.deviceID == expected.deviceID &&
+			header.driverVersion == expected.driverVersion &&
+			std::memcmp(header.pipelineCacheUUID, expected.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+			header.dataSize == file.size() - sizeof(Header);
+
+		if (!compatible)
+		{
+			ALOG::info("Pipeline cache: Discarding '{}' (created by a different device or driver)", m_path.string());
+			return {};
+		}
+
+		return std::vector<char>(file.begin() + sizeof(Header), file.end());
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "graphics/vulkan/volk_include.h"
+
+#include <mutex>
+
+namespace Aegis::Graphics
+{
+	class VulkanDevice;
+
+	/// @brief Device wide VkPipelineCache persisted across runs and a cache of loaded shader modules
+	/// @note The cache file is only reused if vendor, device, driver and pipeline cache UUID match the current device
+	class PipelineCache
+	{
+	public:
+		static constexpr uint32_t MAGIC = 0x43504741; // 'AGPC'
+		static constexpr uint32_t VERSION = 1;
+
+		struct Header
+		{
+			uint32_t magic{ MAGIC };
+			uint32_t version{ VERSION };
+			uint32_t vendorID{ 0 };
+			uint32_t deviceID{ 0 };
+			uint32_t driverVersion{ 0 };
+			uint8_t pipelineCacheUUID[VK_UUID_SIZE]{};
+			uint64_t dataSize{ 0 };
+		};
+
+		struct Stats
+		{
+			uint32_t pipelineCount{ 0 };
+			double pipelineMillis{ 0.0 };
+			uint32_t shaderModuleCount{ 0 };
+			uint32_t shaderModuleHits{ 0 };
+			double shaderModuleMillis{ 0.0 };
+		};
+
+		PipelineCache() = default;
+		PipelineCache(const PipelineCache&) = delete;
+		PipelineCache(PipelineCache&&) = delete;
+		~PipelineCache();
+
+		auto operator=(const PipelineCache&) -> PipelineCache& = delete;
+		auto operator=(PipelineCache&&) -> PipelineCache& = delete;
+
+		operator VkPipelineCache() const { return m_cache; }
+
+		[[nodiscard]] auto cache() const -> VkPipelineCache { return m_cache; }
+		[[nodiscard]] auto stats() const -> Stats;
+
+		void create(const VulkanDevice& device, const std::filesystem::path& path);
+		void save();
+		void destroy();
+
+		/// @brief Returns the shader module of the file (only read from disk again when the file was modified)
+		/// @note Modules are owned by the cache and stay alive until it is destroyed
+		[[nodiscard]] auto shaderModule(const std::filesystem::path& path) -> VkShaderModule;
+
+		void addPipelineTime(double millis);
+		void logStats() const;
+
+	private:
+		struct ShaderModule
+		{
+			VkShaderModule module{ VK_NULL_HANDLE };
+			uint64_t hash{ 0 };
+			std::filesystem::file_time_type writeTime;
+		};
+
+		[[nodiscard]] static auto hash(const std::vector<char>& data) -> uint64_t;
+		[[nodiscard]] auto deviceHeader() const -> Header;
+		[[nodiscard]] auto loadCacheData() const -> std::vector<char>;
+
+		VkDevice m_device{ VK_NULL_HANDLE };
+		VkPhysicalDeviceProperties m_properties{};
+		VkPipelineCache m_cache{ VK_NULL_HANDLE };
+		std::filesystem::path m_path;
+
+		std::unordered_map<std::string, ShaderModule> m_shaderModules;
+		std::vector<VkShaderModule> m_retiredModules;
+		Stats m_stats;
+		mutable std::mutex m_mutex;
+	};
+}
@@ -1,12 +1,17 @@
 #include "pch.h"
 #include "vulkan_context.h"
 
+#include "core/globals.h"
+
 namespace Aegis::Graphics
 {
 	auto VulkanContext::initialize(Core::Window& window) -> VulkanContext&
 	{
 		auto& context = instance();
 		context.m_device.initialize(window);
+		context.m_deletionQueue.initialize(context.m_device.device(), context.m_device.allocator());
+		context.m_memoryTracker.initialize(context.m_device.allocator());
+		context.m_pipelineCache.create(context.m_device, CACHE_DIR "pipeline_cache.bin");
 
 		// TODO: Let the pool grow dynamically (see: https://vkguide.dev/docs/extra-chapter/abstracting_descriptors/)
 		context.m_descriptorPool = DescriptorPool::Builder{}
@@ -46,10 +51,8 @@ namespace Aegis::Graphics
 		if (buffer)
 		{
 			AGX_ASSERT_X(allocation, "Buffer and allocation must be valid");
-			VulkanContext::instance().m_deletionQueue.schedule([=]() 
-				{ 
-					vmaDestroyBuffer(VulkanContext::instance().m_device.allocator(), buffer, allocation);
-				});
+			VulkanContext::instance().m_memoryTracker.untrack(allocation);
+			VulkanContext::instance().m_deletionQueue.schedule(buffer, allocation);
 		}
 	}
 
@@ -58,10 +61,8 @@ namespace Aegis::Graphics
 		if (image)
 		{
 			AGX_ASSERT_X(allocation, "Image and allocation must be valid");
-			VulkanContext::instance().m_deletionQueue.schedule([=]()
-				{
-					vmaDestroyImage(VulkanContext::instance().m_device.allocator(), image, allocation);
-				});
+			VulkanContext::instance().m_memoryTracker.untrack(allocation);
+			VulkanContext::instance().m_deletionQueue.schedule(image, allocation);
 		}
 	}
 
@@ -69,10 +70,7 @@ namespace Aegis::Graphics
 	{
 		if (view)
 		{
-			VulkanContext::instance().m_deletionQueue.schedule([=]()
-				{
-					vkDestroyImageView(VulkanContext::instance().m_device.device(), view, nullptr);
-				});
+			VulkanContext::instance().m_deletionQueue.schedule(view);
 		}
 	}
 
@@ -80,10 +78,7 @@ namespace Aegis::Graphics
 	{
 		if (sampler)
 		{
-			VulkanContext::instance().m_deletionQueue.schedule([=]()
-				{
-					vkDestroySampler(VulkanContext::instance().m_device.device(), sampler, nullptr);
-				});
+			VulkanContext::instance().m_deletionQueue.schedule(sampler);
 		}
 	}
 
@@ -91,10 +86,7 @@ namespace Aegis::Graphics
 	{
 		if (pipeline)
 		{
-			VulkanContext::instance().m_deletionQueue.schedule([=]()
-				{
-					vkDestroyPipeline(VulkanContext::instance().m_device.device(), pipeline, nullptr);
-				});
+			VulkanContext::instance().m_deletionQueue.schedule(pipeline);
 		}
 	}
 
@@ -102,10 +94,7 @@ namespace Aegis::Graphics
 	{
 		if (pipelineLayout)
 		{
-			VulkanContext::instance().m_deletionQueue.schedule([=]()
-				{
-					vkDestroyPipelineLayout(VulkanContext::instance().m_device.device(), pipelineLayout, nullptr);
-				});
+			VulkanContext::instance().m_deletionQueue.schedule(pipelineLayout);
 		}
 	}
 
@@ -3,6 +3,8 @@
 #include "graphics/device.h"
 #include "graphics/descriptors.h"
 #include "graphics/deletion_queue.h"
+#include "graphics/vulkan/memory_tracker.h"
+#include "graphics/vulkan/pipeline_cache.h"
 
 namespace Aegis::Graphics
 {
@@ -20,6 +22,8 @@ namespace Aegis::Graphics
 		[[nodiscard]] static auto device() -> VulkanDevice& { return instance().m_device; }
 		[[nodiscard]] static auto descriptorPool() -> DescriptorPool& { return instance().m_descriptorPool; }
 		[[nodiscard]] static auto deletionQueue() -> DeletionQueue& { return instance().m_deletionQueue; }
+		[[nodiscard]] static auto pipelineCache() -> PipelineCache& { return instance().m_pipelineCache; }
+		[[nodiscard]] static auto memoryTracker() -> MemoryTracker& { return instance().m_memoryTracker; }
 
 		static auto initialize(Core::Window& window) -> VulkanContext&;
 		static void destroy();
@@ -42,6 +46,8 @@ namespace Aegis::Graphics
 		// Deletion Queue
 
 		VulkanDevice m_device{};
+		PipelineCache m_pipelineCache{};
+		MemoryTracker m_memoryTracker{};
 		DescriptorPool m_descriptorPool{};
 		DeletionQueue m_deletionQueue{};
 	};
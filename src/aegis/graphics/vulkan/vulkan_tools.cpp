@@ -300,6 +300,24 @@ namespace Aegis::Tools
 		vkCmdDispatch(cmd, groupCountX, groupCountY, groupCountZ);
 	}
 
+	void vk::cmdMemoryBarrier(VkCommandBuffer cmd, VkPipelineStageFlags srcStage, VkAccessFlags srcAccess,
+		VkPipelineStageFlags dstStage, VkAccessFlags dstAccess)
+	{
+		VkMemoryBarrier barrier{
+			.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+			.srcAccessMask = srcAccess,
+			.dstAccessMask = dstAccess,
+		};
+
+		vkCmdPipelineBarrier(cmd,
+			srcStage, dstStage,
+			0,
+			1, &barrier,
+			0, nullptr,
+			0, nullptr
+		);
+	}
+
 	void vk::cmdPipelineBarrier(VkCommandBuffer cmd, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout,
 		VkImageAspectFlags aspectMask)
 	{
@@ -44,6 +44,9 @@ namespace Aegis::Tools
 		void cmdDispatch(VkCommandBuffer cmd, VkExtent2D minThreads, VkExtent2D groupSize);
 		void cmdDispatch(VkCommandBuffer cmd, VkExtent3D minThreads, VkExtent3D groupSize);
 
+		void cmdMemoryBarrier(VkCommandBuffer cmd, VkPipelineStageFlags srcStage, VkAccessFlags srcAccess,
+			VkPipelineStageFlags dstStage, VkAccessFlags dstAccess);
+
 		void cmdPipelineBarrier(VkCommandBuffer cmd, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout,
 			VkImageAspectFlags aspectMask);
 
@@ -3,6 +3,20 @@
 
 namespace Aegis::Math
 {
+	namespace
+	{
+		/// @brief Pade approximation of tanh (max error ~1e-4), it reaches 1 at |x| = 4.97 and is clamped from there
+		/// @note Only multiplications and a division, so loops using it vectorize (std::exp and std::tanh don't on MSVC)
+		auto rationalTanh(float x) -> float
+		{
+			x = std::clamp(x, -4.97f, 4.97f);
+			const float x2 = x * x;
+			const float numerator = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+			const float denominator = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+			return numerator / denominator;
+		}
+	}
+
 	auto sigmoid01(float x) -> float
 	{
 		return 1.0f / (1.0f + std::exp(-12.0f * x + 6.0f));
@@ -18,4 +32,32 @@ namespace Aegis::Math
 	{
 		return std::tanh(6.0f * x - 3.0f) / 2.0f + 0.5f;
 	}
+
+	void sigmoid01(std::span<const float> x, std::span<float> result)
+	{
+		AGX_ASSERT_X(x.size() == result.size(), "Input and result must have the same size");
+		for (size_t i = 0; i < x.size(); i++)
+		{
+			// sigmoid(2x) = tanh(x) / 2 + 1/2
+			result[i] = rationalTanh(6.0f * x[i] - 3.0f) / 2.0f + 0.5f;
+		}
+	}
+
+	void fastSigmoid01(std::span<const float> x, std::span<float> result)
+	{
+		AGX_ASSERT_X(x.size() == result.size(), "Input and result must have the same size");
+		for (size_t i = 0; i < x.size(); i++)
+		{
+			result[i] = fastSigmoid01(x[i]);
+		}
+	}
+
+	void tanh01(std::span<const float> x, std::span<float> result)
+	{
+		AGX_ASSERT_X(x.size() == result.size(), "Input and result must have the same size");
+		for (size_t i = 0; i < x.size(); i++)
+		{
+			result[i] = rationalTanh(6.0f * x[i] - 3.0f) / 2.0f + 0.5f;
+		}
+	}
 }
@@ -2,6 +2,8 @@
 
 #include "math/math.h"
 
+#include <span>
+
 namespace Aegis::Math
 {
 	template <typename T>
@@ -18,4 +20,11 @@ namespace Aegis::Math
 	
 	/// @brief Returns the tangens hyperbolicus of x in the range [0, 1]
 	auto tanh01(float x) -> float;
+
+	/// @brief Batched versions of the functions above, written as plain loops the compiler can vectorize
+	/// @note sigmoid01 and tanh01 use a rational approximation (max error ~1e-4) instead of std::exp and std::tanh
+	/// @note Result may be the same span as x (in place)
+	void sigmoid01(std::span<const float> x, std::span<float> result);
+	void fastSigmoid01(std::span<const float> x, std::span<float> result);
+	void tanh01(std::span<const float> x, std::span<float> result);
 }
\ No newline at end of file
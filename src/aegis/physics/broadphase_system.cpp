@@ -0,0 +1,56 @@
+#include "pch.h"
+#include "broadphase_system.h"
+
+#include "core/profiler.h"
+#include "scene/components.h"
+#include "scene/scene.h"
+
+namespace Aegis::Physics
+{
+	void BroadphaseSystem::onFixedUpdate(float fixedDeltaSeconds, Scene::Scene& scene)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		gather(scene.registry());
+		m_sweepAndPrune.update(m_bounds);
+
+		const auto& pairs = m_sweepAndPrune.pairs();
+		m_pairs.resize(pairs.size());
+		for (size_t i = 0; i < pairs.size(); i++)
+		{
+			m_pairs[i] = CollisionPair{ m_entities[pairs[i].a], m_entities[pairs[i].b] };
+		}
+	}
+
+	void BroadphaseSystem::gather(entt::registry& registry)
+	{
+		m_entities.clear();
+		m_bounds.clear();
+
+		auto view = registry.view<Transform, Parent, Mesh, ColliderTag>();
+		for (auto&& [entity, transform, parent, mesh] : view.each())
+		{
+			if (!mesh.staticMesh)
+				continue;
+
+			glm::vec3 location = transform.location;
+			glm::quat rotation = transform.rotation;
+			glm::vec3 scale = transform.scale;
+			if (parent.entity && parent.entity.has<GlobalTransform>())
+			{
+				const auto& parentGlobal = parent.entity.get<GlobalTransform>();
+				location = parentGlobal.location + location;
+				rotation = parentGlobal.rotation * rotation;
+				scale = parentGlobal.scale * scale;
+			}
+
+			const auto& sphere = mesh.staticMesh->bounds();
+			const glm::vec3 absScale = glm::abs(scale);
+			const glm::vec3 center = location + rotation * (scale * sphere.center);
+			const float radius = sphere.radius * std::max({ absScale.x, absScale.y, absScale.z });
+
+			m_entities.emplace_back(entity);
+			m_bounds.emplace_back(AABB{ center - radius, center + radius });
+		}
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "physics/sweep_and_prune.h"
+#include "scene/system.h"
+
+#include <entt/entt.hpp>
+
+namespace Aegis::Physics
+{
+	/// @brief Finds the overlapping pairs of all entities with a ColliderTag each simulation tick
+	/// @note The bounds are the bounding spheres of the meshes, placed with the local transform of the current tick and
+	///       the GlobalTransform of the parent. Runs after the MotionDynamicsSystem, so scripts see the pairs of the tick.
+	class BroadphaseSystem : public Scene::System
+	{
+	public:
+		struct CollisionPair
+		{
+			entt::entity a;
+			entt::entity b;
+		};
+
+		BroadphaseSystem() = default;
+		~BroadphaseSystem() = default;
+
+		[[nodiscard]] auto pairs() const -> const std::vector<CollisionPair>& { return m_pairs; }
+		[[nodiscard]] auto sweepAndPrune() -> SweepAndPrune& { return m_sweepAndPrune; }
+
+		void onFixedUpdate(float fixedDeltaSeconds, Scene::Scene& scene) override;
+
+	private:
+		void gather(entt::registry& registry);
+
+		SweepAndPrune m_sweepAndPrune;
+		std::vector<entt::entity> m_entities;
+		std::vector<AABB> m_bounds;
+		std::vector<CollisionPair> m_pairs;
+	};
+}
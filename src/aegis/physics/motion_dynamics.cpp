@@ -83,35 +83,12 @@ namespace Aegis::Physics
 		return glm::normalize(m_angularVelocity);
 	}
 
-	void MotionDynamics::update(float deltaSeconds)
+	void MotionDynamics::begin()
 	{
-		addFriction(deltaSeconds);
-
-		applyForces(deltaSeconds);
-		// Update transform
-		auto& transform = get<Transform>();
-		transform.location += m_linearVelocity * deltaSeconds;
-		transform.rotation *= glm::quat(m_angularVelocity * deltaSeconds);
-	}
-
-	void MotionDynamics::applyForces(float deltaSeconds)
-	{
-		// Calculate new velocities
-		m_linearVelocity += m_accumulatedLinearForce / m_properties.mass * deltaSeconds;
-		m_angularVelocity += m_accumulatedAngularForce / m_properties.mass * deltaSeconds;
-		
-		// Limit velocities
-		m_linearVelocity *= std::min(1.0f, m_properties.maxLinearSpeed / linearSpeed());
-		m_angularVelocity *= std::min(1.0f, m_properties.maxAngularSpeed / angularSpeed());
-
-		// Reset accumulated forces
-		m_accumulatedLinearForce = glm::vec3{ 0.0f };
-		m_accumulatedAngularForce = glm::vec3{ 0.0f };
-	}
-
-	void MotionDynamics::addFriction(float deltaSeconds)
-	{
-		addLinearForce(-m_linearVelocity * m_properties.linearFriction);
-		addAngularForce(-m_angularVelocity * m_properties.angularFriction);
+		if (!has<InterpolatedTransform>())
+		{
+			const auto& transform = get<Transform>();
+			add<InterpolatedTransform>(transform, transform);
+		}
 	}
 }
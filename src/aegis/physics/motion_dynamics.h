@@ -27,7 +27,10 @@ namespace Aegis::Physics
 	};
 
 
-	/// @brief Adds motion dynamics to an object to update its position and rotation each frame.
+	class MotionDynamicsSystem;
+
+	/// @brief Adds motion dynamics to an object to update its position and rotation each simulation tick.
+	/// @note The bodies of a scene are integrated together by the MotionDynamicsSystem.
 	class MotionDynamics : public Aegis::Scripting::ScriptBase
 	{
 	public:
@@ -77,18 +80,10 @@ namespace Aegis::Physics
 
 		Properties& properties() { return m_properties; }
 
-		/// @brief Updates the position and rotation of the object based on the current velocity.
-		/// @note This function is called automatically each frame.
-		void update(float deltaSeconds) override;
+		/// @brief Adds the interpolated transform used to render the object between ticks.
+		void begin() override;
 
 	private:
-		/// @brief Computes the velocities from the accelerations.
-		/// @note Resets the accelerations to zero for the next frame.
-		void applyForces(float deltaSeconds);
-
-		void addFriction(float deltaSeconds);
-
-
 		Properties m_properties;
 
 		glm::vec3 m_linearVelocity{ 0.0f };
@@ -96,5 +91,7 @@ namespace Aegis::Physics
 
 		glm::vec3 m_accumulatedLinearForce{ 0.0f };
 		glm::vec3 m_accumulatedAngularForce{ 0.0f };
+
+		friend class MotionDynamicsSystem;
 	};
 }
@@ -0,0 +1,161 @@
+#include "pch.h"
+#include "motion_dynamics_system.h"
+
+#include "core/profiler.h"
+#include "core/thread_pool.h"
+#include "physics/motion_dynamics.h"
+#include "scene/components.h"
+#include "scene/scene.h"
+
+#include <cmath>
+#include <future>
+
+namespace Aegis::Physics
+{
+	void MotionDynamicsSystem::Bodies::resize(size_t count)
+	{
+		for (auto* array : { &x, &y, &z, &linearX, &linearY, &linearZ, &angularX, &angularY, &angularZ,
+			&forceX, &forceY, &forceZ, &torqueX, &torqueY, &torqueZ,
+			&mass, &linearFriction, &angularFriction, &maxLinearSpeed, &maxAngularSpeed })
+		{
+			array->resize(count);
+		}
+	}
+
+	void MotionDynamicsSystem::onFixedUpdate(float fixedDeltaSeconds, Scene::Scene& scene)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		gather(scene.registry());
+
+		const uint32_t count = bodyCount();
+		if (count == 0)
+			return;
+
+		if (m_parallel && count > CHUNK_SIZE)
+		{
+			std::vector<std::future<void>> tasks;
+			tasks.reserve((count + CHUNK_SIZE - 1) / CHUNK_SIZE);
+			for (uint32_t first = 0; first < count; first += CHUNK_SIZE)
+			{
+				uint32_t last = std::min(first + CHUNK_SIZE, count);
+				tasks.emplace_back(Core::ThreadPool::instance().submit([this, first, last, fixedDeltaSeconds]() {
+					integrate(first, last, fixedDeltaSeconds);
+					}));
+			}
+			for (auto& task : tasks)
+			{
+				task.get();
+			}
+		}
+		else
+		{
+			integrate(0, count, fixedDeltaSeconds);
+		}
+
+		scatter(scene.registry(), fixedDeltaSeconds);
+	}
+
+	void MotionDynamicsSystem::gather(entt::registry& registry)
+	{
+		auto view = registry.view<Transform, MotionDynamics>();
+		m_bodies.resize(view.size_hint());
+
+		auto& b = m_bodies;
+		uint32_t i = 0;
+		for (auto&& [entity, transform, dynamics] : view.each())
+		{
+			b.x[i] = transform.location.x;
+			b.y[i] = transform.location.y;
+			b.z[i] = transform.location.z;
+			b.linearX[i] = dynamics.m_linearVelocity.x;
+			b.linearY[i] = dynamics.m_linearVelocity.y;
+			b.linearZ[i] = dynamics.m_linearVelocity.z;
+			b.angularX[i] = dynamics.m_angularVelocity.x;
+			b.angularY[i] = dynamics.m_angularVelocity.y;
+			b.angularZ[i] = dynamics.m_angularVelocity.z;
+			b.forceX[i] = dynamics.m_accumulatedLinearForce.x;
+			b.forceY[i] = dynamics.m_accumulatedLinearForce.y;
+			b.forceZ[i] = dynamics.m_accumulatedLinearForce.z;
+			b.torqueX[i] = dynamics.m_accumulatedAngularForce.x;
+			b.torqueY[i] = dynamics.m_accumulatedAngularForce.y;
+			b.torqueZ[i] = dynamics.m_accumulatedAngularForce.z;
+
+			const auto& properties = dynamics.m_properties;
+			b.mass[i] = properties.mass;
+			b.linearFriction[i] = properties.linearFriction;
+			b.angularFriction[i] = properties.angularFriction;
+			b.maxLinearSpeed[i] = properties.maxLinearSpeed;
+			b.maxAngularSpeed[i] = properties.maxAngularSpeed;
+			i++;
+		}
+
+		// The size hint of a multi component view is an upper bound
+		m_bodies.resize(i);
+	}
+
+	void MotionDynamicsSystem::integrate(uint32_t first, uint32_t last, float fixedDeltaSeconds)
+	{
+		auto& b = m_bodies;
+		for (uint32_t i = first; i < last; i++)
+		{
+			// Friction is a force against the current velocity
+			const float inverseMass = fixedDeltaSeconds / b.mass[i];
+			float vx = b.linearX[i] + (b.forceX[i] - b.linearX[i] * b.linearFriction[i]) * inverseMass;
+			float vy = b.linearY[i] + (b.forceY[i] - b.linearY[i] * b.linearFriction[i]) * inverseMass;
+			float vz = b.linearZ[i] + (b.forceZ[i] - b.linearZ[i] * b.linearFriction[i]) * inverseMass;
+
+			const float speed = std::sqrt(vx * vx + vy * vy + vz * vz);
+			const float limit = speed > b.maxLinearSpeed[i] ? b.maxLinearSpeed[i] / speed : 1.0f;
+			vx *= limit;
+			vy *= limit;
+			vz *= limit;
+
+			b.linearX[i] = vx;
+			b.linearY[i] = vy;
+			b.linearZ[i] = vz;
+			b.x[i] += vx * fixedDeltaSeconds;
+			b.y[i] += vy * fixedDeltaSeconds;
+			b.z[i] += vz * fixedDeltaSeconds;
+		}
+
+		for (uint32_t i = first; i < last; i++)
+		{
+			const float inverseMass = fixedDeltaSeconds / b.mass[i];
+			float wx = b.angularX[i] + (b.torqueX[i] - b.angularX[i] * b.angularFriction[i]) * inverseMass;
+			float wy = b.angularY[i] + (b.torqueY[i] - b.angularY[i] * b.angularFriction[i]) * inverseMass;
+			float wz = b.angularZ[i] + (b.torqueZ[i] - b.angularZ[i] * b.angularFriction[i]) * inverseMass;
+
+			const float speed = std::sqrt(wx * wx + wy * wy + wz * wz);
+			const float limit = speed > b.maxAngularSpeed[i] ? b.maxAngularSpeed[i] / speed : 1.0f;
+			b.angularX[i] = wx * limit;
+			b.angularY[i] = wy * limit;
+			b.angularZ[i] = wz * limit;
+		}
+	}
+
+	void MotionDynamicsSystem::scatter(entt::registry& registry, float fixedDeltaSeconds)
+	{
+		// Same view as in gather, so the bodies are visited in the same order
+		auto view = registry.view<Transform, MotionDynamics>();
+
+		const auto& b = m_bodies;
+		uint32_t i = 0;
+		for (auto&& [entity, transform, dynamics] : view.each())
+		{
+			transform.location = glm::vec3{ b.x[i], b.y[i], b.z[i] };
+
+			dynamics.m_linearVelocity = glm::vec3{ b.linearX[i], b.linearY[i], b.linearZ[i] };
+			dynamics.m_angularVelocity = glm::vec3{ b.angularX[i], b.angularY[i], b.angularZ[i] };
+			dynamics.m_accumulatedLinearForce = glm::vec3{ 0.0f };
+			dynamics.m_accumulatedAngularForce = glm::vec3{ 0.0f };
+
+			// Most bodies don't rotate, skip the quaternion from euler angles for them
+			if (dynamics.m_angularVelocity != glm::vec3{ 0.0f })
+				transform.rotation *= glm::quat(dynamics.m_angularVelocity * fixedDeltaSeconds);
+
+			i++;
+		}
+		AGX_ASSERT_X(i == bodyCount(), "MotionDynamics bodies changed during the tick");
+	}
+}
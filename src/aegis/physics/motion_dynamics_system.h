@@ -0,0 +1,48 @@
+#pragma once
+
+#include "scene/system.h"
+
+#include <entt/entt.hpp>
+
+namespace Aegis::Physics
+{
+	/// @brief Integrates all MotionDynamics bodies each simulation tick in batches
+	/// @note The bodies are copied into SoA arrays, so friction, forces and the speed limits are branch free loops the
+	///       compiler can vectorize. Large counts are split into chunks for the thread pool.
+	/// @note Runs before the scripts of a tick, so forces added by scripts are applied in the next tick
+	class MotionDynamicsSystem : public Scene::System
+	{
+	public:
+		static constexpr uint32_t CHUNK_SIZE = 8192;
+
+		MotionDynamicsSystem() = default;
+		~MotionDynamicsSystem() = default;
+
+		[[nodiscard]] auto bodyCount() const -> uint32_t { return static_cast<uint32_t>(m_bodies.linearX.size()); }
+
+		/// @brief Splits the integration of large counts into chunks for the thread pool
+		void setParallel(bool parallel) { m_parallel = parallel; }
+
+		void onFixedUpdate(float fixedDeltaSeconds, Scene::Scene& scene) override;
+
+	private:
+		struct Bodies
+		{
+			std::vector<float> x, y, z;
+			std::vector<float> linearX, linearY, linearZ;
+			std::vector<float> angularX, angularY, angularZ;
+			std::vector<float> forceX, forceY, forceZ;
+			std::vector<float> torqueX, torqueY, torqueZ;
+			std::vector<float> mass, linearFriction, angularFriction, maxLinearSpeed, maxAngularSpeed;
+
+			void resize(size_t count);
+		};
+
+		void gather(entt::registry& registry);
+		void integrate(uint32_t first, uint32_t last, float fixedDeltaSeconds);
+		void scatter(entt::registry& registry, float fixedDeltaSeconds);
+
+		Bodies m_bodies;
+		bool m_parallel{ true };
+	};
+}
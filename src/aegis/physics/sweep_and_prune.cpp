@@ -0,0 +1,262 @@
+#include "pch.h"
+#include "sweep_and_prune.h"
+
+#include "core/profiler.h"
+#include "core/thread_pool.h"
+
+#include <future>
+#include <numeric>
+
+namespace Aegis::Physics
+{
+	void SweepAndPrune::update(std::span<const AABB> bounds)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		const uint32_t count = static_cast<uint32_t>(bounds.size());
+		bool fullSort = false;
+		if (count != m_order.size())
+		{
+			m_order.resize(count);
+			std::iota(m_order.begin(), m_order.end(), 0u);
+			fullSort = true;
+		}
+
+		const uint32_t previousAxis = m_axis;
+		chooseAxis(bounds);
+		fullSort |= m_axis != previousAxis;
+
+		sortKeys(bounds, fullSort);
+		buildCells(bounds);
+
+		m_pairs.clear();
+		if (m_parallel && count > CHUNK_SIZE)
+		{
+			// Chunks of whole cells with about the same number of entries
+			std::vector<std::pair<uint32_t, uint32_t>> chunks;
+			const uint32_t cellCount = m_cellCountA * m_cellCountB;
+			for (uint32_t first = 0; first < cellCount;)
+			{
+				uint32_t last = first + 1;
+				while (last < cellCount && m_cellStart[last] - m_cellStart[first] < CHUNK_SIZE)
+				{
+					last++;
+				}
+				chunks.emplace_back(first, last);
+				first = last;
+			}
+			m_chunkPairs.resize(chunks.size());
+
+			std::vector<std::future<void>> tasks;
+			tasks.reserve(chunks.size());
+			for (uint32_t chunk = 0; chunk < chunks.size(); chunk++)
+			{
+				auto [firstCell, lastCell] = chunks[chunk];
+				tasks.emplace_back(Core::ThreadPool::instance().submit([this, firstCell, lastCell, chunk]() {
+					m_chunkPairs[chunk].clear();
+					sweepCells(firstCell, lastCell, m_chunkPairs[chunk]);
+					}));
+			}
+			for (auto& task : tasks)
+			{
+				task.get();
+			}
+
+			// Concatenated in chunk order, so the result is the same as without threads
+			for (uint32_t chunk = 0; chunk < chunks.size(); chunk++)
+			{
+				m_pairs.insert(m_pairs.end(), m_chunkPairs[chunk].begin(), m_chunkPairs[chunk].end());
+			}
+		}
+		else
+		{
+			sweepCells(0, m_cellCountA * m_cellCountB, m_pairs);
+		}
+	}
+
+	void SweepAndPrune::chooseAxis(std::span<const AABB> bounds)
+	{
+		if (bounds.empty())
+			return;
+
+		glm::dvec3 sum{ 0.0 };
+		glm::dvec3 sumSquared{ 0.0 };
+		for (const auto& box : bounds)
+		{
+			const glm::dvec3 center = glm::dvec3{ box.min + box.max } * 0.5;
+			sum += center;
+			sumSquared += center * center;
+		}
+
+		const double count = static_cast<double>(bounds.size());
+		const glm::dvec3 variance = sumSquared / count - (sum / count) * (sum / count);
+
+		uint32_t best = 0;
+		for (uint32_t axis = 1; axis < 3; axis++)
+		{
+			if (variance[axis] > variance[best])
+				best = axis;
+		}
+
+		// Some margin, so bodies spread evenly on two axes don't trigger a full sort every tick
+		if (variance[best] > variance[m_axis] * 1.25)
+			m_axis = best;
+	}
+
+	void SweepAndPrune::sortKeys(std::span<const AABB> bounds, bool fullSort)
+	{
+		const uint32_t count = bodyCount();
+		m_keys.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_keys[i] = SortKey{ bounds[m_order[i]].min[m_axis], m_order[i] };
+		}
+
+		if (fullSort)
+		{
+			std::ranges::sort(m_keys, {}, &SortKey::min);
+		}
+		else
+		{
+			// Almost sorted from the last tick, so each key only moves a few places
+			for (uint32_t i = 1; i < count; i++)
+			{
+				const SortKey key = m_keys[i];
+				uint32_t j = i;
+				while (j > 0 && m_keys[j - 1].min > key.min)
+				{
+					m_keys[j] = m_keys[j - 1];
+					j--;
+				}
+				m_keys[j] = key;
+			}
+		}
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_order[i] = m_keys[i].body;
+		}
+	}
+
+	void SweepAndPrune::buildCells(std::span<const AABB> bounds)
+	{
+		const uint32_t count = bodyCount();
+		m_axisA = (m_axis + 1) % 3;
+		m_axisB = (m_axis + 2) % 3;
+
+		if (count == 0)
+		{
+			m_cellCountA = 1;
+			m_cellCountB = 1;
+			m_cellStart.assign(2, 0);
+			m_cellEntries.clear();
+			return;
+		}
+
+		glm::vec2 min{ std::numeric_limits<float>::max() };
+		glm::vec2 max{ std::numeric_limits<float>::lowest() };
+		double extent = 0.0;
+		for (const auto& box : bounds)
+		{
+			min = glm::min(min, glm::vec2{ box.min[m_axisA], box.min[m_axisB] });
+			max = glm::max(max, glm::vec2{ box.max[m_axisA], box.max[m_axisB] });
+			extent += (box.max[m_axisA] - box.min[m_axisA]) + (box.max[m_axisB] - box.min[m_axisB]);
+		}
+
+		// A few box sizes per cell, so most boxes touch one to four cells
+		const float averageExtent = static_cast<float>(extent / (2.0 * count));
+		const glm::vec2 range = max - min;
+		const float cellSize = std::max({ averageExtent * 4.0f, range.x / MAX_CELLS_PER_AXIS, range.y / MAX_CELLS_PER_AXIS,
+			std::numeric_limits<float>::epsilon() });
+
+		m_cellOrigin = min;
+		m_inverseCellSize = 1.0f / cellSize;
+		m_cellCountA = std::min(static_cast<uint32_t>(range.x * m_inverseCellSize) + 1, MAX_CELLS_PER_AXIS);
+		m_cellCountB = std::min(static_cast<uint32_t>(range.y * m_inverseCellSize) + 1, MAX_CELLS_PER_AXIS);
+
+		// Counting sort into the cells, filled in sweep order so every cell stays sorted
+		m_cellRanges.resize(count);
+		m_cellStart.assign(static_cast<size_t>(m_cellCountA) * m_cellCountB + 1, 0);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const auto& box = bounds[m_order[i]];
+			const CellRange cells{
+				cellA(box.min[m_axisA]), cellA(box.max[m_axisA]),
+				cellB(box.min[m_axisB]), cellB(box.max[m_axisB]) };
+			m_cellRanges[i] = cells;
+
+			for (uint32_t b = cells.firstB; b <= cells.lastB; b++)
+			{
+				for (uint32_t a = cells.firstA; a <= cells.lastA; a++)
+				{
+					m_cellStart[b * m_cellCountA + a + 1]++;
+				}
+			}
+		}
+		std::partial_sum(m_cellStart.begin(), m_cellStart.end(), m_cellStart.begin());
+
+		m_cellFill.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+		m_cellEntries.resize(m_cellStart.back());
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const uint32_t body = m_order[i];
+			const auto& box = bounds[body];
+			const CellEntry entry{
+				box.min[m_axis], box.max[m_axis],
+				box.min[m_axisA], box.max[m_axisA],
+				box.min[m_axisB], box.max[m_axisB],
+				body };
+
+			const auto& cells = m_cellRanges[i];
+			for (uint32_t b = cells.firstB; b <= cells.lastB; b++)
+			{
+				for (uint32_t a = cells.firstA; a <= cells.lastA; a++)
+				{
+					m_cellEntries[m_cellFill[b * m_cellCountA + a]++] = entry;
+				}
+			}
+		}
+	}
+
+	void SweepAndPrune::sweepCells(uint32_t firstCell, uint32_t lastCell, std::vector<Pair>& pairs) const
+	{
+		for (uint32_t cell = firstCell; cell < lastCell; cell++)
+		{
+			const uint32_t cellX = cell % m_cellCountA;
+			const uint32_t cellY = cell / m_cellCountA;
+			const CellEntry* entries = m_cellEntries.data();
+			const uint32_t last = m_cellStart[cell + 1];
+			for (uint32_t p = m_cellStart[cell]; p < last; p++)
+			{
+				const CellEntry& first = entries[p];
+				for (uint32_t q = p + 1; q < last; q++)
+				{
+					const CellEntry& second = entries[q];
+					if (second.sweepMin > first.sweepMax)
+						break;
+
+					if (second.minA > first.maxA || second.maxA < first.minA || second.minB > first.maxB || second.maxB < first.minB)
+						continue;
+
+					// Boxes sharing several cells are only reported by the cell holding the min corner of their overlap
+					if (cellA(std::max(first.minA, second.minA)) != cellX || cellB(std::max(first.minB, second.minB)) != cellY)
+						continue;
+
+					pairs.emplace_back(Pair{ std::min(first.body, second.body), std::max(first.body, second.body) });
+				}
+			}
+		}
+	}
+
+	auto SweepAndPrune::cellA(float value) const -> uint32_t
+	{
+		const float cell = std::max((value - m_cellOrigin.x) * m_inverseCellSize, 0.0f);
+		return std::min(static_cast<uint32_t>(cell), m_cellCountA - 1);
+	}
+
+	auto SweepAndPrune::cellB(float value) const -> uint32_t
+	{
+		const float cell = std::max((value - m_cellOrigin.y) * m_inverseCellSize, 0.0f);
+		return std::min(static_cast<uint32_t>(cell), m_cellCountB - 1);
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "math/math.h"
+
+#include <span>
+#include <vector>
+
+namespace Aegis::Physics
+{
+	struct AABB
+	{
+		glm::vec3 min{ 0.0f };
+		glm::vec3 max{ 0.0f };
+	};
+
+	/// @brief Broadphase that finds all overlapping pairs of axis aligned boxes
+	/// @note The boxes are kept sorted along the axis with the largest spread. Bodies move little between ticks, so the
+	///       order is updated with an insertion sort in almost linear time. A single sweep axis degrades to O(n^2) when
+	///       bodies are spread over all axes, so the two other axes are divided into a grid of cells. Each cell is swept
+	///       on its own (filled in sorted order, so it needs no sort) and large counts are split into chunks of cells
+	///       for the thread pool.
+	class SweepAndPrune
+	{
+	public:
+		static constexpr uint32_t CHUNK_SIZE = 4096;
+		static constexpr uint32_t MAX_CELLS_PER_AXIS = 256;
+
+		/// @brief Two overlapping bodies (indices into the bounds of the last update, a < b)
+		struct Pair
+		{
+			uint32_t a;
+			uint32_t b;
+		};
+
+		SweepAndPrune() = default;
+		~SweepAndPrune() = default;
+
+		[[nodiscard]] auto bodyCount() const -> uint32_t { return static_cast<uint32_t>(m_order.size()); }
+		[[nodiscard]] auto axis() const -> uint32_t { return m_axis; }
+		[[nodiscard]] auto pairs() const -> const std::vector<Pair>& { return m_pairs; }
+
+		/// @brief Splits the sweep of large counts into chunks for the thread pool
+		void setParallel(bool parallel) { m_parallel = parallel; }
+
+		/// @brief Finds all overlapping pairs of the bounds
+		/// @note Keep the index of each body the same between updates, otherwise the order is sorted from scratch
+		void update(std::span<const AABB> bounds);
+
+	private:
+		struct SortKey
+		{
+			float min;
+			uint32_t body;
+		};
+
+		/// @brief Box in a cell with the sweep axis first, copied so the sweep of a cell only reads contiguous memory
+		struct CellEntry
+		{
+			float sweepMin, sweepMax;
+			float minA, maxA;
+			float minB, maxB;
+			uint32_t body;
+		};
+
+		struct CellRange
+		{
+			uint32_t firstA, lastA;
+			uint32_t firstB, lastB;
+		};
+
+		void chooseAxis(std::span<const AABB> bounds);
+		void sortKeys(std::span<const AABB> bounds, bool fullSort);
+		void buildCells(std::span<const AABB> bounds);
+		void sweepCells(uint32_t firstCell, uint32_t lastCell, std::vector<Pair>& pairs) const;
+
+		auto cellA(float value) const -> uint32_t;
+		auto cellB(float value) const -> uint32_t;
+
+		uint32_t m_axis{ 0 };
+		bool m_parallel{ true };
+
+		std::vector<uint32_t> m_order; // Body indices sorted by their min on the sweep axis
+		std::vector<SortKey> m_keys;
+
+		// Grid on the two other axes, each cell lists the boxes touching it in sweep order
+		uint32_t m_axisA{ 1 };
+		uint32_t m_axisB{ 2 };
+		glm::vec2 m_cellOrigin{ 0.0f };
+		float m_inverseCellSize{ 1.0f };
+		uint32_t m_cellCountA{ 1 };
+		uint32_t m_cellCountB{ 1 };
+		std::vector<uint32_t> m_cellStart;
+		std::vector<CellEntry> m_cellEntries;
+		std::vector<CellRange> m_cellRanges; // Per body in sweep order
+		std::vector<uint32_t> m_cellFill;
+
+		std::vector<Pair> m_pairs;
+		std::vector<std::vector<Pair>> m_chunkPairs;
+	};
+}
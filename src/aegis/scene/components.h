@@ -46,6 +46,23 @@ namespace Aegis
 		auto matrix() const -> glm::mat4 { return Math::tranformationMatrix(location, rotation, scale); }
 	};
 
+	/// @brief Local transform at the last two simulation ticks, used instead of Transform to interpolate the rendered state
+	/// @note Transform changes outside of fixed updates are overwritten until the next tick
+	struct InterpolatedTransform
+	{
+		Transform previous;
+		Transform current;
+
+		auto interpolate(float alpha) const -> Transform
+		{
+			return Transform{
+				.location = glm::mix(previous.location, current.location, alpha),
+				.rotation = glm::slerp(previous.rotation, current.rotation, alpha),
+				.scale = glm::mix(previous.scale, current.scale, alpha),
+			};
+		}
+	};
+
 	/// @brief Stores the parent entity
 	/// @note Use Entity::setParent to set the parent of an entity 
 	struct Parent
@@ -112,6 +129,16 @@ namespace Aegis
 		// TODO: Handle fragmentation of instance buffers when moving objects
 	};
 
+	struct ColliderTag
+	{
+		// Used to add an entity with a mesh to the broadphase of the scene (see Physics::BroadphaseSystem)
+	};
+
+	struct NavigationObstacle
+	{
+		// Used to block the navigation grid with the footprint of the (static) mesh bounds (see AI::NavigationGrid)
+	};
+
 	struct AmbientLight
 	{
 		glm::vec3 color = { 1.0f, 1.0f, 1.0f };
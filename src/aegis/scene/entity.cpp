@@ -27,6 +27,12 @@ namespace Aegis::Scene
 		return m_scene->m_registry;
 	}
 
+	auto Entity::scene() const -> Scene&
+	{
+		AGX_ASSERT_X(m_scene, "Entity has no scene");
+		return *m_scene;
+	}
+
 	void Entity::addScript(Scripting::ScriptBase* script)
 	{
 		script->m_entity = *this;
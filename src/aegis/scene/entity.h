@@ -40,6 +40,7 @@ namespace Aegis::Scene
 		operator uint32_t() const { return static_cast<uint32_t>(m_id); }
 
 		[[nodiscard]] auto registry() const -> entt::registry&;
+		[[nodiscard]] auto scene() const -> Scene&;
 
 		/// @brief Checks if the entity has all components of type T...
 		template<typename... T>
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cmath>
+
+namespace Aegis::Scene
+{
+	/// @brief Accumulates frame time and splits it into simulation ticks of constant length
+	/// @note Time that can't be caught up within 'maxSteps' ticks is dropped to avoid a spiral of death
+	class FixedTimestep
+	{
+	public:
+		static constexpr float DEFAULT_TICK_RATE = 60.0f;
+		static constexpr uint32_t DEFAULT_MAX_STEPS = 5;
+		static constexpr float MIN_TICK_RATE = 1.0f;
+		static constexpr float MAX_TICK_RATE = 1000.0f;
+
+		[[nodiscard]] auto tickRate() const -> float { return m_tickRate; }
+		[[nodiscard]] auto stepSeconds() const -> float { return 1.0f / m_tickRate; }
+		[[nodiscard]] auto maxSteps() const -> uint32_t { return m_maxSteps; }
+		[[nodiscard]] auto tickCount() const -> uint64_t { return m_tickCount; }
+		[[nodiscard]] auto droppedSeconds() const -> float { return m_droppedSeconds; }
+
+		/// @brief Fraction of a tick that is accumulated but not simulated yet (0 = last tick, 1 = next tick)
+		[[nodiscard]] auto alpha() const -> float { return m_accumulator * m_tickRate; }
+
+		void setTickRate(float tickRate) { m_tickRate = std::clamp(tickRate, MIN_TICK_RATE, MAX_TICK_RATE); }
+		void setMaxSteps(uint32_t maxSteps) { m_maxSteps = std::max(maxSteps, 1u); }
+
+		/// @brief Adds the frame time and returns the number of ticks to simulate this frame
+		auto advance(float deltaSeconds) -> uint32_t
+		{
+			const float step = stepSeconds();
+			m_accumulator += deltaSeconds;
+
+			uint32_t steps = 0;
+			while (m_accumulator >= step && steps < m_maxSteps)
+			{
+				m_accumulator -= step;
+				steps++;
+			}
+
+			if (m_accumulator >= step)
+			{
+				float remainder = std::fmod(m_accumulator, step);
+				m_droppedSeconds += m_accumulator - remainder;
+				m_accumulator = remainder;
+			}
+
+			m_tickCount += steps;
+			return steps;
+		}
+
+		void reset()
+		{
+			m_accumulator = 0.0f;
+			m_droppedSeconds = 0.0f;
+			m_tickCount = 0;
+		}
+
+	private:
+		float m_tickRate{ DEFAULT_TICK_RATE };
+		uint32_t m_maxSteps{ DEFAULT_MAX_STEPS };
+		float m_accumulator{ 0.0f };
+		float m_droppedSeconds{ 0.0f };
+		uint64_t m_tickCount{ 0 };
+	};
+}
@@ -2,12 +2,13 @@
 #include "fast_gltf_loader.h"
 
 #include "engine.h"
-#include "graphics/resources/mesh_preprocessor.h"
+#include "graphics/resources/mesh_codec.h"
 #include "scene/components.h"
 
 namespace Aegis::Scene
 {
-	FastGLTFLoader::FastGLTFLoader(Scene& scene, const std::filesystem::path& path)
+	FastGLTFLoader::FastGLTFLoader(Scene& scene, const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions) :
+		m_path{ path }, m_meshOptions{ meshOptions }
 	{
 		auto data = fastgltf::GltfDataBuffer::FromPath(path);
 		if (data.error() != fastgltf::Error::None)
@@ -54,64 +55,73 @@ namespace Aegis::Scene
 			auto& mesh = gltf.meshes[i];
 			m_meshCache[i].reserve(mesh.primitives.size());
 
-			for (const auto& primitive : mesh.primitives)
+			for (size_t j = 0; j < mesh.primitives.size(); ++j)
 			{
-				Graphics::MeshPreprocessor::Input input{};
-
-				auto* posIt = primitive.findAttribute("POSITION");
-				AGX_ASSERT_X(posIt != primitive.attributes.end(), "GLTF primitive is missing POSITION attribute");
-				auto& positionAcc = gltf.accessors[posIt->accessorIndex];
-				input.positions.reserve(positionAcc.count);
-				fastgltf::iterateAccessor<fastgltf::math::fvec3>(gltf, positionAcc, [&](fastgltf::math::fvec3 pos)
-					{
-						input.positions.emplace_back(glm::vec3{ pos.x(), pos.y(), pos.z() });
-					});
-
-				auto* normIt = primitive.findAttribute("NORMAL");
-				AGX_ASSERT_X(normIt != primitive.attributes.end(), "GLTF primitive is missing NORMAL attribute");
-				auto& normalAcc = gltf.accessors[normIt->accessorIndex];
-				input.normals.reserve(normalAcc.count);
-				fastgltf::iterateAccessor<fastgltf::math::fvec3>(gltf, normalAcc, [&](fastgltf::math::fvec3 norm)
+				auto meshName = std::format("{}_{}", i, j);
+				m_meshCache[i].emplace_back(Graphics::MeshCodec::loadOrImport(m_path, meshName, m_meshOptions, [&]()
 					{
-						input.normals.emplace_back(glm::vec3{ norm.x(), norm.y(), norm.z() });
-					});
+						return importPrimitive(gltf, mesh.primitives[j]);
+					}));
+			}
+		}
+	}
 
-				auto* uvIt = primitive.findAttribute("TEXCOORD_0");
-				if (uvIt != primitive.attributes.end())
-				{
-					auto& uvAcc = gltf.accessors[uvIt->accessorIndex];
-					input.uvs.reserve(uvAcc.count);
-					fastgltf::iterateAccessor<fastgltf::math::fvec2>(gltf, uvAcc, [&](fastgltf::math::fvec2 uv)
-						{
-							input.uvs.emplace_back(glm::vec2{ uv.x(), uv.y() });
-						});
-				}
+	auto FastGLTFLoader::importPrimitive(const fastgltf::Asset& gltf, const fastgltf::Primitive& primitive) -> Graphics::StaticMesh::CreateInfo
+	{
+		Graphics::MeshPreprocessor::Input input{};
+		input.options = m_meshOptions;
+
+		auto* posIt = primitive.findAttribute("POSITION");
+		AGX_ASSERT_X(posIt != primitive.attributes.end(), "GLTF primitive is missing POSITION attribute");
+		auto& positionAcc = gltf.accessors[posIt->accessorIndex];
+		input.positions.reserve(positionAcc.count);
+		fastgltf::iterateAccessor<fastgltf::math::fvec3>(gltf, positionAcc, [&](fastgltf::math::fvec3 pos)
+			{
+				input.positions.emplace_back(glm::vec3{ pos.x(), pos.y(), pos.z() });
+			});
+
+		auto* normIt = primitive.findAttribute("NORMAL");
+		AGX_ASSERT_X(normIt != primitive.attributes.end(), "GLTF primitive is missing NORMAL attribute");
+		auto& normalAcc = gltf.accessors[normIt->accessorIndex];
+		input.normals.reserve(normalAcc.count);
+		fastgltf::iterateAccessor<fastgltf::math::fvec3>(gltf, normalAcc, [&](fastgltf::math::fvec3 norm)
+			{
+				input.normals.emplace_back(glm::vec3{ norm.x(), norm.y(), norm.z() });
+			});
 
-				auto* colorIt = primitive.findAttribute("COLOR_0");
-				if (colorIt != primitive.attributes.end())
+		auto* uvIt = primitive.findAttribute("TEXCOORD_0");
+		if (uvIt != primitive.attributes.end())
+		{
+			auto& uvAcc = gltf.accessors[uvIt->accessorIndex];
+			input.uvs.reserve(uvAcc.count);
+			fastgltf::iterateAccessor<fastgltf::math::fvec2>(gltf, uvAcc, [&](fastgltf::math::fvec2 uv)
 				{
-					auto& colorAcc = gltf.accessors[colorIt->accessorIndex];
-					input.colors.reserve(colorAcc.count);
-					fastgltf::iterateAccessor<fastgltf::math::fvec3>(gltf, colorAcc, [&](fastgltf::math::fvec3 color)
-						{
-							input.colors.emplace_back(glm::vec3{ color.x(), color.y(), color.z() });
-						});
-				}
+					input.uvs.emplace_back(glm::vec2{ uv.x(), uv.y() });
+				});
+		}
 
-				if (primitive.indicesAccessor.has_value())
+		auto* colorIt = primitive.findAttribute("COLOR_0");
+		if (colorIt != primitive.attributes.end())
+		{
+			auto& colorAcc = gltf.accessors[colorIt->accessorIndex];
+			input.colors.reserve(colorAcc.count);
+			fastgltf::iterateAccessor<fastgltf::math::fvec3>(gltf, colorAcc, [&](fastgltf::math::fvec3 color)
 				{
-					auto& indexAcc = gltf.accessors[*primitive.indicesAccessor];
-					input.indices.reserve(indexAcc.count);
-					fastgltf::iterateAccessor<uint32_t>(gltf, indexAcc, [&](uint32_t index)
-						{
-							input.indices.emplace_back(index);
-						});
-				}
+					input.colors.emplace_back(glm::vec3{ color.x(), color.y(), color.z() });
+				});
+		}
 
-				auto meshInfo = Graphics::MeshPreprocessor::process(input);
-				m_meshCache[i].emplace_back(std::make_shared<Graphics::StaticMesh>(meshInfo));
-			}
+		if (primitive.indicesAccessor.has_value())
+		{
+			auto& indexAcc = gltf.accessors[*primitive.indicesAccessor];
+			input.indices.reserve(indexAcc.count);
+			fastgltf::iterateAccessor<uint32_t>(gltf, indexAcc, [&](uint32_t index)
+				{
+					input.indices.emplace_back(index);
+				});
 		}
+
+		return Graphics::MeshPreprocessor::process(input);
 	}
 
 	void FastGLTFLoader::loadTextures(const fastgltf::Asset& gltf)
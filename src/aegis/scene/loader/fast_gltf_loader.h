@@ -1,6 +1,7 @@
 #pragma once
 
 #include "scene/scene.h"
+#include "graphics/resources/mesh_preprocessor.h"
 #include "graphics/resources/static_mesh.h"
 #include "graphics/resources/texture.h"
 #include "graphics/material/material_template.h"
@@ -15,7 +16,7 @@ namespace Aegis::Scene
 	class FastGLTFLoader
 	{
 	public:
-		FastGLTFLoader(Scene& scene, const std::filesystem::path& path);
+		FastGLTFLoader(Scene& scene, const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions = {});
 
 		[[nodiscard]] auto rootEntity() const -> Entity { return m_rootEntity; }
 
@@ -23,6 +24,7 @@ namespace Aegis::Scene
 		inline static fastgltf::Parser parser;
 
 		void loadMeshes(const fastgltf::Asset& gltf);
+		auto importPrimitive(const fastgltf::Asset& gltf, const fastgltf::Primitive& primitive) -> Graphics::StaticMesh::CreateInfo;
 		void loadTextures(const fastgltf::Asset& gltf);
 		void loadMaterials(const fastgltf::Asset& gltf);
 		void buildScene(Scene& scene, const fastgltf::Asset& gltf, size_t sceneIndex);
@@ -30,6 +32,8 @@ namespace Aegis::Scene
 		auto queryMaterial(const fastgltf::Mesh& mesh, size_t subIdx) -> std::shared_ptr<Graphics::MaterialInstance>;
 
 		Entity m_rootEntity;
+		std::filesystem::path m_path;
+		Graphics::MeshPreprocessor::Options m_meshOptions;
 		std::shared_ptr<Graphics::MaterialTemplate> m_pbrTemplate;
 		std::shared_ptr<Graphics::MaterialInstance> m_pbrDefaultMat;
 		std::filesystem::path m_basePath;
@@ -3,7 +3,7 @@
 
 #include "engine.h"
 #include "math/math.h"
-#include "graphics/resources/mesh_preprocessor.h"
+#include "graphics/resources/mesh_codec.h"
 
 #include <gltf_utils.h>
 
@@ -13,7 +13,8 @@
 
 namespace Aegis::Scene
 {
-	GLTFLoader::GLTFLoader(Scene& scene, const std::filesystem::path& path)
+	GLTFLoader::GLTFLoader(Scene& scene, const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions) :
+		m_path{ path }, m_meshOptions{ meshOptions }
 	{
 		m_gltf = GLTF::load(path);
 		AGX_ASSERT_X(m_gltf.has_value(), "Failed to load GLTF file");
@@ -123,15 +124,18 @@ namespace Aegis::Scene
 		// Load mesh
 		auto& primitive = m_gltf->meshes[meshIndex].primitives[primitiveIndex];
 
-		Graphics::MeshPreprocessor::Input input{};
-		GLTF::copyAttribute("POSITION", input.positions, primitive, *m_gltf);
-		GLTF::copyAttribute("COLOR_0", input.colors, primitive, *m_gltf);
-		GLTF::copyAttribute("NORMAL", input.normals, primitive, *m_gltf);
-		GLTF::copyAttribute("TEXCOORD_0", input.uvs, primitive, *m_gltf);
-		GLTF::copyIndices(input.indices, primitive, *m_gltf);
-
-		auto info = Graphics::MeshPreprocessor::process(input);
-		auto mesh = std::make_shared<Graphics::StaticMesh>(info);
+		auto meshName = std::format("{}_{}", meshIndex, primitiveIndex);
+		auto mesh = Graphics::MeshCodec::loadOrImport(m_path, meshName, m_meshOptions, [&]()
+			{
+				Graphics::MeshPreprocessor::Input input{};
+				input.options = m_meshOptions;
+				GLTF::copyAttribute("POSITION", input.positions, primitive, *m_gltf);
+				GLTF::copyAttribute("COLOR_0", input.colors, primitive, *m_gltf);
+				GLTF::copyAttribute("NORMAL", input.normals, primitive, *m_gltf);
+				GLTF::copyAttribute("TEXCOORD_0", input.uvs, primitive, *m_gltf);
+				GLTF::copyIndices(input.indices, primitive, *m_gltf);
+				return Graphics::MeshPreprocessor::process(input);
+			});
 		m_meshes[meshIndex].emplace_back(mesh);
 		return mesh;
 	}
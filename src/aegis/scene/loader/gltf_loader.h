@@ -1,5 +1,6 @@
 #pragma once
 
+#include "graphics/resources/mesh_preprocessor.h"
 #include "graphics/resources/static_mesh.h"
 #include "graphics/resources/texture.h"
 #include "scene/components.h"
@@ -12,7 +13,7 @@ namespace Aegis::Scene
 	class GLTFLoader
 	{
 	public:
-		GLTFLoader(Scene& scene, const std::filesystem::path& path);
+		GLTFLoader(Scene& scene, const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions = {});
 
 		[[nodiscard]] auto rootEntity() const -> Entity { return m_rootEntity; }
 
@@ -29,6 +30,8 @@ namespace Aegis::Scene
 		std::vector<std::vector<std::shared_ptr<Graphics::StaticMesh>>> m_meshes;
 		std::vector<Entity> m_entities;
 		Entity m_rootEntity;
+		std::filesystem::path m_path;
+		Graphics::MeshPreprocessor::Options m_meshOptions;
 
 		std::shared_ptr<Graphics::MaterialTemplate> m_pbrTemplate;
 		std::shared_ptr<Graphics::MaterialInstance> m_pbrDefaultMat;
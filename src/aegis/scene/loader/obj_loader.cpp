@@ -1,7 +1,7 @@
 #include "pch.h"
 #include "obj_loader.h"
 
-#include "graphics/resources/mesh_preprocessor.h"
+#include "graphics/resources/mesh_codec.h"
 #include "scene/components.h"
 #include "engine.h"
 
@@ -10,7 +10,17 @@
 
 namespace Aegis::Scene
 {
-	OBJLoader::OBJLoader(Scene& scene, const std::filesystem::path& path)
+	OBJLoader::OBJLoader(Scene& scene, const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions)
+	{
+		auto mesh = Graphics::MeshCodec::loadOrImport(path, "", meshOptions, [&]() { return importMesh(path, meshOptions); });
+
+		m_rootEntity = scene.createEntity(path.stem().string());
+		m_rootEntity.add<Mesh>(mesh);
+		m_rootEntity.add<Material>(Engine::assets().get<Graphics::MaterialInstance>("default/PBR_instance"));
+	}
+
+	auto OBJLoader::importMesh(const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions)
+		-> Graphics::StaticMesh::CreateInfo
 	{
 		tinyobj::attrib_t attrib;
 		std::vector<tinyobj::shape_t> shapes;
@@ -26,6 +36,7 @@ namespace Aegis::Scene
 		}
 	
 		Graphics::MeshPreprocessor::Input raw{};
+		raw.options = meshOptions;
 		raw.positions.reserve(totalIndexCount);
 		raw.normals.reserve(totalIndexCount);
 		raw.uvs.reserve(totalIndexCount);
@@ -71,11 +82,6 @@ namespace Aegis::Scene
 			}
 		}
 
-		auto info = Graphics::MeshPreprocessor::process(raw);
-		auto mesh = std::make_shared<Graphics::StaticMesh>(info);
-
-		m_rootEntity = scene.createEntity(path.stem().string());
-		m_rootEntity.add<Mesh>(mesh);
-		m_rootEntity.add<Material>(Engine::assets().get<Graphics::MaterialInstance>("default/PBR_instance"));
+		return Graphics::MeshPreprocessor::process(raw);
 	}
 }
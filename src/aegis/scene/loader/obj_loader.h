@@ -1,5 +1,6 @@
 #pragma once
 
+#include "graphics/resources/mesh_preprocessor.h"
 #include "scene/scene.h"
 
 namespace Aegis::Scene
@@ -7,10 +8,14 @@ namespace Aegis::Scene
 	class OBJLoader
 	{
 	public:
-		OBJLoader(Scene& scene, const std::filesystem::path& path);
+		OBJLoader(Scene& scene, const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions = {});
 
 		[[nodiscard]] auto rootEntity() const -> Entity { return m_rootEntity; }
 
+		/// @brief Reads all shapes of the OBJ file into a single preprocessed mesh
+		static auto importMesh(const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions)
+			-> Graphics::StaticMesh::CreateInfo;
+
 	private:
 		Entity m_rootEntity;
 	};
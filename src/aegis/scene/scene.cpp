@@ -4,6 +4,8 @@
 #include "core/profiler.h"
 #include "engine.h"
 #include "graphics/resources/static_mesh.h"
+#include "physics/broadphase_system.h"
+#include "physics/motion_dynamics_system.h"
 #include "scene/components.h"
 #include "scene/entity.h"
 #include "scene/loader/fast_gltf_loader.h"
@@ -50,6 +52,12 @@ namespace Aegis::Scene
 	{
 		AGX_PROFILE_FUNCTION();
 
+		uint32_t steps = m_fixedTimestep.advance(deltaSeconds);
+		for (uint32_t i = 0; i < steps; i++)
+		{
+			fixedUpdate(m_fixedTimestep.stepSeconds());
+		}
+
 		for (auto& system : m_systems)
 		{
 			system->onUpdate(deltaSeconds, *this);
@@ -58,17 +66,37 @@ namespace Aegis::Scene
 		m_scriptManager.update(deltaSeconds);
 	}
 
-	auto Scene::load(const std::filesystem::path& path) -> Entity
+	void Scene::fixedUpdate(float fixedDeltaSeconds)
+	{
+		AGX_PROFILE_FUNCTION();
+
+		for (auto& system : m_systems)
+		{
+			system->onFixedUpdate(fixedDeltaSeconds, *this);
+		}
+
+		m_scriptManager.fixedUpdate(fixedDeltaSeconds);
+
+		// Keep the state of the last two ticks to interpolate between them when rendering
+		auto view = m_registry.view<Transform, InterpolatedTransform>();
+		for (auto&& [entity, transform, interpolated] : view.each())
+		{
+			interpolated.previous = interpolated.current;
+			interpolated.current = transform;
+		}
+	}
+
+	auto Scene::load(const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions) -> Entity
 	{
 		if (path.extension() == ".gltf" || path.extension() == ".glb")
 		{
-			//GLTFLoader loader{ *this, path };
-			FastGLTFLoader loader{ *this, path };
+			//GLTFLoader loader{ *this, path, meshOptions };
+			FastGLTFLoader loader{ *this, path, meshOptions };
 			return loader.rootEntity();
 		}
 		else if (path.extension() == ".obj")
 		{
-			OBJLoader loader{ *this, path };
+			OBJLoader loader{ *this, path, meshOptions };
 			return loader.rootEntity();
 		}
 		else
@@ -83,8 +111,12 @@ namespace Aegis::Scene
 	{
 		// TODO: Clear old scene
 
+		m_fixedTimestep.reset();
+
 		addSystem<CameraSystem>();
 		addSystem<TransformSystem>();
+		addSystem<Physics::MotionDynamicsSystem>();
+		addSystem<Physics::BroadphaseSystem>();
 
 		m_mainCamera = createEntity("Main Camera");
 		m_mainCamera.add<Camera>();
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "graphics/resources/mesh_preprocessor.h"
 #include "scene/entity.h"
+#include "scene/fixed_timestep.h"
 #include "scene/system.h"
 #include "scripting/script_manager.h"
 #include "math/math.h"
@@ -33,6 +35,7 @@ namespace Aegis::Scene
 		[[nodiscard]] auto ambientLight() const -> Entity { return m_ambientLight; }
 		[[nodiscard]] auto directionalLight() const -> Entity { return m_directionalLight; }
 		[[nodiscard]] auto environment() const -> Entity { return m_skybox; }
+		[[nodiscard]] auto fixedTimestep() -> FixedTimestep& { return m_fixedTimestep; }
 
 		void setMainCamera(Entity camera) { m_mainCamera = camera; }
 
@@ -43,6 +46,18 @@ namespace Aegis::Scene
 			m_systems.emplace_back(std::make_unique<T>(std::forward<Args>(args)...));
 		}
 
+		/// @brief Returns the first system of type T or nullptr if the scene has none
+		template <SystemDerived T>
+		[[nodiscard]] auto system() -> T*
+		{
+			for (auto& system : m_systems)
+			{
+				if (auto derived = dynamic_cast<T*>(system.get()))
+					return derived;
+			}
+			return nullptr;
+		}
+
 		/// @brief Creates an entity with a NameComponent and TransformComponent
 		/// @note Scene::Entity can be passed by value
 		auto createEntity(const std::string& name = std::string(), const glm::vec3& location = glm::vec3{ 0.0f },
@@ -55,17 +70,22 @@ namespace Aegis::Scene
 
 		void begin();
 
+		/// @brief Runs the fixed updates for the accumulated time and then the per frame updates
 		void update(float deltaSeconds);
 
 		/// @brief Loads a scene from a file and returns the root entity
-		auto load(const std::filesystem::path& path) -> Entity;
+		/// @note The mesh options opt into processing steps like the cluster LOD hierarchy for all meshes of the file
+		auto load(const std::filesystem::path& path, const Graphics::MeshPreprocessor::Options& meshOptions = {}) -> Entity;
 
 		void reset();
 
 	private:
+		void fixedUpdate(float fixedDeltaSeconds);
+
 		entt::registry m_registry;
 		std::vector<std::unique_ptr<System>> m_systems;
 		Scripting::ScriptManager m_scriptManager;
+		FixedTimestep m_fixedTimestep;
 
 		Entity m_mainCamera;
 		Entity m_ambientLight;
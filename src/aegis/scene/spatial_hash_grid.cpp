@@ -0,0 +1,75 @@
+#include "pch.h"
+#include "spatial_hash_grid.h"
+
+#include <bit>
+
+namespace Aegis::Scene
+{
+	SpatialHashGrid::SpatialHashGrid(float cellSize)
+	{
+		setCellSize(cellSize);
+	}
+
+	void SpatialHashGrid::setCellSize(float cellSize)
+	{
+		AGX_ASSERT_X(cellSize > 0.0f, "Spatial hash grid requires a positive cell size");
+		m_cellSize = cellSize;
+		m_inverseCellSize = 1.0f / cellSize;
+	}
+
+	void SpatialHashGrid::clear()
+	{
+		m_entities.clear();
+		m_locations.clear();
+	}
+
+	void SpatialHashGrid::insert(entt::entity entity, const glm::vec3& location)
+	{
+		m_entities.emplace_back(entity);
+		m_locations.emplace_back(location);
+	}
+
+	void SpatialHashGrid::build()
+	{
+		const uint32_t count = size();
+
+		// About two buckets per entry keeps collisions between occupied cells rare
+		const uint32_t bucketCount = std::bit_ceil(std::max(count * 2, 2u));
+		m_bucketMask = bucketCount - 1;
+		m_bucketStart.assign(bucketCount + 1, 0);
+
+		m_cells.resize(count);
+		m_buckets.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_cells[i] = cellCoord(m_locations[i]);
+			m_buckets[i] = hash(m_cells[i]);
+			m_bucketStart[m_buckets[i] + 1]++;
+		}
+
+		for (uint32_t bucket = 0; bucket < bucketCount; bucket++)
+		{
+			m_bucketStart[bucket + 1] += m_bucketStart[bucket];
+		}
+
+		m_cursor.assign(m_bucketStart.begin(), m_bucketStart.end() - 1);
+		m_sortedEntities.resize(count);
+		m_sortedLocations.resize(count);
+		m_sortedCells.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t target = m_cursor[m_buckets[i]]++;
+			m_sortedEntities[target] = m_entities[i];
+			m_sortedLocations[target] = m_locations[i];
+			m_sortedCells[target] = m_cells[i];
+		}
+	}
+
+	void SpatialHashGrid::queryRadius(const glm::vec3& center, float radius, std::vector<entt::entity>& result) const
+	{
+		forEachInRadius(center, radius, [&result](entt::entity entity, const glm::vec3&)
+			{
+				result.emplace_back(entity);
+			});
+	}
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "math/math.h"
+
+#include <entt/entt.hpp>
+
+namespace Aegis::Scene
+{
+	/// @brief Uniform grid hashed into a flat table for radius queries over many moving points
+	/// @note Rebuilt from scratch with a counting sort, so entries are contiguous per bucket and no allocations
+	///       happen once the capacity is reached. Cells that collide in the table are told apart by their coordinates.
+	class SpatialHashGrid
+	{
+	public:
+		static constexpr float DEFAULT_CELL_SIZE = 5.0f;
+
+		explicit SpatialHashGrid(float cellSize = DEFAULT_CELL_SIZE);
+
+		[[nodiscard]] auto cellSize() const -> float { return m_cellSize; }
+		[[nodiscard]] auto size() const -> uint32_t { return static_cast<uint32_t>(m_entities.size()); }
+		[[nodiscard]] auto empty() const -> bool { return m_entities.empty(); }
+
+		/// @brief Changes the cell size, takes effect with the next build
+		/// @note Queries are fastest if the cell size is close to the most used query radius
+		void setCellSize(float cellSize);
+
+		/// @brief Removes all entries (keeps the capacity)
+		void clear();
+
+		/// @brief Adds an entry, it is only visible to queries after the next build
+		void insert(entt::entity entity, const glm::vec3& location);
+
+		/// @brief Sorts all inserted entries into their cells
+		void build();
+
+		/// @brief Calls func(entity, location) for every entry within the radius around the center (including itself)
+		template<typename Func>
+		void forEachInRadius(const glm::vec3& center, float radius, Func&& func) const
+		{
+			if (m_entities.empty())
+				return;
+
+			const float radiusSquared = radius * radius;
+			const glm::ivec3 minCell = cellCoord(center - glm::vec3{ radius });
+			const glm::ivec3 maxCell = cellCoord(center + glm::vec3{ radius });
+			for (int z = minCell.z; z <= maxCell.z; z++)
+			{
+				for (int y = minCell.y; y <= maxCell.y; y++)
+				{
+					for (int x = minCell.x; x <= maxCell.x; x++)
+					{
+						const glm::ivec3 cell{ x, y, z };
+						const uint32_t bucket = hash(cell);
+						for (uint32_t i = m_bucketStart[bucket]; i < m_bucketStart[bucket + 1]; i++)
+						{
+							if (m_sortedCells[i] != cell)
+								continue;
+
+							const glm::vec3 offset = m_sortedLocations[i] - center;
+							if (glm::dot(offset, offset) <= radiusSquared)
+								func(m_sortedEntities[i], m_sortedLocations[i]);
+						}
+					}
+				}
+			}
+		}
+
+		/// @brief Appends all entities within the radius around the center to the result
+		void queryRadius(const glm::vec3& center, float radius, std::vector<entt::entity>& result) const;
+
+	private:
+		[[nodiscard]] auto cellCoord(const glm::vec3& location) const -> glm::ivec3
+		{
+			return glm::ivec3{ glm::floor(location * m_inverseCellSize) };
+		}
+
+		[[nodiscard]] auto hash(const glm::ivec3& cell) const -> uint32_t
+		{
+			// Large primes to spread neighbouring cells over the table (Teschner et al. 2003)
+			const uint32_t h = (static_cast<uint32_t>(cell.x) * 73856093u) ^
+				(static_cast<uint32_t>(cell.y) * 19349663u) ^
+				(static_cast<uint32_t>(cell.z) * 83492791u);
+			return h & m_bucketMask;
+		}
+
+		float m_cellSize;
+		float m_inverseCellSize;
+		uint32_t m_bucketMask{ 0 };
+
+		// Unsorted input and its cells and buckets (kept to reuse the memory)
+		std::vector<entt::entity> m_entities;
+		std::vector<glm::vec3> m_locations;
+		std::vector<glm::ivec3> m_cells;
+		std::vector<uint32_t> m_buckets;
+		std::vector<uint32_t> m_cursor;
+
+		// Sorted by bucket, m_bucketStart has one entry more than buckets to mark the end
+		std::vector<uint32_t> m_bucketStart{ 0, 0 };
+		std::vector<entt::entity> m_sortedEntities;
+		std::vector<glm::vec3> m_sortedLocations;
+		std::vector<glm::ivec3> m_sortedCells;
+	};
+}
@@ -16,6 +16,7 @@ namespace Aegis::Scene
 		virtual void onDetach() {}
 		virtual void onBegin(Scene& scene) {}
 		virtual void onUpdate(float deltaSeconds, Scene& scene) {}
+		virtual void onFixedUpdate(float fixedDeltaSeconds, Scene& scene) {}
 	};
 
 	template <typename T>
@@ -36,10 +36,16 @@ namespace Aegis::Scene
 
 	void TransformSystem::onUpdate(float deltaSeconds, Scene& scene)
 	{
+		// Simulated entities are rendered between their last two ticks
+		float alpha = scene.fixedTimestep().alpha();
+
 		// Note: This lags 1 frame per parent behind the actual local transform (but this is fine :)
 		auto view = scene.registry().view<Transform, GlobalTransform, Parent, DynamicTag>();
-		for (auto&& [entity, transform, globalTransform, parent] : view.each())
+		for (auto&& [entity, localTransform, globalTransform, parent] : view.each())
 		{
+			const auto* interpolated = scene.registry().try_get<InterpolatedTransform>(entity);
+			const Transform transform = interpolated ? interpolated->interpolate(alpha) : localTransform;
+
 			if (!parent.entity || !parent.entity.has<GlobalTransform>())
 			{
 				globalTransform.location = transform.location;
@@ -6,7 +6,8 @@
 
 namespace Aegis::Scripting
 {
-	void DynamicMovementController::update(float deltaSeconds)
+	// Note: Forces are added per tick, the MotionDynamicsSystem applies them with the tick length at the start of the next tick
+	void DynamicMovementController::fixedUpdate([[maybe_unused]] float fixedDeltaSeconds)
 	{
 		auto& transform = get<Transform>();
 		auto& dynamics = get<Physics::MotionDynamics>();
@@ -16,7 +16,7 @@ namespace Aegis::Scripting
 			Input::Key rotateRight = Input::Right;
 		};
 
-		virtual void update(float deltaSeconds) override;
+		virtual void fixedUpdate(float fixedDeltaSeconds) override;
 		
 	private:
 		KeyMappings m_keys{};
@@ -17,6 +17,8 @@ namespace Aegis::Scripting
 		virtual void begin() {}
 		/// @brief Called every frame with the delta of the last two frames in seconds
 		virtual void update(float deltaSeconds) {}
+		/// @brief Called at the fixed tick rate of the scene with the tick length in seconds (see Scene::FixedTimestep)
+		virtual void fixedUpdate(float fixedDeltaSeconds) {}
 		/// @brief Called once at the end of the last frame
 		virtual void end() {}
 
@@ -30,6 +30,16 @@ namespace Aegis::Scripting
 		}
 	}
 
+	void ScriptManager::fixedUpdate(float fixedDeltaSeconds)
+	{
+		handleNewScripts();
+
+		for (auto& script : m_scripts)
+		{
+			script->fixedUpdate(fixedDeltaSeconds);
+		}
+	}
+
 	void ScriptManager::handleNewScripts()
 	{
 		for (auto& script : m_newScripts)
@@ -22,6 +22,9 @@ namespace Aegis::Scripting
 		/// @brief Calls the update function of each script
 		void update(float deltaSeconds);
 
+		/// @brief Calls the fixed update function of each script
+		void fixedUpdate(float fixedDeltaSeconds);
+
 	private:
 		/// @brief Calls the begin function of each script once
 		void handleNewScripts();
@@ -0,0 +1,97 @@
+#include "pch.h"
+#include "memory_panel.h"
+
+#include "graphics/vulkan/vulkan_context.h"
+
+#include <format>
+
+namespace Aegis::UI
+{
+	namespace
+	{
+		constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+		auto toMB(VkDeviceSize bytes) -> double
+		{
+			return static_cast<double>(bytes) / BYTES_PER_MB;
+		}
+	}
+
+	void MemoryPanel::draw()
+	{
+		if (!ImGui::Begin("GPU Memory"))
+		{
+			ImGui::End();
+			return;
+		}
+
+		auto& tracker = Graphics::VulkanContext::memoryTracker();
+		if (!Graphics::VulkanContext::device().isMemoryBudgetSupported())
+		{
+			ImGui::TextDisabled("VK_EXT_memory_budget not supported, budgets are estimated");
+		}
+
+		const ImGuiTableFlags flags = ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_BordersOuterH;
+		if (ImGui::BeginTable("Heaps", 4, flags))
+		{
+			ImGui::TableSetupColumn("Heap", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableSetupColumn("Usage / Budget (MB)", ImGuiTableColumnFlags_WidthStretch);
+			ImGui::TableSetupColumn("Blocks", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableSetupColumn("Fragmentation (%)", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableHeadersRow();
+
+			auto heaps = tracker.heapStats();
+			for (uint32_t i = 0; i < heaps.size(); i++)
+			{
+				const auto& heap = heaps[i];
+				ImGui::TableNextRow();
+				ImGui::TableSetColumnIndex(0);
+				ImGui::Text("%u %s", i, heap.deviceLocal ? "(Device)" : "(Host)");
+				ImGui::TableSetColumnIndex(1);
+				auto usage = heap.budget > 0 ? static_cast<float>(heap.usage) / static_cast<float>(heap.budget) : 0.0f;
+				auto overlay = std::format("{:.1f} / {:.1f}", toMB(heap.usage), toMB(heap.budget));
+				ImGui::ProgressBar(usage, ImVec2(-FLT_MIN, 0.0f), overlay.c_str());
+				ImGui::TableSetColumnIndex(2);
+				ImGui::Text("%u", heap.blockCount);
+				ImGui::TableSetColumnIndex(3);
+				ImGui::Text("%6.2f", heap.fragmentation() * 100.0f);
+			}
+			ImGui::EndTable();
+		}
+
+		ImGui::Spacing();
+
+		if (ImGui::BeginTable("Categories", 3, flags))
+		{
+			ImGui::TableSetupColumn("Category", ImGuiTableColumnFlags_WidthStretch);
+			ImGui::TableSetupColumn("Size (MB)", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableSetupColumn("Allocations", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableHeadersRow();
+
+			for (uint32_t i = 0; i < Graphics::MemoryTracker::CATEGORY_COUNT; i++)
+			{
+				auto category = static_cast<Graphics::MemoryCategory>(i);
+				auto stats = tracker.categoryStats(category);
+				ImGui::TableNextRow();
+				ImGui::TableSetColumnIndex(0);
+				ImGui::Text("%s", Graphics::MemoryTracker::categoryName(category));
+				ImGui::TableSetColumnIndex(1);
+				ImGui::Text("%9.2f", toMB(stats.bytes));
+				ImGui::TableSetColumnIndex(2);
+				ImGui::Text("%u", stats.allocationCount);
+			}
+			ImGui::EndTable();
+		}
+
+		ImGui::Spacing();
+
+		if (ImGui::Button("Write Report"))
+		{
+			tracker.writeReport();
+		}
+		ImGui::SameLine();
+		ImGui::TextDisabled("%s", Graphics::MemoryTracker::REPORT_FILE);
+
+		ImGui::End();
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <imgui.h>
+
+namespace Aegis::UI
+{
+	/// @brief Shows the GPU memory budgets per heap and the memory used per category
+	class MemoryPanel
+	{
+	public:
+		void draw();
+	};
+}
@@ -17,7 +17,8 @@ namespace Aegis::UI
 			Scene       = 1 << 2,
 			Statistics  = 1 << 3,
 			Profiler    = 1 << 4,
-			Demo        = 1 << 5
+			Demo        = 1 << 5,
+			Memory      = 1 << 6
 		};
 
 		[[nodiscard]] auto flagActive(MenuFlags flag) const -> bool { return m_flags & flag; }
@@ -41,6 +42,9 @@ namespace Aegis::UI
 				if (ImGui::MenuItem("Profiler", nullptr, m_flags & MenuFlags::Profiler))
 					m_flags ^= MenuFlags::Profiler;
 
+				if (ImGui::MenuItem("Memory", nullptr, m_flags & MenuFlags::Memory))
+					m_flags ^= MenuFlags::Memory;
+
 				if (ImGui::MenuItem("ImGui Demo", nullptr, m_flags & MenuFlags::Demo))
 					m_flags ^= MenuFlags::Demo;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/profiler.h"
+#include "engine.h"
 
 #include <imgui.h>
 
@@ -26,6 +27,48 @@ namespace Aegis::UI
 
 			ImGui::Spacing();
 
+			if (ImGui::CollapsingHeader("Frame Pacing"))
+			{
+				auto& pacer = Engine::framePacer();
+
+				bool enabled = pacer.isEnabled();
+				if (ImGui::Checkbox("FPS Limit", &enabled))
+					pacer.setEnabled(enabled);
+
+				ImGui::BeginDisabled(!enabled);
+				int mode = static_cast<int>(pacer.mode());
+				if (ImGui::Combo("Mode", &mode, "Hybrid (Sleep + Spin)\0Busy Wait\0Present (VSync)\0"))
+					pacer.setMode(static_cast<Core::FramePacer::Mode>(mode));
+
+				ImGui::BeginDisabled(pacer.mode() == Core::FramePacer::Mode::Present);
+				int targetFPS = static_cast<int>(pacer.targetFPS());
+				if (ImGui::DragInt("Target FPS", &targetFPS, 1.0f, Core::FramePacer::MIN_TARGET_FPS, Core::FramePacer::MAX_TARGET_FPS))
+					pacer.setTargetFPS(static_cast<uint32_t>(targetFPS));
+
+				ImGui::Text("Sleep: %.3f ms  Spin: %.3f ms", pacer.sleepTime(), pacer.spinTime());
+				ImGui::Text("Overshoot: %.3f ms  Spin Threshold: %.3f ms", pacer.overshoot(), pacer.spinThreshold());
+				ImGui::EndDisabled();
+				ImGui::EndDisabled();
+			}
+
+			if (ImGui::CollapsingHeader("Simulation"))
+			{
+				auto& timestep = Engine::scene().fixedTimestep();
+
+				float tickRate = timestep.tickRate();
+				if (ImGui::DragFloat("Tick Rate (Hz)", &tickRate, 1.0f, Scene::FixedTimestep::MIN_TICK_RATE, Scene::FixedTimestep::MAX_TICK_RATE, "%.0f"))
+					timestep.setTickRate(tickRate);
+
+				int maxSteps = static_cast<int>(timestep.maxSteps());
+				if (ImGui::DragInt("Max Steps per Frame", &maxSteps, 0.1f, 1, 32))
+					timestep.setMaxSteps(static_cast<uint32_t>(maxSteps));
+
+				ImGui::Text("Ticks: %llu  Alpha: %.2f", static_cast<unsigned long long>(timestep.tickCount()), timestep.alpha());
+				ImGui::Text("Dropped: %.3f s", timestep.droppedSeconds());
+			}
+
+			ImGui::Spacing();
+
 			const ImGuiTableFlags flags = ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_BordersOuterH;
 			const ImVec2 outer_size = ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing() * 10);
 			if (ImGui::BeginTable("CPU Times", 3, flags, outer_size))
@@ -52,15 +95,31 @@ namespace Aegis::UI
 
 			ImGui::Spacing();
 
-			if (ImGui::BeginTable("GPU Times", 3, flags, outer_size))
+			auto& gpuTimer = Graphics::GPUTimerManager::instance();
+			bool statistics = gpuTimer.isStatisticsEnabled();
+			ImGui::BeginDisabled(!gpuTimer.isStatisticsSupported());
+			if (ImGui::Checkbox("Pipeline Statistics", &statistics))
+				gpuTimer.setStatisticsEnabled(statistics);
+			ImGui::EndDisabled();
+
+			int columnCount = statistics ? 8 : 3;
+			if (ImGui::BeginTable("GPU Times", columnCount, flags, outer_size))
 			{
 				ImGui::TableSetupScrollFreeze(0, 1); // Make top row always visible
 				ImGui::TableSetupColumn("GPU Time", ImGuiTableColumnFlags_WidthStretch);
 				ImGui::TableSetupColumn("Time (ms)", ImGuiTableColumnFlags_WidthFixed);
 				ImGui::TableSetupColumn("Frame Percent (%)", ImGuiTableColumnFlags_WidthFixed);
+				if (statistics)
+				{
+					ImGui::TableSetupColumn("Primitives", ImGuiTableColumnFlags_WidthFixed);
+					ImGui::TableSetupColumn("Fragments", ImGuiTableColumnFlags_WidthFixed);
+					ImGui::TableSetupColumn("Compute", ImGuiTableColumnFlags_WidthFixed);
+					ImGui::TableSetupColumn("Task", ImGuiTableColumnFlags_WidthFixed);
+					ImGui::TableSetupColumn("Mesh", ImGuiTableColumnFlags_WidthFixed);
+				}
 				ImGui::TableHeadersRow();
 
-				for (const auto& timing : Graphics::GPUTimerManager::instance().timings())
+				for (const auto& timing : gpuTimer.timings())
 				{
 					ImGui::TableNextRow();
 					ImGui::TableSetColumnIndex(0);
@@ -69,11 +128,45 @@ namespace Aegis::UI
 					ImGui::Text("%7.3f", timing.timeMs);
 					ImGui::TableSetColumnIndex(2);
 					ImGui::Text("%7.2f", timing.timeMs / frameTime * 100.0);
+					if (statistics && timing.statistics)
+					{
+						ImGui::TableSetColumnIndex(3);
+						ImGui::Text("%llu", static_cast<unsigned long long>(timing.statistics->clippingPrimitives));
+						ImGui::TableSetColumnIndex(4);
+						ImGui::Text("%llu", static_cast<unsigned long long>(timing.statistics->fragmentInvocations));
+						ImGui::TableSetColumnIndex(5);
+						ImGui::Text("%llu", static_cast<unsigned long long>(timing.statistics->computeInvocations));
+						ImGui::TableSetColumnIndex(6);
+						ImGui::Text("%llu", static_cast<unsigned long long>(timing.statistics->taskInvocations));
+						ImGui::TableSetColumnIndex(7);
+						ImGui::Text("%llu", static_cast<unsigned long long>(timing.statistics->meshInvocations));
+					}
 				}
 				ImGui::EndTable();
 			}
 
+			ImGui::Spacing();
+
+			// Writes CPU and GPU timings of the next frames to CSV and JSON (see ProfileCapture)
+			auto& capture = Engine::renderer().profileCapture();
+			if (capture.isCapturing())
+			{
+				ImGui::Text("Capturing frame %u / %u", capture.capturedFrames(), capture.frameCount());
+			}
+			else
+			{
+				ImGui::SetNextItemWidth(100.0f);
+				ImGui::InputInt("Frames", &m_captureFrames);
+				m_captureFrames = std::max(m_captureFrames, 1);
+				ImGui::SameLine();
+				if (ImGui::Button("Capture"))
+					capture.start(static_cast<uint32_t>(m_captureFrames));
+			}
+
 			ImGui::End();
 		}
+
+	private:
+		int m_captureFrames{ 300 };
 	};
 }
\ No newline at end of file
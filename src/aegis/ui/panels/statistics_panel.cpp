@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "statistics_panel.h"
 
+#include "ai/scheduler/ai_scheduler.h"
 #include "engine.h"
 #include "scene/components.h"
 
@@ -27,6 +28,16 @@ namespace Aegis::UI
 		ImGui::Text(" - Static Instances: %d", drawBatcher.staticInstanceCount());
 		ImGui::Text(" - Dynamic Instances: %d", drawBatcher.dynamicInstanceCount());
 
+		if (auto scheduler = Engine::scene().system<AI::AIScheduler>())
+		{
+			const auto& stats = scheduler->stats();
+			ImGui::Separator();
+			ImGui::Text("AI Agents: %d", registry.view<AI::ScheduledAgent>().size());
+			ImGui::Text(" - Ticked: %d", stats.ticked);
+			ImGui::Text(" - Skipped (LOD): %d", stats.skipped);
+			ImGui::Text(" - Deferred (Budget): %d", stats.deferred);
+		}
+
 		ImGui::End();
 	}
 }
\ No newline at end of file
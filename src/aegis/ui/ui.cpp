@@ -81,8 +81,10 @@ namespace Aegis::UI
 		ImGui::DestroyContext();
 	}
 
-	void UI::render(VkCommandBuffer commandBuffer)
+	void UI::build()
 	{
+		AGX_PROFILE_FUNCTION();
+
 		ImGui_ImplVulkan_NewFrame();
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
@@ -112,6 +114,10 @@ namespace Aegis::UI
 		ImGui::End();
 
 		ImGui::Render();
+	}
+
+	void UI::render(VkCommandBuffer commandBuffer)
+	{
 		ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffer);
 	}
 }
\ No newline at end of file
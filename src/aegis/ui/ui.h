@@ -23,8 +23,13 @@ namespace Aegis::UI
 		UI& operator=(const UI&) = delete;
 		UI& operator=(UI&&) = delete;
 
-		/// @brief Renders all GUI elements
-		void render(VkCommandBuffer commandBuffer);
+		/// @brief Builds the GUI of all layers for this frame
+		/// @note Call on the main thread while the renderer is idle (the panels access the scene and the renderer)
+		void build();
+
+		/// @brief Records the GUI built last
+		/// @note The draw data stays valid until the next call to build
+		static void render(VkCommandBuffer commandBuffer);
 
 	private:
 		Core::LayerStack& m_layerStack;
@@ -33,4 +33,14 @@ namespace Aegis::File
 
 		return buffer;
 	}
+
+	bool writeBinary(const std::filesystem::path& filePath, const std::vector<char>& data)
+	{
+		std::ofstream file{ filePath, std::ios::binary | std::ios::trunc };
+		if (!file.is_open())
+			return false;
+
+		file.write(data.data(), static_cast<std::streamsize>(data.size()));
+		return file.good();
+	}
 }
\ No newline at end of file
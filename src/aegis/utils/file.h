@@ -13,4 +13,10 @@ namespace Aegis::File
 	/// @param offset Byte offset from the beginning of the file
 	/// @return A vector with the contents of the file or an empty vector if the file could not be read
 	std::vector<char> readBinary(const std::filesystem::path& filePath, size_t size, size_t offset = 0);
-}
+
+	/// @brief Writes the data to a binary file (overwrites existing files)
+	/// @param filePath Path to the file to write
+	/// @param data Bytes to write
+	/// @return True if the file was written successfully
+	bool writeBinary(const std::filesystem::path& filePath, const std::vector<char>& data);
+}
\ No newline at end of file
@@ -36,6 +36,12 @@ namespace Aegis
 			return m_sum / N;
 		}
 
+		/// @brief Get the most recently added value
+		auto latest() const -> double
+		{
+			return m_values[(m_index + N - 1) % N];
+		}
+
 	private:
 		std::array<double, N> m_values{};
 		double m_sum = 0.0;